@@ -108,11 +108,43 @@
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Disable the cell table used for fast access of global variables
+ */
+// #define CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+
+/**
+ * Disable the cache of property names listed by for-in statements
+ */
+// #define CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+
 /**
  * Disable ECMA property hashmap
  */
 // #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 
+/**
+ * Disable the cache of byte codes compiled from recently parsed sources
+ */
+// #define CONFIG_PARSER_CODE_CACHE_DISABLE
+
+/**
+ * Maximum number of steps executed by the RegExp matcher in a single exec call.
+ * When the limit is exceeded, a RangeError is thrown. Zero means unlimited.
+ */
+#ifndef CONFIG_REGEXP_STEP_LIMIT
+# define CONFIG_REGEXP_STEP_LIMIT (0)
+#endif /* !CONFIG_REGEXP_STEP_LIMIT */
+
+/**
+ * Number of compiled RegExp patterns kept in the RegExp bytecode cache.
+ * The cache consists of rows of eight entries, so the size must be eight
+ * times a power of two.
+ */
+#ifndef CONFIG_REGEXP_CACHE_SIZE
+# define CONFIG_REGEXP_CACHE_SIZE (64)
+#endif /* !CONFIG_REGEXP_CACHE_SIZE */
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
@@ -26,11 +26,19 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
 
+#ifndef JERRY_VALUE_NAN_BOXING
 JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t),
                      size_of_ecma_string_t_must_be_less_than_or_equal_to_8_bytes);
 
 JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= sizeof (uint64_t),
                      size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_8_bytes);
+#else /* JERRY_VALUE_NAN_BOXING */
+JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == 2 * sizeof (uint64_t),
+                     size_of_ecma_string_t_must_be_less_than_or_equal_to_16_bytes);
+
+JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= 2 * sizeof (ecma_value_t),
+                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_16_bytes);
+#endif /* !JERRY_VALUE_NAN_BOXING */
 
 /** \addtogroup ecma ECMA
  * @{
@@ -83,12 +91,30 @@ JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <=
 
 DECLARE_ROUTINES_FOR (object)
 DECLARE_ROUTINES_FOR (number)
-DECLARE_ROUTINES_FOR (collection_header)
-DECLARE_ROUTINES_FOR (collection_chunk)
 DECLARE_ROUTINES_FOR (string)
 DECLARE_ROUTINES_FOR (getter_setter_pointers)
 DECLARE_ROUTINES_FOR (external_pointer)
 
+/**
+ * Allocate memory for header of a collection
+ *
+ * @return pointer to allocated memory
+ */
+inline ecma_collection_header_t * __attr_always_inline___
+ecma_alloc_collection_header (void)
+{
+  return jmem_heap_alloc_block (sizeof (ecma_collection_header_t));
+} /* ecma_alloc_collection_header */
+
+/**
+ * Dealloc memory from the collection's header
+ */
+inline void __attr_always_inline___
+ecma_dealloc_collection_header (ecma_collection_header_t *collection_header_p) /**< collection's header */
+{
+  jmem_heap_free_block (collection_header_p, sizeof (ecma_collection_header_t));
+} /* ecma_dealloc_collection_header */
+
 /**
  * Allocate memory for extended object
  *
@@ -61,18 +61,6 @@ extern ecma_collection_header_t *ecma_alloc_collection_header (void);
  */
 extern void ecma_dealloc_collection_header (ecma_collection_header_t *);
 
-/**
- * Allocate memory for non-first chunk of a collection
- *
- * @return pointer to allocated memory
- */
-extern ecma_collection_chunk_t *ecma_alloc_collection_chunk (void);
-
-/**
- * Dealloc memory from non-first chunk of a collection
- */
-extern void ecma_dealloc_collection_chunk (ecma_collection_chunk_t *);
-
 /**
  * Allocate memory for ecma-string descriptor
  *
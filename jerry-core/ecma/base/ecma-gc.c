@@ -20,6 +20,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
+#include "ecma-for-in.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
@@ -28,6 +29,7 @@
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
+#include "js-parser.h"
 #include "re-compiler.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
@@ -649,13 +651,34 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
   JERRY_CONTEXT (ecma_gc_objects_lists) [ECMA_GC_COLOR_BLACK] = NULL;
 
   JERRY_CONTEXT (ecma_gc_visited_flip_flag) = !JERRY_CONTEXT (ecma_gc_visited_flip_flag);
-
-#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc_run ();
-#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 } /* ecma_gc_run */
 
+/**
+ * Move the handler pointers of external function objects by the specified delta
+ *
+ * Note:
+ *      used when a heap image is restored into an executable,
+ *      which is loaded at a different address
+ */
+void
+ecma_gc_relocate_external_functions (uintptr_t delta) /**< difference between
+                                                       *   the new and old code addresses */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists) [ECMA_GC_COLOR_BLACK] == NULL);
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists) [ECMA_GC_COLOR_WHITE_GRAY];
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
+    if (!ecma_is_lexical_environment (obj_iter_p)
+        && ecma_get_object_type (obj_iter_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION)
+    {
+      ecma_extended_object_t *ext_func_obj_p = (ecma_extended_object_t *) obj_iter_p;
+      ext_func_obj_p->u.external_function += delta;
+    }
+  }
+} /* ecma_gc_relocate_external_functions */
+
 /**
  * Try to free some memory (depending on severity).
  */
@@ -680,7 +703,14 @@ ecma_free_unused_memory (jmem_free_unused_memory_severity_t severity) /**< sever
     JERRY_ASSERT (severity == JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH);
 
     /* Freeing as much memory as we currently can */
+    ecma_for_in_cache_invalidate ();
+    parser_code_cache_flush ();
     ecma_gc_run (severity);
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    /* Free RegExp bytecodes which are referenced only by the cache */
+    re_cache_gc_run ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   }
 } /* ecma_free_unused_memory */
 
@@ -30,6 +30,7 @@ extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
 extern void ecma_gc_run (jmem_free_unused_memory_severity_t);
+extern void ecma_gc_relocate_external_functions (uintptr_t);
 extern void ecma_free_unused_memory (jmem_free_unused_memory_severity_t);
 
 /**
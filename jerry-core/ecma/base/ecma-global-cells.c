@@ -0,0 +1,180 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-global-cells.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaglobalcells Global property cells
+ * @{
+ *
+ * Global variables are own properties of the global object. The cell
+ * table maps their names directly to the property, so accessing them
+ * skips the generic object property lookup. Since a property keeps its
+ * address until it is deleted, a cell only needs to be invalidated when
+ * the property is freed. Attribute changes (e.g. conversion to an accessor)
+ * are checked by the users of the cell.
+ */
+
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+
+/**
+ * Mask for hash bits
+ */
+#define ECMA_GLOBAL_CELLS_MASK (ECMA_GLOBAL_CELLS_COUNT - 1)
+
+/**
+ * Get the cell of a property name
+ *
+ * @return pointer to the cell
+ */
+static inline ecma_global_cell_t * __attr_always_inline___
+ecma_global_cells_get_cell (const ecma_string_t *prop_name_p) /**< property name */
+{
+  return JERRY_CONTEXT (ecma_global_cells) + (ecma_string_hash (prop_name_p) & ECMA_GLOBAL_CELLS_MASK);
+} /* ecma_global_cells_get_cell */
+
+/**
+ * Clear a non-empty cell
+ */
+static void
+ecma_global_cells_clear (ecma_global_cell_t *cell_p) /**< cell */
+{
+  JERRY_ASSERT (cell_p->prop_p != NULL);
+
+  ecma_set_property_global_cell (cell_p->prop_p, false);
+  ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, cell_p->prop_name_cp));
+
+  cell_p->prop_p = NULL;
+} /* ecma_global_cells_clear */
+
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+
+/**
+ * Initialize the global cell table
+ */
+void
+ecma_global_cells_init (void)
+{
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  memset (JERRY_CONTEXT (ecma_global_cells), 0, sizeof (JERRY_CONTEXT (ecma_global_cells)));
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+} /* ecma_global_cells_init */
+
+/**
+ * Find an own named property of the global object and register it in the cell table.
+ *
+ * Note:
+ *      the type and attributes of the returned property must be checked by the caller
+ *
+ * @return pointer to the property, if it is found,
+ *         NULL - otherwise.
+ */
+ecma_property_t *
+ecma_global_cells_lookup (ecma_object_t *global_obj_p, /**< global object */
+                          ecma_string_t *prop_name_p) /**< property name */
+{
+  JERRY_ASSERT (global_obj_p != NULL && !ecma_is_lexical_environment (global_obj_p));
+  JERRY_ASSERT (prop_name_p != NULL);
+
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  ecma_global_cell_t *cell_p = ecma_global_cells_get_cell (prop_name_p);
+
+  if (cell_p->prop_p != NULL)
+  {
+    ecma_string_t *cell_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, cell_p->prop_name_cp);
+
+    if (cell_name_p == prop_name_p
+        || ecma_compare_ecma_strings (cell_name_p, prop_name_p))
+    {
+      JERRY_ASSERT (ecma_is_property_global_cell (cell_p->prop_p));
+      return cell_p->prop_p;
+    }
+  }
+
+  ecma_property_t *property_p = ecma_find_named_property (global_obj_p, prop_name_p);
+
+  if (property_p == NULL)
+  {
+    return NULL;
+  }
+
+  /* Properties with the same name are stored in the same cell. */
+  JERRY_ASSERT (!ecma_is_property_global_cell (property_p));
+
+  if (cell_p->prop_p != NULL)
+  {
+    ecma_global_cells_clear (cell_p);
+  }
+
+  ecma_ref_ecma_string (prop_name_p);
+  ECMA_SET_NON_NULL_POINTER (cell_p->prop_name_cp, prop_name_p);
+  cell_p->prop_p = property_p;
+
+  ecma_set_property_global_cell (property_p, true);
+  return property_p;
+#else /* CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+  return ecma_find_named_property (global_obj_p, prop_name_p);
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+} /* ecma_global_cells_lookup */
+
+/**
+ * Invalidate the cell of a property which is being freed
+ */
+void
+ecma_global_cells_invalidate (ecma_string_t *prop_name_p, /**< property's name */
+                              ecma_property_t *prop_p) /**< property */
+{
+  JERRY_ASSERT (prop_name_p != NULL);
+  JERRY_ASSERT (prop_p != NULL && ecma_is_property_global_cell (prop_p));
+
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  ecma_global_cell_t *cell_p = ecma_global_cells_get_cell (prop_name_p);
+
+  /* The property must be present. */
+  JERRY_ASSERT (cell_p->prop_p == prop_p);
+
+  ecma_global_cells_clear (cell_p);
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+} /* ecma_global_cells_invalidate */
+
+/**
+ * Clear all cells of the table
+ */
+void
+ecma_global_cells_invalidate_all (void)
+{
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  for (uint32_t i = 0; i < ECMA_GLOBAL_CELLS_COUNT; i++)
+  {
+    ecma_global_cell_t *cell_p = JERRY_CONTEXT (ecma_global_cells) + i;
+
+    if (cell_p->prop_p != NULL)
+    {
+      ecma_global_cells_clear (cell_p);
+    }
+  }
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+} /* ecma_global_cells_invalidate_all */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,39 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_GLOBAL_CELLS_H
+#define ECMA_GLOBAL_CELLS_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaglobalcells Global property cells
+ * @{
+ */
+
+extern void ecma_global_cells_init (void);
+extern ecma_property_t *ecma_global_cells_lookup (ecma_object_t *, ecma_string_t *);
+extern void ecma_global_cells_invalidate (ecma_string_t *, ecma_property_t *);
+extern void ecma_global_cells_invalidate_all (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_GLOBAL_CELLS_H */
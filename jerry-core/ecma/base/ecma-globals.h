@@ -56,7 +56,9 @@
 typedef enum
 {
   ECMA_TYPE_DIRECT, /**< directly encoded value, a 28 bit signed integer or a simple value */
-  ECMA_TYPE_FLOAT, /**< pointer to a 64 or 32 bit floating point number */
+  ECMA_TYPE_FLOAT, /**< pointer to a 64 or 32 bit floating point number
+                    *   (NaN boxed values: floating point number stored in place,
+                    *   or boxed when the error flag is set) */
   ECMA_TYPE_STRING, /**< pointer to description of a string */
   ECMA_TYPE_OBJECT, /**< pointer to description of an object */
   ECMA_TYPE___MAX = ECMA_TYPE_OBJECT /** highest value for ecma types */
@@ -84,6 +86,8 @@ typedef enum
   ECMA_SIMPLE_VALUE__COUNT /** count of simple ecma values */
 } ecma_simple_value_t;
 
+#ifndef JERRY_VALUE_NAN_BOXING
+
 /**
  * Description of an ecma value
  *
@@ -91,19 +95,47 @@ typedef enum
  */
 typedef uint32_t ecma_value_t;
 
+#else /* JERRY_VALUE_NAN_BOXING */
+
+#if CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64
+#error "NaN boxing requires 64 bit floating point numbers"
+#endif /* CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT64 */
+
+/**
+ * Description of a NaN boxed ecma value
+ *
+ * Floating point numbers are stored directly as their IEEE 754 bit pattern.
+ * All NaNs are canonicalized, so the bit patterns of negative quiet NaNs with
+ * the upper 16 bits set are free, and they are used for encoding all other
+ * values: the lower 48 bits have the same layout as a 32 bit ecma value, except
+ * that pointers are stored uncompressed, and integers are sign extended.
+ * Floating point numbers with error flag are boxed the same way as in the
+ * 32 bit representation.
+ *
+ * Bit-field structure: nan boxing base (16) | value (45) | error (1) | type (2)
+ */
+typedef uint64_t ecma_value_t;
+
+/**
+ * Upper bits of all non floating point values
+ */
+#define ECMA_VALUE_NAN_BOXING_BASE ((ecma_value_t) 0xffff000000000000ull)
+
+#endif /* !JERRY_VALUE_NAN_BOXING */
+
 /**
  * Type for directly encoded integer numbers in JerryScript.
  */
 typedef int32_t ecma_integer_value_t;
 
-#if UINTPTR_MAX <= UINT32_MAX
+#if UINTPTR_MAX <= UINT32_MAX || defined (JERRY_VALUE_NAN_BOXING)
 
 /**
  * JMEM_ALIGNMENT_LOG aligned pointers can be stored directly in ecma_value_t
  */
 #define ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
 
-#endif /* UINTPTR_MAX <= UINT32_MAX */
+#endif /* UINTPTR_MAX <= UINT32_MAX || JERRY_VALUE_NAN_BOXING */
 
 /**
  * Mask for ecma types in ecma_type_t
@@ -181,12 +213,25 @@ typedef int32_t ecma_integer_value_t;
 #define ECMA_INTEGER_MULTIPLY_MAX 0x2d41
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
 
+#ifndef JERRY_VALUE_NAN_BOXING
+
 /**
  * Checks whether the error flag is set.
  */
 #define ECMA_IS_VALUE_ERROR(value) \
   (unlikely ((value & ECMA_VALUE_ERROR_FLAG) != 0))
 
+#else /* JERRY_VALUE_NAN_BOXING */
+
+/**
+ * Checks whether the error flag is set (floating point numbers have no error flag).
+ */
+#define ECMA_IS_VALUE_ERROR(value) \
+  (unlikely (((value) & (ECMA_VALUE_NAN_BOXING_BASE | ECMA_VALUE_ERROR_FLAG)) \
+             == (ECMA_VALUE_NAN_BOXING_BASE | ECMA_VALUE_ERROR_FLAG)))
+
+#endif /* !JERRY_VALUE_NAN_BOXING */
+
 /**
  * Representation for native external pointer
  */
@@ -286,6 +331,8 @@ typedef enum
   ECMA_PROPERTY_FLAG_ENUMERABLE = 1u << (ECMA_PROPERTY_FLAG_SHIFT + 1), /**< property is enumerable */
   ECMA_PROPERTY_FLAG_WRITABLE = 1u << (ECMA_PROPERTY_FLAG_SHIFT + 2), /**< property is writable */
   ECMA_PROPERTY_FLAG_LCACHED = 1u << (ECMA_PROPERTY_FLAG_SHIFT + 3), /**< property is lcached */
+  ECMA_PROPERTY_FLAG_GLOBAL_CELL = 1u << (ECMA_PROPERTY_FLAG_SHIFT + 4), /**< property is registered
+                                                                          *   in the global cell table */
 } ecma_property_flags_t;
 
 /**
@@ -851,30 +898,26 @@ typedef double ecma_number_t;
 
 /**
  * Description of a collection's header.
+ *
+ * The elements are stored in a contiguous buffer, whose capacity
+ * is doubled when it is full.
  */
 typedef struct
 {
   /** Number of elements in the collection */
   ecma_length_t unit_number;
 
-  /** Compressed pointer to first chunk with collection's data */
-  jmem_cpointer_t first_chunk_cp;
+  /** Number of elements the buffer can hold */
+  ecma_length_t capacity;
 
-  /** Compressed pointer to last chunk with collection's data */
-  jmem_cpointer_t last_chunk_cp;
+  /** Buffer of the elements (NULL if the capacity is zero) */
+  ecma_value_t *buffer_p;
 } ecma_collection_header_t;
 
 /**
- * Description of non-first chunk in a collection's chain of chunks
+ * Initial capacity of a collection's buffer
  */
-typedef struct
-{
-  /** Characters */
-  lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (jmem_cpointer_t) ];
-
-  /** Compressed pointer to next chunk */
-  jmem_cpointer_t next_chunk_cp;
-} ecma_collection_chunk_t;
+#define ECMA_COLLECTION_INITIAL_CAPACITY 4
 
 /**
  * Identifier for ecma-string's actual data container
@@ -885,6 +928,9 @@ typedef enum
                                            *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING, /**< actual data is on the heap as an utf-8 (cesu8) string
                                                 *   maximum size is 2^32. */
+  ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING, /**< actual data is an utf-8 (cesu8) string outside of the heap,
+                                               *   which outlives the string descriptor or is released
+                                               *   by a free callback */
   ECMA_STRING_CONTAINER_UINT32_IN_DESC, /**< actual data is UInt32-represeneted Number
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
@@ -956,6 +1002,7 @@ typedef struct
     } utf8_string;
 
     lit_utf8_size_t long_utf8_string_size; /**< size of this long utf-8 string in bytes */
+    lit_utf8_size_t external_utf8_string_size; /**< size of this external utf-8 string in bytes */
     uint32_t uint32_number; /**< uint32-represented number placed locally in the descriptor */
     lit_magic_string_id_t magic_string_id; /**< identifier of a magic string */
     lit_magic_string_ex_id_t magic_string_ex_id; /**< identifier of an external magic string */
@@ -973,6 +1020,55 @@ typedef struct
   lit_utf8_size_t long_utf8_string_length; /**< length of this long utf-8 string in bytes */
 } ecma_long_string_t;
 
+/**
+ * External ECMA string-value descriptor
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header */
+  lit_utf8_size_t external_utf8_string_length; /**< length of this external utf-8 string in characters */
+  const lit_utf8_byte_t *external_utf8_string_p; /**< characters of this external utf-8 string */
+  ecma_external_pointer_t free_cb; /**< callback which releases the characters when the string
+                                    *   is freed (0 - if the characters are not released) */
+} ecma_external_string_t;
+
+/**
+ * String builder: a growable heap buffer, which is turned into an ecma-string in place
+ *
+ * Note:
+ *      the first sizeof (ecma_long_string_t) bytes of the buffer are reserved
+ *      for the header of the resulting string
+ */
+typedef struct
+{
+  lit_utf8_byte_t *buffer_p; /**< heap buffer */
+  lit_utf8_size_t size; /**< used size of the buffer (including the reserved header) */
+  lit_utf8_size_t capacity; /**< allocated size of the buffer */
+} ecma_stringbuilder_t;
+
+/**
+ * Events reported by the streaming JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_STREAM_OBJECT_START, /**< start of an object */
+  ECMA_JSON_STREAM_OBJECT_END, /**< end of an object */
+  ECMA_JSON_STREAM_ARRAY_START, /**< start of an array */
+  ECMA_JSON_STREAM_ARRAY_END, /**< end of an array */
+  ECMA_JSON_STREAM_KEY, /**< property name of an object member */
+  ECMA_JSON_STREAM_VALUE /**< primitive value */
+} ecma_json_stream_event_t;
+
+/**
+ * Actions requested by the callback of the streaming JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_STREAM_CONTINUE, /**< continue parsing */
+  ECMA_JSON_STREAM_SKIP, /**< skip the object or array which is started, or the value of the key */
+  ECMA_JSON_STREAM_STOP /**< stop parsing */
+} ecma_json_stream_action_t;
+
 /**
  * Compiled byte code data.
  */
@@ -1045,6 +1141,87 @@ typedef struct
 
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+
+/**
+ * Entry of the global cell table
+ *
+ * A cell refers to an own named property of the global object,
+ * which remains at the same address until it is deleted.
+ */
+typedef struct
+{
+  /** Pointer to a property of the global object (NULL marks the cell empty) */
+  ecma_property_t *prop_p;
+
+  /** Compressed pointer to property's name (the cell holds a reference to it) */
+  jmem_cpointer_t prop_name_cp;
+} ecma_global_cell_t;
+
+/**
+ * Number of entries in the global cell table (must be a power of 2)
+ */
+#define ECMA_GLOBAL_CELLS_COUNT 64
+
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+
+/**
+ * Enumerable property names of an object, which are listed by a for-in statement
+ *
+ * The header is followed by:
+ *  - uint32_t indices[index_count]: array index names in ascending order
+ *  - jmem_cpointer_t names[name_count]: other names in creation order (referenced)
+ *  - jmem_cpointer_t layout[layout_length]: names of all named properties in the order
+ *    of the property list (referenced), used to find like objects in the for-in cache
+ */
+typedef struct
+{
+  uint16_t refs; /**< reference counter */
+  uint16_t layout_length; /**< number of layout entries (0 - the names are not cached) */
+  uint32_t layout_enumerable; /**< enumerable flags of the layout entries */
+  uint32_t index_count; /**< number of array index names */
+  uint32_t name_count; /**< number of other names */
+} ecma_for_in_names_t;
+
+/**
+ * Names of an already enumerated object of the prototype chain
+ */
+typedef struct ecma_for_in_level_t
+{
+  struct ecma_for_in_level_t *next_p; /**< previous level */
+  ecma_for_in_names_t *names_p; /**< names of the object */
+} ecma_for_in_level_t;
+
+/**
+ * State of a for-in statement
+ *
+ * Names of the prototype chain are listed one object at a time, when
+ * the names of the previous object are exhausted.
+ */
+typedef struct
+{
+  ecma_object_t *object_p; /**< enumerated object (kept alive by the caller) */
+  ecma_object_t *level_object_p; /**< current object of the prototype chain */
+  ecma_for_in_names_t *names_p; /**< names of the current object, NULL if there are no more */
+  ecma_for_in_level_t *visited_p; /**< names of the objects before the current one */
+  uint32_t position; /**< position of the next name in names_p */
+  ecma_value_t current_name; /**< name found by the last 'has next' query */
+} ecma_for_in_iterator_t;
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+
+/**
+ * Number of entries in the for-in cache (must be a power of 2)
+ */
+#define ECMA_FOR_IN_CACHE_SIZE 8
+
+/**
+ * Maximum number of named properties of objects, whose names are stored in the for-in cache
+ */
+#define ECMA_FOR_IN_CACHE_MAX_PROPERTIES 32
+
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
 /**
  * @}
  * @}
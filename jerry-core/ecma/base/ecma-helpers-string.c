@@ -24,6 +24,9 @@
 #include "lit-char-helpers.h"
 #include "lit-magic-strings.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -147,13 +150,15 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
 } /* ecma_string_to_array_index */
 
 /**
- * Allocate new ecma-string and fill it with characters from the utf8 string
+ * Find the descriptor of an utf8 string which is represented without character data
+ * (magic strings and array indices).
  *
- * @return pointer to ecma-string descriptor
+ * @return pointer to ecma-string descriptor - if the string has such a representation
+ *         NULL - otherwise
  */
-ecma_string_t *
-ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
-                                lit_utf8_size_t string_size) /**< string size */
+static ecma_string_t *
+ecma_find_special_string (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                          lit_utf8_size_t string_size) /**< string size */
 {
   JERRY_ASSERT (string_p != NULL || string_size == 0);
   JERRY_ASSERT (lit_is_cesu8_string_valid (string_p, string_size));
@@ -182,7 +187,25 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     return ecma_get_magic_string_ex (magic_string_ex_id);
   }
 
-  ecma_string_t *string_desc_p;
+  return NULL;
+} /* ecma_find_special_string */
+
+/**
+ * Allocate new ecma-string and fill it with characters from the utf8 string
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                lit_utf8_size_t string_size) /**< string size */
+{
+  ecma_string_t *string_desc_p = ecma_find_special_string (string_p, string_size);
+
+  if (string_desc_p != NULL)
+  {
+    return string_desc_p;
+  }
+
   lit_utf8_byte_t *data_p;
 
   if (likely (string_size <= UINT16_MAX))
@@ -215,6 +238,50 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   return string_desc_p;
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string which refers to the characters of an utf8 string
+ * without copying them. The characters must not change and must remain
+ * available until the string descriptor is freed.
+ *
+ * Note:
+ *      strings which have a representation without character data
+ *      (e.g. magic strings) are not stored as external strings. In
+ *      this case the free callback is called before the function returns.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_external_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                         lit_utf8_size_t string_size, /**< string size */
+                                         ecma_external_pointer_t free_cb) /**< callback which releases the
+                                                                           *   characters (0 - if there is none) */
+{
+  ecma_string_t *string_desc_p = ecma_find_special_string (string_p, string_size);
+
+  if (string_desc_p != NULL)
+  {
+    if (free_cb != 0)
+    {
+      jerry_dispatch_external_string_free_callback (free_cb, string_p, string_size);
+    }
+
+    return string_desc_p;
+  }
+
+  ecma_external_string_t *external_string_desc_p = jmem_heap_alloc_block (sizeof (ecma_external_string_t));
+  string_desc_p = &external_string_desc_p->header;
+
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+  string_desc_p->u.common_field = 0;
+  string_desc_p->u.external_utf8_string_size = string_size;
+
+  external_string_desc_p->external_utf8_string_length = lit_utf8_string_length (string_p, string_size);
+  external_string_desc_p->external_utf8_string_p = string_p;
+  external_string_desc_p->free_cb = free_cb;
+  return string_desc_p;
+} /* ecma_new_ecma_external_string_from_utf8 */
+
 /**
  * Allocate new ecma-string and fill it with cesu-8 character which represents specified code unit
  *
@@ -419,6 +486,15 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
       utf8_string1_length = long_string_desc_p->long_utf8_string_length;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_desc_p = (ecma_external_string_t *) string1_p;
+
+      utf8_string1_p = external_string_desc_p->external_utf8_string_p;
+      utf8_string1_size = string1_p->u.external_utf8_string_size;
+      utf8_string1_length = external_string_desc_p->external_utf8_string_length;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -465,6 +541,15 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
       utf8_string2_length = long_string_desc_p->long_utf8_string_length;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_desc_p = (ecma_external_string_t *) string2_p;
+
+      utf8_string2_p = external_string_desc_p->external_utf8_string_p;
+      utf8_string2_size = string2_p->u.external_utf8_string_size;
+      utf8_string2_length = external_string_desc_p->external_utf8_string_length;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -561,6 +646,204 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   return string_desc_p;
 } /* ecma_concat_ecma_strings */
 
+/**
+ * Initial capacity of a string builder buffer
+ */
+#define ECMA_STRINGBUILDER_INITIAL_CAPACITY 64
+
+/**
+ * Initialize a string builder with an empty buffer.
+ *
+ * Note:
+ *      the builder must be released by either ecma_stringbuilder_finalize or ecma_stringbuilder_destroy
+ */
+void
+ecma_stringbuilder_init (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  builder_p->buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (ECMA_STRINGBUILDER_INITIAL_CAPACITY);
+  builder_p->size = sizeof (ecma_long_string_t);
+  builder_p->capacity = ECMA_STRINGBUILDER_INITIAL_CAPACITY;
+} /* ecma_stringbuilder_init */
+
+/**
+ * Reserve space at the end of the string builder buffer.
+ *
+ * The buffer grows geometrically, so appending n bytes takes amortized O(n) time.
+ * When the heap is too full for the larger buffer, only the required space is allocated.
+ *
+ * @return pointer to the reserved area
+ */
+static lit_utf8_byte_t *
+ecma_stringbuilder_reserve (ecma_stringbuilder_t *builder_p, /**< string builder */
+                            lit_utf8_size_t data_size) /**< number of bytes to reserve */
+{
+  lit_utf8_size_t new_size = builder_p->size + data_size;
+
+  if (unlikely (new_size < data_size))
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  if (new_size > builder_p->capacity)
+  {
+    lit_utf8_size_t required_capacity = JERRY_ALIGNUP (new_size, JMEM_ALIGNMENT);
+
+    if (unlikely (required_capacity < new_size))
+    {
+      jerry_fatal (ERR_OUT_OF_MEMORY);
+    }
+
+    lit_utf8_size_t new_capacity = builder_p->capacity + (builder_p->capacity >> 1);
+    new_capacity = JERRY_ALIGNUP (new_capacity, JMEM_ALIGNMENT);
+
+    lit_utf8_byte_t *new_buffer_p = NULL;
+
+    if (new_capacity > required_capacity)
+    {
+      new_buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (new_capacity);
+    }
+
+    if (new_buffer_p == NULL)
+    {
+      new_capacity = required_capacity;
+      new_buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block (new_capacity);
+    }
+
+    memcpy (new_buffer_p, builder_p->buffer_p, builder_p->size);
+    jmem_heap_free_block (builder_p->buffer_p, builder_p->capacity);
+
+    builder_p->buffer_p = new_buffer_p;
+    builder_p->capacity = new_capacity;
+  }
+
+  lit_utf8_byte_t *dest_p = builder_p->buffer_p + builder_p->size;
+  builder_p->size = new_size;
+  return dest_p;
+} /* ecma_stringbuilder_reserve */
+
+/**
+ * Append the characters of an ecma-string to the string builder
+ */
+void
+ecma_stringbuilder_append (ecma_stringbuilder_t *builder_p, /**< string builder */
+                           const ecma_string_t *string_p) /**< ecma-string */
+{
+  lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+
+  if (string_size > 0)
+  {
+    lit_utf8_byte_t *dest_p = ecma_stringbuilder_reserve (builder_p, string_size);
+    ecma_string_to_utf8_bytes (string_p, dest_p, string_size);
+  }
+} /* ecma_stringbuilder_append */
+
+/**
+ * Append a magic string to the string builder
+ */
+void
+ecma_stringbuilder_append_magic (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                 lit_magic_string_id_t id) /**< magic string id */
+{
+  ecma_stringbuilder_append_raw (builder_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_stringbuilder_append_magic */
+
+/**
+ * Append a cesu-8 byte sequence to the string builder
+ *
+ * Note:
+ *      the sequence may end inside a character, but the
+ *      whole content must be valid when the builder is finalized
+ */
+void
+ecma_stringbuilder_append_raw (ecma_stringbuilder_t *builder_p, /**< string builder */
+                               const lit_utf8_byte_t *data_p, /**< cesu-8 bytes */
+                               lit_utf8_size_t data_size) /**< number of bytes */
+{
+  if (data_size > 0)
+  {
+    memcpy (ecma_stringbuilder_reserve (builder_p, data_size), data_p, data_size);
+  }
+} /* ecma_stringbuilder_append_raw */
+
+/**
+ * Append a single byte to the string builder
+ */
+void
+ecma_stringbuilder_append_byte (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                lit_utf8_byte_t byte) /**< byte */
+{
+  if (builder_p->size < builder_p->capacity)
+  {
+    builder_p->buffer_p[builder_p->size++] = byte;
+    return;
+  }
+
+  *ecma_stringbuilder_reserve (builder_p, 1) = byte;
+} /* ecma_stringbuilder_append_byte */
+
+/**
+ * Turn the content of the string builder into an ecma-string. The buffer
+ * becomes the string descriptor (its unused tail is released), so the
+ * characters are not copied into a new block.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_stringbuilder_finalize (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  lit_utf8_byte_t *buffer_p = builder_p->buffer_p;
+  lit_utf8_byte_t *string_p = buffer_p + sizeof (ecma_long_string_t);
+  lit_utf8_size_t string_size = builder_p->size - (lit_utf8_size_t) sizeof (ecma_long_string_t);
+
+  builder_p->buffer_p = NULL;
+
+  ecma_string_t *string_desc_p = ecma_find_special_string (string_p, string_size);
+
+  if (string_desc_p != NULL)
+  {
+    jmem_heap_free_block (buffer_p, builder_p->capacity);
+    return string_desc_p;
+  }
+
+  string_desc_p = (ecma_string_t *) buffer_p;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+  string_desc_p->u.common_field = 0;
+
+  if (likely (string_size <= UINT16_MAX))
+  {
+    string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_UTF8_STRING | ECMA_STRING_REF_ONE;
+    string_desc_p->u.utf8_string.size = (uint16_t) string_size;
+    string_desc_p->u.utf8_string.length = (uint16_t) lit_utf8_string_length (string_p, string_size);
+
+    memmove (string_desc_p + 1, string_p, string_size);
+    jmem_heap_shrink_block (buffer_p, builder_p->capacity, sizeof (ecma_string_t) + string_size);
+  }
+  else
+  {
+    ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) buffer_p;
+
+    string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING | ECMA_STRING_REF_ONE;
+    string_desc_p->u.long_utf8_string_size = string_size;
+    long_string_desc_p->long_utf8_string_length = lit_utf8_string_length (string_p, string_size);
+
+    jmem_heap_shrink_block (buffer_p, builder_p->capacity, builder_p->size);
+  }
+
+  return string_desc_p;
+} /* ecma_stringbuilder_finalize */
+
+/**
+ * Release the buffer of the string builder without creating a string
+ */
+void
+ecma_stringbuilder_destroy (ecma_stringbuilder_t *builder_p) /**< string builder */
+{
+  JERRY_ASSERT (builder_p->buffer_p != NULL);
+
+  jmem_heap_free_block (builder_p->buffer_p, builder_p->capacity);
+  builder_p->buffer_p = NULL;
+} /* ecma_stringbuilder_destroy */
+
 /**
  * Increase reference counter of ecma-string.
  */
@@ -626,6 +909,21 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       jmem_heap_free_block (string_p, string_p->u.long_utf8_string_size + sizeof (ecma_long_string_t));
       return;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_desc_p = (ecma_external_string_t *) string_p;
+      ecma_external_pointer_t free_cb = external_string_desc_p->free_cb;
+      const lit_utf8_byte_t *chars_p = external_string_desc_p->external_utf8_string_p;
+      lit_utf8_size_t size = string_p->u.external_utf8_string_size;
+
+      jmem_heap_free_block (string_p, sizeof (ecma_external_string_t));
+
+      if (free_cb != 0)
+      {
+        jerry_dispatch_external_string_free_callback (free_cb, chars_p, size);
+      }
+      return;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
@@ -665,6 +963,7 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
 
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
     {
@@ -747,6 +1046,12 @@ ecma_string_copy_to_utf8_buffer (const ecma_string_t *string_desc_p, /**< ecma-s
       memcpy (buffer_p, ((ecma_long_string_t *) string_desc_p) + 1, size);
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      size = string_desc_p->u.external_utf8_string_size;
+      memcpy (buffer_p, ((ecma_external_string_t *) string_desc_p)->external_utf8_string_p, size);
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       const uint32_t uint32_number = string_desc_p->u.uint32_number;
@@ -870,6 +1175,14 @@ ecma_string_raw_chars (const ecma_string_t *string_p, /**< ecma-string */
       result_p = (const lit_utf8_byte_t *) (long_string_p + 1);
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      size = string_p->u.external_utf8_string_size;
+      ecma_external_string_t *external_string_p = (ecma_external_string_t *) string_p;
+      length = external_string_p->external_utf8_string_length;
+      result_p = external_string_p->external_utf8_string_p;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       size = (lit_utf8_size_t) ecma_string_get_number_in_desc_size (string_p->u.uint32_number);
@@ -968,7 +1281,8 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 {
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) != ECMA_STRING_GET_CONTAINER (string2_p)
                 || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING
-                || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING);
+                || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+                || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING);
 
   const lit_utf8_byte_t *utf8_string1_p, *utf8_string2_p;
   lit_utf8_size_t utf8_string1_size, utf8_string2_size;
@@ -987,6 +1301,12 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       utf8_string1_size = string1_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      utf8_string1_p = ((ecma_external_string_t *) string1_p)->external_utf8_string_p;
+      utf8_string1_size = string1_p->u.external_utf8_string_size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       return false;
@@ -1021,6 +1341,12 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       utf8_string2_size = string2_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      utf8_string2_p = ((ecma_external_string_t *) string2_p)->external_utf8_string_p;
+      utf8_string2_size = string2_p->u.external_utf8_string_size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       return false;
@@ -1074,7 +1400,7 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /* ecma-string */
 
   ecma_string_container_t string1_container = ECMA_STRING_GET_CONTAINER (string1_p);
 
-  if (string1_container > ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+  if (string1_container > ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING
       && string1_container == ECMA_STRING_GET_CONTAINER (string2_p))
   {
     return string1_p->u.common_field == string2_p->u.common_field;
@@ -1123,6 +1449,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
       utf8_string1_size = string1_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      utf8_string1_p = ((ecma_external_string_t *) string1_p)->external_utf8_string_p;
+      utf8_string1_size = string1_p->u.external_utf8_string_size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -1161,6 +1493,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
       utf8_string2_size = string2_p->u.long_utf8_string_size;
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      utf8_string2_p = ((ecma_external_string_t *) string2_p)->external_utf8_string_p;
+      utf8_string2_size = string2_p->u.external_utf8_string_size;
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       utf8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -1209,6 +1547,10 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (ecma_length_t) (((ecma_long_string_t *) string_p)->long_utf8_string_length);
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      return (ecma_length_t) (((ecma_external_string_t *) string_p)->external_utf8_string_length);
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       return ecma_string_get_number_in_desc_size (string_p->u.uint32_number);
@@ -1248,6 +1590,10 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (lit_utf8_size_t) string_p->u.long_utf8_string_size;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      return (lit_utf8_size_t) string_p->u.external_utf8_string_size;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       return (lit_utf8_size_t) ecma_string_get_number_in_desc_size (string_p->u.uint32_number);
@@ -1494,13 +1840,35 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
   JERRY_UNREACHABLE ();
 } /* ecma_string_substr */
 
+/**
+ * Check whether an ASCII byte is a white space or line terminator character.
+ *
+ * Note:
+ *      the ASCII members of both sets are exactly the space and the 0x09 - 0x0D range.
+ *
+ * @return true - if the byte is removed by trim,
+ *         false - otherwise.
+ */
+static inline bool __attr_always_inline___
+ecma_string_is_ascii_trim_byte (lit_utf8_byte_t byte) /**< ASCII byte */
+{
+  JERRY_ASSERT (byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX);
+
+  return (byte == LIT_CHAR_SP || (byte >= LIT_CHAR_TAB && byte <= LIT_CHAR_CR));
+} /* ecma_string_is_ascii_trim_byte */
+
 /**
  * Trim leading and trailing whitespace characters from string.
  *
+ * Note:
+ *      ASCII bytes are classified directly, only the other code units
+ *      are checked against the unicode tables.
+ *
  * @return trimmed ecma string
+ *         (the input string with an increased reference counter, if there is nothing to trim)
  */
 ecma_string_t *
-ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string */
+ecma_string_trim (ecma_string_t *string_p) /**< pointer to an ecma string */
 {
   ecma_string_t *ret_string_p;
 
@@ -1516,6 +1884,18 @@ ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string
     /* Trim front. */
     while (current_p < nonws_start_p)
     {
+      if (*current_p <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        if (!ecma_string_is_ascii_trim_byte (*current_p))
+        {
+          nonws_start_p = current_p;
+          break;
+        }
+
+        current_p++;
+        continue;
+      }
+
       read_size = lit_read_code_unit_from_utf8 (current_p, &ch);
 
       if (!lit_char_is_white_space (ch)
@@ -1531,8 +1911,19 @@ ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string
     current_p = utf8_str_p + utf8_str_size;
 
     /* Trim back. */
-    while (current_p > utf8_str_p)
+    while (current_p > nonws_start_p)
     {
+      if (current_p[-1] <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        if (!ecma_string_is_ascii_trim_byte (current_p[-1]))
+        {
+          break;
+        }
+
+        current_p--;
+        continue;
+      }
+
       read_size = lit_read_prev_code_unit_from_utf8 (current_p, &ch);
 
       if (!lit_char_is_white_space (ch)
@@ -1545,7 +1936,13 @@ ecma_string_trim (const ecma_string_t *string_p) /**< pointer to an ecma string
     }
 
     /* Construct new string. */
-    if (current_p > nonws_start_p)
+    if (nonws_start_p == utf8_str_p
+        && current_p == utf8_str_p + utf8_str_size)
+    {
+      ecma_ref_ecma_string (string_p);
+      ret_string_p = string_p;
+    }
+    else if (current_p > nonws_start_p)
     {
       ret_string_p = ecma_new_ecma_string_from_utf8 (nonws_start_p,
                                                      (lit_utf8_size_t) (current_p - nonws_start_p));
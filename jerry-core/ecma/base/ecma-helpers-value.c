@@ -51,6 +51,18 @@ JERRY_STATIC_ASSERT (sizeof (jmem_cpointer_t) <= sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) <= sizeof (ecma_value_t),
                      uintptr_t_must_fit_in_ecma_value_t);
 
+#ifdef JERRY_VALUE_NAN_BOXING
+
+JERRY_STATIC_ASSERT (sizeof (ecma_number_t) == sizeof (ecma_value_t),
+                     ecma_number_t_must_have_the_same_size_as_ecma_value_t);
+
+/**
+ * Bit pattern of the canonical (positive quiet) NaN
+ */
+#define ECMA_VALUE_NAN_BOXING_CANONICAL_NAN ((ecma_value_t) 0x7ff8000000000000ull)
+
+#endif /* JERRY_VALUE_NAN_BOXING */
+
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (ecma_value_t),
@@ -70,9 +82,34 @@ JERRY_STATIC_ASSERT ((ECMA_SIMPLE_VALUE_FALSE | 0x1) == ECMA_SIMPLE_VALUE_TRUE
 static inline ecma_type_t __attr_pure___ __attr_always_inline___
 ecma_get_value_type_field (ecma_value_t value) /**< ecma value */
 {
-  return value & ECMA_VALUE_TYPE_MASK;
+#ifdef JERRY_VALUE_NAN_BOXING
+  if (value < ECMA_VALUE_NAN_BOXING_BASE)
+  {
+    return ECMA_TYPE_FLOAT;
+  }
+#endif /* JERRY_VALUE_NAN_BOXING */
+
+  return (ecma_type_t) (value & ECMA_VALUE_TYPE_MASK);
 } /* ecma_get_value_type_field */
 
+#ifdef JERRY_VALUE_NAN_BOXING
+
+/**
+ * Check whether the value is a direct value or a floating point number
+ * stored in place, i.e. it does not reference any memory.
+ *
+ * @return true - if the value does not reference any memory,
+ *         false - otherwise.
+ */
+static inline bool __attr_pure___ __attr_always_inline___
+ecma_is_value_direct_or_float (ecma_value_t value) /**< ecma value */
+{
+  return (value < ECMA_VALUE_NAN_BOXING_BASE
+          || (value & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_DIRECT);
+} /* ecma_is_value_direct_or_float */
+
+#endif /* JERRY_VALUE_NAN_BOXING */
+
 /**
  * Convert a pointer into an ecma value.
  *
@@ -85,7 +122,13 @@ ecma_pointer_to_ecma_value (const void *ptr) /**< pointer */
 
   uintptr_t uint_ptr = (uintptr_t) ptr;
   JERRY_ASSERT ((uint_ptr & ECMA_VALUE_FULL_MASK) == 0);
+
+#ifdef JERRY_VALUE_NAN_BOXING
+  JERRY_ASSERT ((((ecma_value_t) uint_ptr) & ECMA_VALUE_NAN_BOXING_BASE) == 0);
+  return ((ecma_value_t) uint_ptr) | ECMA_VALUE_NAN_BOXING_BASE;
+#else /* !JERRY_VALUE_NAN_BOXING */
   return (ecma_value_t) uint_ptr;
+#endif /* JERRY_VALUE_NAN_BOXING */
 
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
@@ -104,7 +147,9 @@ ecma_pointer_to_ecma_value (const void *ptr) /**< pointer */
 static inline void * __attr_pure___ __attr_always_inline___
 ecma_get_pointer_from_ecma_value (ecma_value_t value) /**< value */
 {
-#ifdef ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
+#if defined (JERRY_VALUE_NAN_BOXING)
+  return (void *) (uintptr_t) ((value) & ~(ECMA_VALUE_NAN_BOXING_BASE | ECMA_VALUE_FULL_MASK));
+#elif defined (ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY)
   return (void *) (uintptr_t) ((value) & ~ECMA_VALUE_FULL_MASK);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
   return ECMA_GET_NON_NULL_POINTER (ecma_number_t,
@@ -133,7 +178,12 @@ ecma_is_value_direct (ecma_value_t value) /**< ecma value */
 inline bool __attr_pure___ __attr_always_inline___
 ecma_is_value_simple (ecma_value_t value) /**< ecma value */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  return ((value & (ECMA_VALUE_NAN_BOXING_BASE | ECMA_DIRECT_TYPE_MASK))
+          == (ECMA_VALUE_NAN_BOXING_BASE | ECMA_DIRECT_TYPE_SIMPLE_VALUE));
+#else /* !JERRY_VALUE_NAN_BOXING */
   return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_is_value_simple */
 
 /**
@@ -254,7 +304,12 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
 inline bool __attr_pure___ __attr_always_inline___
 ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  return ((value & (ECMA_VALUE_NAN_BOXING_BASE | ECMA_DIRECT_TYPE_MASK))
+          == (ECMA_VALUE_NAN_BOXING_BASE | ECMA_DIRECT_TYPE_INTEGER_VALUE));
+#else /* !JERRY_VALUE_NAN_BOXING */
   return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_is_value_integer_number */
 
 /**
@@ -270,7 +325,12 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
   JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
                        ecma_direct_type_integer_value_must_be_zero);
 
+#ifdef JERRY_VALUE_NAN_BOXING
+  return (((first_value & second_value) & ECMA_VALUE_NAN_BOXING_BASE) == ECMA_VALUE_NAN_BOXING_BASE
+          && ((first_value | second_value) & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE);
+#else /* !JERRY_VALUE_NAN_BOXING */
   return ((first_value | second_value) & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_are_values_integer_numbers */
 
 /**
@@ -343,7 +403,13 @@ ecma_check_value_type_is_spec_defined (ecma_value_t value) /**< ecma value */
 inline ecma_value_t __attr_const___ __attr_always_inline___
 ecma_make_simple_value (const ecma_simple_value_t simple_value) /**< simple value */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  return ((((ecma_value_t) (simple_value)) << ECMA_DIRECT_SHIFT)
+          | ECMA_VALUE_NAN_BOXING_BASE
+          | ECMA_DIRECT_TYPE_SIMPLE_VALUE);
+#else /* !JERRY_VALUE_NAN_BOXING */
   return (((ecma_value_t) (simple_value)) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_make_simple_value */
 
 /**
@@ -371,7 +437,13 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 {
   JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
 
+#ifdef JERRY_VALUE_NAN_BOXING
+  return ((ecma_value_t) (int64_t) (integer_value << ECMA_DIRECT_SHIFT)
+          | ECMA_VALUE_NAN_BOXING_BASE
+          | ECMA_DIRECT_TYPE_INTEGER_VALUE);
+#else /* !JERRY_VALUE_NAN_BOXING */
   return ((ecma_value_t) (integer_value << ECMA_DIRECT_SHIFT)) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_make_integer_value */
 
 /**
@@ -382,11 +454,31 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 static ecma_value_t __attr_const___
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  union
+  {
+    ecma_value_t value;
+    ecma_number_t float_value;
+  } u;
+
+  if (ecma_number_is_nan (ecma_number))
+  {
+    /* NaNs with any sign and payload must be canonicalized. */
+    u.value = ECMA_VALUE_NAN_BOXING_CANONICAL_NAN;
+    return u.value;
+  }
+
+  u.float_value = ecma_number;
+
+  JERRY_ASSERT (u.value < ECMA_VALUE_NAN_BOXING_BASE);
+  return u.value;
+#else /* !JERRY_VALUE_NAN_BOXING */
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
 
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_create_float_number */
 
 /**
@@ -507,13 +599,28 @@ ecma_make_object_value (const ecma_object_t *object_p) /**< object to reference
 
 /**
  * Error value constructor
+ *
+ * Note:
+ *   the original value is taken over by the error value
  */
-ecma_value_t __attr_const___
+ecma_value_t
 ecma_make_error_value (ecma_value_t value) /**< original ecma value */
 {
   /* Error values cannot be converted. */
   JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (value));
 
+#ifdef JERRY_VALUE_NAN_BOXING
+  if (value < ECMA_VALUE_NAN_BOXING_BASE)
+  {
+    /* Floating point numbers stored in place have no space for the error flag, so they are boxed. */
+    ecma_number_t *ecma_num_p = ecma_alloc_number ();
+
+    *ecma_num_p = ecma_get_float_from_value (value);
+
+    return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT | ECMA_VALUE_ERROR_FLAG;
+  }
+#endif /* JERRY_VALUE_NAN_BOXING */
+
   return value | ECMA_VALUE_ERROR_FLAG;
 } /* ecma_make_error_value */
 
@@ -523,7 +630,7 @@ ecma_make_error_value (ecma_value_t value) /**< original ecma value */
 ecma_value_t __attr_const___
 ecma_make_error_obj_value (const ecma_object_t *object_p) /**< object to reference in value */
 {
-  return ecma_make_error_value (ecma_make_object_value (object_p));
+  return ecma_make_object_value (object_p) | ECMA_VALUE_ERROR_FLAG;
 } /* ecma_make_error_obj_value */
 
 /**
@@ -542,7 +649,21 @@ ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
 inline ecma_number_t __attr_pure___ __attr_always_inline___
 ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
-  JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
+  JERRY_ASSERT (ecma_is_value_float_number (value));
+
+#ifdef JERRY_VALUE_NAN_BOXING
+  if (value < ECMA_VALUE_NAN_BOXING_BASE)
+  {
+    union
+    {
+      ecma_value_t value;
+      ecma_number_t float_value;
+    } u;
+
+    u.value = value;
+    return u.float_value;
+  }
+#endif /* JERRY_VALUE_NAN_BOXING */
 
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_float_from_value */
@@ -577,9 +698,7 @@ ecma_get_uint32_from_value (ecma_value_t value) /**< ecma value */
     return (uint32_t) (((ecma_integer_value_t) value) >> ECMA_DIRECT_SHIFT);
   }
 
-  JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
-
-  return ecma_number_to_uint32 (*(ecma_number_t *) ecma_get_pointer_from_ecma_value (value));
+  return ecma_number_to_uint32 (ecma_get_float_from_value (value));
 } /* ecma_get_uint32_from_value */
 
 /**
@@ -631,7 +750,7 @@ ecma_get_value_from_error_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ECMA_IS_VALUE_ERROR (value));
 
-  value = (ecma_value_t) (value & ~ECMA_VALUE_ERROR_FLAG);
+  value = (ecma_value_t) (value & ~((ecma_value_t) ECMA_VALUE_ERROR_FLAG));
 
   JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (value));
 
@@ -654,6 +773,13 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     }
     case ECMA_TYPE_FLOAT:
     {
+#ifdef JERRY_VALUE_NAN_BOXING
+      if (value < ECMA_VALUE_NAN_BOXING_BASE)
+      {
+        return value;
+      }
+#endif /* JERRY_VALUE_NAN_BOXING */
+
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 
       return ecma_create_float_number (*num_p);
@@ -687,7 +813,11 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
 inline ecma_value_t __attr_always_inline___
 ecma_fast_copy_value (ecma_value_t value)  /**< value description */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  return (ecma_is_value_direct_or_float (value)) ? value : ecma_copy_value (value);
+#else /* !JERRY_VALUE_NAN_BOXING */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT) ? value : ecma_copy_value (value);
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_fast_copy_value */
 
 /**
@@ -724,6 +854,10 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
     return;
   }
 
+#ifdef JERRY_VALUE_NAN_BOXING
+  ecma_free_value_if_not_object (*value_p);
+  *value_p = ecma_copy_value_if_not_object (ecma_value);
+#else /* !JERRY_VALUE_NAN_BOXING */
   if (ecma_get_value_type_field (ecma_value || *value_p) == ECMA_TYPE_DIRECT)
   {
     *value_p = ecma_value;
@@ -741,6 +875,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
     ecma_free_value_if_not_object (*value_p);
     *value_p = ecma_copy_value_if_not_object (ecma_value);
   }
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_value_assign_value */
 
 /**
@@ -757,6 +892,10 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 {
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
+#ifdef JERRY_VALUE_NAN_BOXING
+  ecma_fast_free_value (float_value);
+  return ecma_make_number_value (new_number);
+#else /* !JERRY_VALUE_NAN_BOXING */
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
   ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
@@ -770,6 +909,7 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 
   *number_p = new_number;
   return float_value;
+#endif /* JERRY_VALUE_NAN_BOXING */
 } /* ecma_update_float_number */
 
 /**
@@ -782,6 +922,7 @@ static void
 ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value */
                                 ecma_number_t ecma_number) /**< number to assign */
 {
+#ifndef JERRY_VALUE_NAN_BOXING
   if (ecma_is_value_float_number (*value_p))
   {
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
@@ -789,6 +930,7 @@ ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value
     *num_dst_p = ecma_number;
     return;
   }
+#endif /* !JERRY_VALUE_NAN_BOXING */
 
   if (ecma_get_value_type_field (*value_p) != ECMA_TYPE_DIRECT
       && ecma_get_value_type_field (*value_p) != ECMA_TYPE_OBJECT)
@@ -868,6 +1010,14 @@ ecma_free_value (ecma_value_t value) /**< value description */
 
     case ECMA_TYPE_FLOAT:
     {
+#ifdef JERRY_VALUE_NAN_BOXING
+      if (value < ECMA_VALUE_NAN_BOXING_BASE)
+      {
+        /* no memory is allocated */
+        break;
+      }
+#endif /* JERRY_VALUE_NAN_BOXING */
+
       ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
       break;
@@ -900,7 +1050,11 @@ ecma_free_value (ecma_value_t value) /**< value description */
 inline void __attr_always_inline___
 ecma_fast_free_value (ecma_value_t value) /**< value description */
 {
+#ifdef JERRY_VALUE_NAN_BOXING
+  if (!ecma_is_value_direct_or_float (value))
+#else /* !JERRY_VALUE_NAN_BOXING */
   if (ecma_get_value_type_field (value) != ECMA_TYPE_DIRECT)
+#endif /* JERRY_VALUE_NAN_BOXING */
   {
     ecma_free_value (value);
   }
@@ -17,6 +17,7 @@
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jmem-heap.h"
 #include "jrt.h"
 
 /** \addtogroup ecma ECMA
@@ -26,6 +27,17 @@
  * @{
  */
 
+/**
+ * Get the size of a collection's buffer
+ *
+ * @return size in bytes
+ */
+static inline size_t __attr_always_inline___
+ecma_collection_get_buffer_size (ecma_length_t capacity) /**< number of elements */
+{
+  return capacity * sizeof (ecma_value_t);
+} /* ecma_collection_get_buffer_size */
+
 /**
  * Allocate a collection of ecma values.
  *
@@ -39,48 +51,34 @@ ecma_new_values_collection (const ecma_value_t values_buffer[], /**< ecma values
 {
   JERRY_ASSERT (values_buffer != NULL || values_number == 0);
 
-  const size_t values_in_chunk = JERRY_SIZE_OF_STRUCT_MEMBER (ecma_collection_chunk_t, data) / sizeof (ecma_value_t);
-
   ecma_collection_header_t *header_p = ecma_alloc_collection_header ();
 
   header_p->unit_number = values_number;
+  header_p->capacity = values_number;
+  header_p->buffer_p = NULL;
+
+  if (values_number == 0)
+  {
+    return header_p;
+  }
 
-  jmem_cpointer_t *next_chunk_cp_p = &header_p->first_chunk_cp;
-  ecma_collection_chunk_t *last_chunk_p = NULL;
-  ecma_value_t *cur_value_buf_iter_p = NULL;
-  ecma_value_t *cur_value_buf_end_p = NULL;
+  ecma_value_t *buffer_p = (ecma_value_t *) jmem_heap_alloc_block (ecma_collection_get_buffer_size (values_number));
 
   for (ecma_length_t value_index = 0;
        value_index < values_number;
        value_index++)
   {
-    if (cur_value_buf_iter_p == cur_value_buf_end_p)
-    {
-      ecma_collection_chunk_t *chunk_p = ecma_alloc_collection_chunk ();
-      ECMA_SET_POINTER (*next_chunk_cp_p, chunk_p);
-      next_chunk_cp_p = &chunk_p->next_chunk_cp;
-
-      cur_value_buf_iter_p = (ecma_value_t *) chunk_p->data;
-      cur_value_buf_end_p = cur_value_buf_iter_p + values_in_chunk;
-
-      last_chunk_p = chunk_p;
-    }
-
-    JERRY_ASSERT (cur_value_buf_iter_p + 1 <= cur_value_buf_end_p);
-
     if (do_ref_if_object)
     {
-      *cur_value_buf_iter_p++ = ecma_copy_value (values_buffer[value_index]);
+      buffer_p[value_index] = ecma_copy_value (values_buffer[value_index]);
     }
     else
     {
-      *cur_value_buf_iter_p++ = ecma_copy_value_if_not_object (values_buffer[value_index]);
+      buffer_p[value_index] = ecma_copy_value_if_not_object (values_buffer[value_index]);
     }
   }
 
-  *next_chunk_cp_p = ECMA_NULL_POINTER;
-  ECMA_SET_POINTER (header_p->last_chunk_cp, last_chunk_p);
-
+  header_p->buffer_p = buffer_p;
   return header_p;
 } /* ecma_new_values_collection */
 
@@ -94,41 +92,25 @@ ecma_free_values_collection (ecma_collection_header_t *header_p, /**< collection
 {
   JERRY_ASSERT (header_p != NULL);
 
-  const size_t values_in_chunk = JERRY_SIZE_OF_STRUCT_MEMBER (ecma_collection_chunk_t, data) / sizeof (ecma_value_t);
+  ecma_value_t *buffer_p = header_p->buffer_p;
 
-  ecma_collection_chunk_t *chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                                       header_p->first_chunk_cp);
-  ecma_length_t value_index = 0;
-
-  while (chunk_p != NULL)
+  for (ecma_length_t value_index = 0;
+       value_index < header_p->unit_number;
+       value_index++)
   {
-    JERRY_ASSERT (value_index < header_p->unit_number);
-
-    ecma_value_t *cur_value_buf_iter_p = (ecma_value_t *) chunk_p->data;
-    ecma_value_t *cur_value_buf_end_p = cur_value_buf_iter_p + values_in_chunk;
-
-    while (cur_value_buf_iter_p != cur_value_buf_end_p
-           && value_index < header_p->unit_number)
+    if (do_deref_if_object)
     {
-      JERRY_ASSERT (cur_value_buf_iter_p < cur_value_buf_end_p);
-
-      if (do_deref_if_object)
-      {
-        ecma_free_value (*cur_value_buf_iter_p);
-      }
-      else
-      {
-        ecma_free_value_if_not_object (*cur_value_buf_iter_p);
-      }
-
-      cur_value_buf_iter_p++;
-      value_index++;
+      ecma_free_value (buffer_p[value_index]);
     }
+    else
+    {
+      ecma_free_value_if_not_object (buffer_p[value_index]);
+    }
+  }
 
-    ecma_collection_chunk_t *next_chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                                              chunk_p->next_chunk_cp);
-    ecma_dealloc_collection_chunk (chunk_p);
-    chunk_p = next_chunk_p;
+  if (buffer_p != NULL)
+  {
+    jmem_heap_free_block (buffer_p, ecma_collection_get_buffer_size (header_p->capacity));
   }
 
   ecma_dealloc_collection_header (header_p);
@@ -136,6 +118,9 @@ ecma_free_values_collection (ecma_collection_header_t *header_p, /**< collection
 
 /**
  * Append new value to ecma values collection
+ *
+ * Note:
+ *      the buffer of the collection might be reallocated
  */
 void
 ecma_append_to_values_collection (ecma_collection_header_t *header_p, /**< collection's header */
@@ -143,129 +128,58 @@ ecma_append_to_values_collection (ecma_collection_header_t *header_p, /**< colle
                                   bool do_ref_if_object) /**< if the value is object value,
                                                               increase reference counter of the object */
 {
-  const size_t values_in_chunk = JERRY_SIZE_OF_STRUCT_MEMBER (ecma_collection_chunk_t, data) / sizeof (ecma_value_t);
-
-  size_t values_number = header_p->unit_number;
-  size_t pos_of_new_value_in_chunk = values_number % values_in_chunk;
-
-  values_number++;
-
-  if ((ecma_length_t) values_number == values_number)
-  {
-    header_p->unit_number = (ecma_length_t) values_number;
-  }
-  else
-  {
-    jerry_fatal (ERR_OUT_OF_MEMORY);
-  }
-
-  ecma_collection_chunk_t *chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                                       header_p->last_chunk_cp);
+  JERRY_ASSERT (header_p->unit_number <= header_p->capacity);
 
-  if (pos_of_new_value_in_chunk == 0)
+  if (header_p->unit_number == header_p->capacity)
   {
-    /* all chunks are currently filled with values */
+    /* the buffer is full */
+    ecma_length_t new_capacity = ECMA_COLLECTION_INITIAL_CAPACITY;
 
-    chunk_p = ecma_alloc_collection_chunk ();
-    chunk_p->next_chunk_cp = ECMA_NULL_POINTER;
-
-    if (header_p->last_chunk_cp == ECMA_NULL_POINTER)
+    if (header_p->capacity > 0)
     {
-      JERRY_ASSERT (header_p->first_chunk_cp == ECMA_NULL_POINTER);
+      if (header_p->capacity > UINT32_MAX / (2 * sizeof (ecma_value_t)))
+      {
+        jerry_fatal (ERR_OUT_OF_MEMORY);
+      }
 
-      ECMA_SET_NON_NULL_POINTER (header_p->first_chunk_cp, chunk_p);
+      new_capacity = header_p->capacity * 2;
     }
-    else
-    {
-      ecma_collection_chunk_t *last_chunk_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                         header_p->last_chunk_cp);
 
-      JERRY_ASSERT (last_chunk_p->next_chunk_cp == ECMA_NULL_POINTER);
+    size_t new_buffer_size = ecma_collection_get_buffer_size (new_capacity);
+    ecma_value_t *new_buffer_p = (ecma_value_t *) jmem_heap_alloc_block (new_buffer_size);
 
-      ECMA_SET_NON_NULL_POINTER (last_chunk_p->next_chunk_cp, chunk_p);
+    if (header_p->buffer_p != NULL)
+    {
+      memcpy (new_buffer_p, header_p->buffer_p, ecma_collection_get_buffer_size (header_p->unit_number));
+      jmem_heap_free_block (header_p->buffer_p, ecma_collection_get_buffer_size (header_p->capacity));
     }
 
-    ECMA_SET_NON_NULL_POINTER (header_p->last_chunk_cp, chunk_p);
+    header_p->buffer_p = new_buffer_p;
+    header_p->capacity = new_capacity;
   }
-  else
-  {
-    /* last chunk can be appended with the new value */
-    JERRY_ASSERT (chunk_p != NULL);
-  }
-
-  ecma_value_t *values_p = (ecma_value_t *) chunk_p->data;
-
-  JERRY_ASSERT ((uint8_t *) (values_p + pos_of_new_value_in_chunk + 1) <= (uint8_t *) (chunk_p + 1));
 
   if (do_ref_if_object)
   {
-    values_p[pos_of_new_value_in_chunk] = ecma_copy_value (v);
+    header_p->buffer_p[header_p->unit_number] = ecma_copy_value (v);
   }
   else
   {
-    values_p[pos_of_new_value_in_chunk] = ecma_copy_value_if_not_object (v);
+    header_p->buffer_p[header_p->unit_number] = ecma_copy_value_if_not_object (v);
   }
+
+  header_p->unit_number++;
 } /* ecma_append_to_values_collection */
 
 /**
  * Remove last element of the collection
- *
- * Warning:
- *         the function invalidates all iterators that are configured to access the passed collection
  */
 void
 ecma_remove_last_value_from_values_collection (ecma_collection_header_t *header_p) /**< collection's header */
 {
   JERRY_ASSERT (header_p != NULL && header_p->unit_number > 0);
 
-  const size_t values_in_chunk = JERRY_SIZE_OF_STRUCT_MEMBER (ecma_collection_chunk_t, data) / sizeof (ecma_value_t);
-  size_t values_number = header_p->unit_number;
-  size_t pos_of_value_to_remove_in_chunk = (values_number - 1u) % values_in_chunk;
-
-  ecma_collection_chunk_t *last_chunk_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                     header_p->last_chunk_cp);
-
-  ecma_value_t *values_p = (ecma_value_t *) last_chunk_p->data;
-  JERRY_ASSERT ((uint8_t *) (values_p + pos_of_value_to_remove_in_chunk + 1) <= (uint8_t *) (last_chunk_p + 1));
-
-  ecma_value_t value_to_remove = values_p[pos_of_value_to_remove_in_chunk];
-
-  ecma_free_value (value_to_remove);
-
   header_p->unit_number--;
-
-  if (pos_of_value_to_remove_in_chunk == 0)
-  {
-    ecma_collection_chunk_t *chunk_to_remove_p = last_chunk_p;
-
-    /* free last chunk */
-    if (header_p->first_chunk_cp == header_p->last_chunk_cp)
-    {
-      header_p->first_chunk_cp = ECMA_NULL_POINTER;
-      header_p->last_chunk_cp = ECMA_NULL_POINTER;
-    }
-    else
-    {
-      ecma_collection_chunk_t *chunk_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                         header_p->first_chunk_cp);
-
-      while (chunk_iter_p->next_chunk_cp != header_p->last_chunk_cp)
-      {
-        chunk_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                  chunk_iter_p->next_chunk_cp);
-      }
-
-      ecma_collection_chunk_t *new_last_chunk_p = chunk_iter_p;
-
-      JERRY_ASSERT (ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                               new_last_chunk_p->next_chunk_cp) == chunk_to_remove_p);
-
-      ECMA_SET_NON_NULL_POINTER (header_p->last_chunk_cp, new_last_chunk_p);
-      new_last_chunk_p->next_chunk_cp = ECMA_NULL_POINTER;
-    }
-
-    ecma_dealloc_collection_chunk (chunk_to_remove_p);
-  }
+  ecma_free_value (header_p->buffer_p[header_p->unit_number]);
 } /* ecma_remove_last_value_from_values_collection */
 
 /**
@@ -295,79 +209,6 @@ ecma_new_strings_collection (ecma_string_t *string_ptrs_buffer[], /**< pointers
   return new_collection_p;
 } /* ecma_new_strings_collection */
 
-/**
- * Initialize new collection iterator for the collection
- */
-void
-ecma_collection_iterator_init (ecma_collection_iterator_t *iterator_p, /**< context of iterator */
-                               ecma_collection_header_t *collection_p) /**< header of collection */
-{
-  iterator_p->header_p = collection_p;
-  iterator_p->next_chunk_cp = (collection_p != NULL ? collection_p->first_chunk_cp : JMEM_CP_NULL);
-  iterator_p->current_index = 0;
-  iterator_p->current_value_p = NULL;
-  iterator_p->current_chunk_end_p = NULL;
-} /* ecma_collection_iterator_init */
-
-/**
- * Move collection iterator to next element if there is any.
- *
- * @return true - if iterator moved,
- *         false - otherwise (current element is last element in the collection)
- */
-bool
-ecma_collection_iterator_next (ecma_collection_iterator_t *iterator_p) /**< context of iterator */
-{
-  if (iterator_p->header_p == NULL
-      || unlikely (iterator_p->header_p->unit_number == 0))
-  {
-    return false;
-  }
-
-  const size_t values_in_chunk = JERRY_SIZE_OF_STRUCT_MEMBER (ecma_collection_chunk_t, data) / sizeof (ecma_value_t);
-
-  if (iterator_p->current_value_p == NULL)
-  {
-    JERRY_ASSERT (iterator_p->current_index == 0);
-
-    ecma_collection_chunk_t *first_chunk_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                        iterator_p->header_p->first_chunk_cp);
-
-    iterator_p->next_chunk_cp = first_chunk_p->next_chunk_cp;
-    iterator_p->current_value_p = (ecma_value_t *) &first_chunk_p->data;
-    iterator_p->current_chunk_end_p = (iterator_p->current_value_p + values_in_chunk);
-  }
-  else
-  {
-    if (iterator_p->current_index + 1 == iterator_p->header_p->unit_number)
-    {
-      return false;
-    }
-
-    JERRY_ASSERT (iterator_p->current_index + 1 < iterator_p->header_p->unit_number);
-
-    iterator_p->current_index++;
-    iterator_p->current_value_p++;
-  }
-
-  if (iterator_p->current_value_p == iterator_p->current_chunk_end_p)
-  {
-    ecma_collection_chunk_t *next_chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                                              iterator_p->next_chunk_cp);
-    JERRY_ASSERT (next_chunk_p != NULL);
-
-    iterator_p->next_chunk_cp = next_chunk_p->next_chunk_cp;
-    iterator_p->current_value_p = (ecma_value_t *) &next_chunk_p->data;
-    iterator_p->current_chunk_end_p = iterator_p->current_value_p + values_in_chunk;
-  }
-  else
-  {
-    JERRY_ASSERT (iterator_p->current_value_p < iterator_p->current_chunk_end_p);
-  }
-
-  return true;
-} /* ecma_collection_iterator_next */
-
 /**
  * @}
  * @}
@@ -16,6 +16,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-gc.h"
+#include "ecma-global-cells.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
@@ -606,6 +607,102 @@ ecma_create_named_data_property (ecma_object_t *object_p, /**< object */
   return ecma_create_property (object_p, name_p, type_and_flags, value, out_prop_p);
 } /* ecma_create_named_data_property */
 
+/**
+ * Create configurable, enumerable and writable named data properties
+ * with the given names and values in the specified object.
+ *
+ * The properties are created in the order of the names, with the same
+ * layout as consecutive ecma_create_named_data_property calls produce,
+ * but the property pairs are filled and linked directly.
+ *
+ * Note:
+ *      the names must be distinct and must not be present in the object
+ *
+ *      the references of the values are moved to the properties
+ */
+void
+ecma_create_named_data_properties (ecma_object_t *object_p, /**< object */
+                                   ecma_string_t **names_p, /**< property names */
+                                   ecma_value_t *values_p, /**< property values */
+                                   uint32_t count) /**< number of properties */
+{
+  const uint8_t type_and_flags = ECMA_PROPERTY_TYPE_NAMEDDATA | ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE;
+  uint32_t index = 0;
+
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+  while (index < count)
+  {
+    jmem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
+    ecma_property_header_t *first_property_p = NULL;
+
+    if (*property_list_head_p != ECMA_NULL_POINTER)
+    {
+      first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *property_list_head_p);
+    }
+
+    /* Properties of objects with a hashmap and the first free slot are created one by one. */
+    if (first_property_p != NULL
+        && (ECMA_PROPERTY_GET_TYPE (first_property_p->types[0]) == ECMA_PROPERTY_TYPE_HASHMAP
+            || first_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED))
+    {
+      JERRY_ASSERT (ecma_find_named_property (object_p, names_p[index]) == NULL);
+
+      ecma_property_value_t value;
+      value.value = values_p[index];
+
+      ecma_ref_ecma_string (names_p[index]);
+      ecma_create_property (object_p, names_p[index], type_and_flags, value, NULL);
+
+      if (ecma_is_value_object (values_p[index]))
+      {
+        ecma_deref_object (ecma_get_object_from_value (values_p[index]));
+      }
+
+      index++;
+      continue;
+    }
+
+    ecma_property_pair_t *property_pair_p = ecma_alloc_property_pair ();
+
+    /* The allocation may free the hashmap, so the list head is read again. */
+    property_pair_p->header.next_property_cp = object_p->property_list_or_bound_object_cp;
+    property_pair_p->header.types[1] = type_and_flags;
+    ECMA_SET_NON_NULL_POINTER (property_pair_p->names_cp[1], names_p[index]);
+    property_pair_p->values[1].value = values_p[index];
+
+    if (index + 1 < count)
+    {
+      property_pair_p->header.types[0] = type_and_flags;
+      ECMA_SET_NON_NULL_POINTER (property_pair_p->names_cp[0], names_p[index + 1]);
+      property_pair_p->values[0].value = values_p[index + 1];
+    }
+    else
+    {
+      property_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+      property_pair_p->names_cp[0] = ECMA_NULL_POINTER;
+      property_pair_p->values[0].value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+
+    ECMA_SET_NON_NULL_POINTER (object_p->property_list_or_bound_object_cp, &property_pair_p->header);
+
+    /* The objects are reachable through the properties from now on. */
+    uint32_t end = (index + 1 < count) ? index + 2 : index + 1;
+
+    while (index < end)
+    {
+      ecma_ref_ecma_string (names_p[index]);
+
+      if (ecma_is_value_object (values_p[index]))
+      {
+        ecma_deref_object (ecma_get_object_from_value (values_p[index]));
+      }
+
+      index++;
+    }
+  }
+} /* ecma_create_named_data_properties */
+
 /**
  * Create named accessor property with given name, attributes, getter and setter.
  *
@@ -814,6 +911,11 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
       {
         ecma_lcache_invalidate (object_p, name_p, property_p);
       }
+
+      if (ecma_is_property_global_cell (property_p))
+      {
+        ecma_global_cells_invalidate (name_p, property_p);
+      }
       break;
     }
     case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
@@ -829,6 +931,11 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
       {
         ecma_lcache_invalidate (object_p, name_p, property_p);
       }
+
+      if (ecma_is_property_global_cell (property_p))
+      {
+        ecma_global_cells_invalidate (name_p, property_p);
+      }
       break;
     }
     case ECMA_PROPERTY_TYPE_INTERNAL:
@@ -1343,6 +1450,40 @@ ecma_set_property_lcached (ecma_property_t *property_p, /**< property */
   }
 } /* ecma_set_property_lcached */
 
+/**
+ * Check whether the property is registered in the global cell table
+ *
+ * @return true / false
+ */
+inline bool __attr_always_inline___
+ecma_is_property_global_cell (ecma_property_t *property_p) /**< property */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                || ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+  return (*property_p & ECMA_PROPERTY_FLAG_GLOBAL_CELL) != 0;
+} /* ecma_is_property_global_cell */
+
+/**
+ * Set value of flag indicating whether the property is registered in the global cell table
+ */
+inline void __attr_always_inline___
+ecma_set_property_global_cell (ecma_property_t *property_p, /**< property */
+                               bool is_global_cell) /**< new value for global cell flag */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                || ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+  if (is_global_cell)
+  {
+    *property_p = (uint8_t) (*property_p | ECMA_PROPERTY_FLAG_GLOBAL_CELL);
+  }
+  else
+  {
+    *property_p = (uint8_t) (*property_p & ~ECMA_PROPERTY_FLAG_GLOBAL_CELL);
+  }
+} /* ecma_set_property_global_cell */
+
 /**
  * Construct empty property descriptor, i.e.:
  *  property descriptor with all is_defined flags set to false and the rest - to default value.
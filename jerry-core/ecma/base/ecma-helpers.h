@@ -164,6 +164,8 @@ extern void ecma_free_value_if_not_object (ecma_value_t);
 
 /* ecma-helpers-string.c */
 extern ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_string_t *ecma_new_ecma_external_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                                               ecma_external_pointer_t);
 extern ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t);
 extern ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t);
@@ -171,6 +173,13 @@ extern ecma_string_t *ecma_new_ecma_string_from_magic_string_id (lit_magic_strin
 extern ecma_string_t *ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t);
 extern ecma_string_t *ecma_new_ecma_length_string ();
 extern ecma_string_t *ecma_concat_ecma_strings (ecma_string_t *, ecma_string_t *);
+extern void ecma_stringbuilder_init (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_append (ecma_stringbuilder_t *, const ecma_string_t *);
+extern void ecma_stringbuilder_append_magic (ecma_stringbuilder_t *, lit_magic_string_id_t);
+extern void ecma_stringbuilder_append_raw (ecma_stringbuilder_t *, const lit_utf8_byte_t *, lit_utf8_size_t);
+extern void ecma_stringbuilder_append_byte (ecma_stringbuilder_t *, lit_utf8_byte_t);
+extern ecma_string_t *ecma_stringbuilder_finalize (ecma_stringbuilder_t *);
+extern void ecma_stringbuilder_destroy (ecma_stringbuilder_t *);
 extern void ecma_ref_ecma_string (ecma_string_t *);
 extern void ecma_deref_ecma_string (ecma_string_t *);
 extern ecma_number_t ecma_string_to_number (const ecma_string_t *);
@@ -198,7 +207,7 @@ extern bool ecma_is_string_magic (const ecma_string_t *, lit_magic_string_id_t *
 
 extern lit_string_hash_t ecma_string_hash (const ecma_string_t *);
 extern ecma_string_t *ecma_string_substr (const ecma_string_t *, ecma_length_t, ecma_length_t);
-extern ecma_string_t *ecma_string_trim (const ecma_string_t *);
+extern ecma_string_t *ecma_string_trim (ecma_string_t *);
 
 /* ecma-helpers-number.c */
 extern ecma_number_t ecma_number_make_nan (void);
@@ -231,24 +240,6 @@ extern void ecma_append_to_values_collection (ecma_collection_header_t *, ecma_v
 extern void ecma_remove_last_value_from_values_collection (ecma_collection_header_t *);
 extern ecma_collection_header_t *ecma_new_strings_collection (ecma_string_t *[], ecma_length_t);
 
-/**
- * Context of ecma values' collection iterator
- */
-typedef struct
-{
-  ecma_collection_header_t *header_p; /**< collection header */
-  jmem_cpointer_t next_chunk_cp; /**< compressed pointer to next chunk */
-  ecma_length_t current_index; /**< index of current element */
-  const ecma_value_t *current_value_p; /**< pointer to current element */
-  const ecma_value_t *current_chunk_beg_p; /**< pointer to beginning of current chunk's data */
-  const ecma_value_t *current_chunk_end_p; /**< pointer to place right after the end of current chunk's data */
-} ecma_collection_iterator_t;
-
-extern void
-ecma_collection_iterator_init (ecma_collection_iterator_t *, ecma_collection_header_t *);
-extern bool
-ecma_collection_iterator_next (ecma_collection_iterator_t *);
-
 /* ecma-helpers.c */
 extern ecma_object_t *ecma_create_object (ecma_object_t *, size_t, ecma_object_type_t);
 extern ecma_object_t *ecma_create_decl_lex_env (ecma_object_t *);
@@ -273,6 +264,8 @@ extern ecma_value_t *ecma_get_internal_property (ecma_object_t *, ecma_internal_
 
 extern ecma_property_value_t *
 ecma_create_named_data_property (ecma_object_t *, ecma_string_t *, uint8_t, ecma_property_t **);
+extern void
+ecma_create_named_data_properties (ecma_object_t *, ecma_string_t **, ecma_value_t *, uint32_t);
 extern ecma_property_value_t *
 ecma_create_named_accessor_property (ecma_object_t *, ecma_string_t *, ecma_object_t *, ecma_object_t *, uint8_t);
 extern ecma_property_t *
@@ -300,6 +293,8 @@ extern void ecma_set_property_configurable_attr (ecma_property_t *, bool);
 
 extern bool ecma_is_property_lcached (ecma_property_t *);
 extern void ecma_set_property_lcached (ecma_property_t *, bool);
+extern bool ecma_is_property_global_cell (ecma_property_t *);
+extern void ecma_set_property_global_cell (ecma_property_t *, bool);
 
 extern ecma_property_descriptor_t ecma_make_empty_property_descriptor (void);
 extern void ecma_free_property_descriptor (ecma_property_descriptor_t *);
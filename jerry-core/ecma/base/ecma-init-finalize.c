@@ -14,13 +14,17 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-for-in.h"
 #include "ecma-gc.h"
+#include "ecma-global-cells.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
 #include "jmem-allocator.h"
+#include "js-parser.h"
+#include "re-compiler.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -36,6 +40,8 @@ void
 ecma_init (void)
 {
   ecma_lcache_init ();
+  ecma_global_cells_init ();
+  ecma_for_in_cache_init ();
   ecma_init_global_lex_env ();
 
   jmem_register_free_unused_memory_callback (ecma_free_unused_memory);
@@ -49,9 +55,15 @@ ecma_finalize (void)
 {
   jmem_unregister_free_unused_memory_callback (ecma_free_unused_memory);
 
+  ecma_for_in_cache_invalidate ();
+  parser_code_cache_flush ();
+
   ecma_finalize_global_lex_env ();
   ecma_finalize_builtins ();
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_gc_run ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
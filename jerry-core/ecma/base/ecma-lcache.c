@@ -164,7 +164,7 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
       JERRY_ASSERT ((prop_name_p->hash & ECMA_LCACHE_HASH_MASK) == (entry_prop_name_p->hash & ECMA_LCACHE_HASH_MASK));
 
       if (prop_name_p == entry_prop_name_p
-          || (prop_container > ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+          || (prop_container > ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING
               && prop_container == ECMA_STRING_GET_CONTAINER (entry_prop_name_p)
               && prop_name_p->u.common_field == entry_prop_name_p->u.common_field))
       {
@@ -223,6 +223,29 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_invalidate */
 
+/**
+ * Invalidate all LCache entries
+ */
+void
+ecma_lcache_invalidate_all (void)
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  for (uint32_t row_index = 0; row_index < ECMA_LCACHE_HASH_ROWS_COUNT; row_index++)
+  {
+    ecma_lcache_hash_entry_t *entry_p = JERRY_HASH_TABLE_CONTEXT (table) [row_index];
+
+    for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
+    {
+      if (entry_p->object_cp != ECMA_NULL_POINTER)
+      {
+        ecma_lcache_invalidate_entry (entry_p);
+      }
+      entry_p++;
+    }
+  }
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_invalidate_all */
+
 /**
  * @}
  * @}
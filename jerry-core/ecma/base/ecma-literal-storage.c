@@ -62,16 +62,54 @@ ecma_finalize_lit_storage (void)
 } /* ecma_finalize_lit_storage */
 
 /**
- * Find or create a literal string.
+ * Insert a string into the literal storage.
+ *
+ * Note:
+ *      the reference of the passed string is taken over
  *
  * @return ecma_string_t compressed pointer
  */
-jmem_cpointer_t
-ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
-                                    lit_utf8_size_t size) /**< size of the string */
+static jmem_cpointer_t
+ecma_insert_literal_string (ecma_string_t *string_p, /**< string to be inserted */
+                            jmem_cpointer_t *empty_cpointer_p) /**< free slot in the literal storage
+                                                                *   (NULL, if no free slot is known) */
 {
-  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+  jmem_cpointer_t result;
+  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+
+  if (empty_cpointer_p != NULL)
+  {
+    *empty_cpointer_p = result;
+    return result;
+  }
+
+  ecma_lit_storage_item_t *new_item_p;
+  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+
+  new_item_p->values[0] = result;
+  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  {
+    new_item_p->values[i] = JMEM_CP_NULL;
+  }
 
+  JMEM_CP_SET_POINTER (new_item_p->next_cp, JERRY_CONTEXT (string_list_first_p));
+  JERRY_CONTEXT (string_list_first_p) = new_item_p;
+
+  return result;
+} /* ecma_insert_literal_string */
+
+/**
+ * Find a literal string which is equal to the passed string or
+ * insert the passed string into the literal storage.
+ *
+ * Note:
+ *      the reference of the passed string is taken over
+ *
+ * @return ecma_string_t compressed pointer
+ */
+static jmem_cpointer_t
+ecma_find_or_insert_literal_string (ecma_string_t *string_p) /**< string to be searched */
+{
   ecma_lit_storage_item_t *string_list_p = JERRY_CONTEXT (string_list_first_p);
   jmem_cpointer_t *empty_cpointer_p = NULL;
 
@@ -103,28 +141,19 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     string_list_p = JMEM_CP_GET_POINTER (ecma_lit_storage_item_t, string_list_p->next_cp);
   }
 
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return result;
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  JMEM_CP_SET_POINTER (new_item_p->next_cp, JERRY_CONTEXT (string_list_first_p));
-  JERRY_CONTEXT (string_list_first_p) = new_item_p;
+  return ecma_insert_literal_string (string_p, empty_cpointer_p);
+} /* ecma_find_or_insert_literal_string */
 
-  return result;
+/**
+ * Find or create a literal string.
+ *
+ * @return ecma_string_t compressed pointer
+ */
+jmem_cpointer_t
+ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
+                                    lit_utf8_size_t size) /**< size of the string */
+{
+  return ecma_find_or_insert_literal_string (ecma_new_ecma_string_from_utf8 (chars_p, size));
 } /* ecma_find_or_create_literal_string */
 
 /**
@@ -283,13 +312,13 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
     return false;
   }
 
-  /* Check whether the maximum literal table size is reached. */
-  if ((lit_table_size >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG) > UINT16_MAX)
+  uint32_t total_count = string_count + number_count;
+
+  /* Check whether the maximum literal index is reached. */
+  if (total_count >= UINT16_MAX)
   {
     return false;
   }
-
-  uint32_t total_count = string_count + number_count;
   lit_mem_to_snapshot_id_map_entry_t *map_p;
 
   map_p = jmem_heap_alloc_block (total_count * sizeof (lit_mem_to_snapshot_id_map_entry_t));
@@ -304,8 +333,8 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
   /* Write data into the buffer. */
 
   /* The zero value is reserved for NULL (no literal)
-   * constant so the first literal must have offset one. */
-  uint32_t literal_offset = JERRY_SNAPSHOT_LITERAL_ALIGNMENT;
+   * constant so the first literal must have index one. */
+  jmem_cpointer_t literal_index = 1;
 
   ((uint32_t *) buffer_p)[0] = string_count;
   ((uint32_t *) buffer_p)[1] = number_count;
@@ -320,7 +349,7 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
       if (string_list_p->values[i] != JMEM_CP_NULL)
       {
         map_p->literal_id = string_list_p->values[i];
-        map_p->literal_offset = (jmem_cpointer_t) (literal_offset >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG);
+        map_p->literal_offset = literal_index++;
         map_p++;
 
         ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
@@ -335,7 +364,6 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
                                 JERRY_SNAPSHOT_LITERAL_ALIGNMENT);
 
         buffer_p += length;
-        literal_offset += length;
       }
     }
 
@@ -351,7 +379,7 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
       if (number_list_p->values[i] != JMEM_CP_NULL)
       {
         map_p->literal_id = number_list_p->values[i];
-        map_p->literal_offset = (jmem_cpointer_t) (literal_offset >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG);
+        map_p->literal_offset = literal_index++;
         map_p++;
 
         ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
@@ -366,7 +394,6 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
                                               JERRY_SNAPSHOT_LITERAL_ALIGNMENT);
 
         buffer_p += length;
-        literal_offset += length;
       }
     }
 
@@ -380,6 +407,155 @@ ecma_save_literals_for_snapshot (uint8_t *buffer_p, /**< [out] output snapshot b
 
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
+/**
+ * Hash index of the literal strings, which is used for deduplicating
+ * the string literals of a snapshot without scanning the literal storage.
+ */
+typedef struct
+{
+  jmem_cpointer_t *buckets_p; /**< open addressing hash table of literal strings */
+  uint32_t size; /**< number of buckets (power of 2) */
+  uint32_t shift; /**< shift of the scrambled hash, which gives the bucket index */
+} ecma_lit_string_index_t;
+
+/**
+ * Find the bucket of a string in the literal string index.
+ *
+ * @return pointer to the bucket, which is either empty or refers to an equal string
+ */
+static jmem_cpointer_t *
+ecma_lit_string_index_find (const ecma_lit_string_index_t *index_p, /**< literal string index */
+                            const ecma_string_t *string_p) /**< string to be searched */
+{
+  /* The low bits of the string hash depend mostly on the low bits of the characters,
+   * so the hash is scrambled by a multiplicative step and its upper bits are used. */
+  uint32_t bucket = ((uint32_t) string_p->hash * 0x9e3779b1u) >> index_p->shift;
+
+  while (true)
+  {
+    jmem_cpointer_t *bucket_p = index_p->buckets_p + bucket;
+
+    if (*bucket_p == JMEM_CP_NULL
+        || ecma_compare_ecma_strings (string_p, JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, *bucket_p)))
+    {
+      return bucket_p;
+    }
+
+    bucket = (bucket + 1) & (index_p->size - 1);
+  }
+} /* ecma_lit_string_index_find */
+
+/**
+ * Create a literal string index, which contains the strings of the literal storage
+ * and has enough space for the passed number of new strings.
+ *
+ * Note:
+ *      buckets_p is set to NULL, if there is not enough memory for the index
+ */
+static void
+ecma_lit_string_index_init (ecma_lit_string_index_t *index_p, /**< [out] literal string index */
+                            uint32_t new_string_count) /**< number of strings to be inserted */
+{
+  uint32_t string_count = new_string_count;
+  ecma_lit_storage_item_t *string_list_p = JERRY_CONTEXT (string_list_first_p);
+
+  while (string_list_p != NULL)
+  {
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] != JMEM_CP_NULL)
+      {
+        string_count++;
+      }
+    }
+
+    string_list_p = JMEM_CP_GET_POINTER (ecma_lit_storage_item_t, string_list_p->next_cp);
+  }
+
+  /* At least half of the buckets are always empty. */
+  uint32_t size_log = 4;
+
+  while ((1u << size_log) < 2 * string_count)
+  {
+    size_log++;
+  }
+
+  index_p->size = 1u << size_log;
+  index_p->shift = 32 - size_log;
+  index_p->buckets_p = jmem_heap_alloc_block_null_on_error (index_p->size * sizeof (jmem_cpointer_t));
+
+  if (index_p->buckets_p == NULL)
+  {
+    return;
+  }
+
+  memset (index_p->buckets_p, 0, index_p->size * sizeof (jmem_cpointer_t));
+
+  string_list_p = JERRY_CONTEXT (string_list_first_p);
+
+  while (string_list_p != NULL)
+  {
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] != JMEM_CP_NULL)
+      {
+        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
+                                                               string_list_p->values[i]);
+
+        *ecma_lit_string_index_find (index_p, value_p) = string_list_p->values[i];
+      }
+    }
+
+    string_list_p = JMEM_CP_GET_POINTER (ecma_lit_storage_item_t, string_list_p->next_cp);
+  }
+} /* ecma_lit_string_index_init */
+
+/**
+ * Find or insert a literal string of a snapshot.
+ *
+ * Note:
+ *      the reference of the passed string is taken over
+ *
+ * @return ecma_string_t compressed pointer
+ */
+static jmem_cpointer_t
+ecma_find_or_insert_snapshot_literal_string (ecma_lit_string_index_t *index_p, /**< literal string index */
+                                             ecma_string_t *string_p) /**< string to be searched */
+{
+  if (index_p->buckets_p == NULL)
+  {
+    return ecma_find_or_insert_literal_string (string_p);
+  }
+
+  jmem_cpointer_t *bucket_p = ecma_lit_string_index_find (index_p, string_p);
+
+  if (*bucket_p != JMEM_CP_NULL)
+  {
+    ecma_deref_ecma_string (string_p);
+    return *bucket_p;
+  }
+
+  /* Only the first item of the literal storage is checked for a free slot,
+   * since the items inserted by the snapshot are filled one after the other. */
+  ecma_lit_storage_item_t *string_list_p = JERRY_CONTEXT (string_list_first_p);
+  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+  if (string_list_p != NULL)
+  {
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (string_list_p->values[i] == JMEM_CP_NULL)
+      {
+        empty_cpointer_p = string_list_p->values + i;
+        break;
+      }
+    }
+  }
+
+  *bucket_p = ecma_insert_literal_string (string_p, empty_cpointer_p);
+  return *bucket_p;
+} /* ecma_find_or_insert_snapshot_literal_string */
+
 /**
  * Helper function for ecma_load_literals_from_snapshot.
  *
@@ -393,12 +569,17 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
                                 uint32_t lit_table_size, /**< size of literal table in snapshot */
                                 lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map */
                                 uint32_t string_count, /**< number of strings */
-                                uint32_t number_count) /**< number of numbers */
+                                uint32_t number_count, /**< number of numbers */
+                                ecma_lit_string_index_t *index_p, /**< literal string index */
+                                bool copy_strings) /**< strings should be copied to memory */
 {
-  /* The zero value is reserved for NULL (no literal)
-   * constant so the first literal must have offset one. */
+  /* Used for checking the size of the literal table. */
   uint32_t literal_offset = JERRY_SNAPSHOT_LITERAL_ALIGNMENT;
 
+  /* The zero value is reserved for NULL (no literal)
+   * constant so the first literal must have index one. */
+  jmem_cpointer_t literal_index = 1;
+
   /* Load strings first. */
   while (string_count > 0)
   {
@@ -418,8 +599,23 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
       return false;
     }
 
-    map_p->literal_id = ecma_find_or_create_literal_string (buffer_p + sizeof (uint16_t), length);
-    map_p->literal_offset = (jmem_cpointer_t) (literal_offset >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG);
+    const lit_utf8_byte_t *chars_p = buffer_p + sizeof (uint16_t);
+    ecma_string_t *string_p;
+
+    /* Strings are referenced in place when the snapshot buffer outlives
+     * the engine, unless the external descriptor is larger than a copy. */
+    if (copy_strings || sizeof (ecma_string_t) + length <= sizeof (ecma_external_string_t))
+    {
+      string_p = ecma_new_ecma_string_from_utf8 (chars_p, length);
+    }
+    else
+    {
+      string_p = ecma_new_ecma_external_string_from_utf8 (chars_p, length, 0);
+    }
+
+    map_p->literal_id = ecma_find_or_insert_snapshot_literal_string (index_p, string_p);
+
+    map_p->literal_offset = literal_index++;
     map_p++;
 
     buffer_p += aligned_length;
@@ -441,7 +637,7 @@ ecma_load_literals_from_buffer (const uint8_t *buffer_p, /**< buffer with litera
     memcpy (&num, buffer_p, sizeof (ecma_number_t));
 
     map_p->literal_id = ecma_find_or_create_literal_number (num);
-    map_p->literal_offset = (jmem_cpointer_t) (literal_offset >> JERRY_SNAPSHOT_LITERAL_ALIGNMENT_LOG);
+    map_p->literal_offset = literal_index++;
     map_p++;
 
     ecma_length_t length = JERRY_ALIGNUP (sizeof (ecma_number_t),
@@ -469,7 +665,10 @@ ecma_load_literals_from_snapshot (const uint8_t *buffer_p, /**< buffer with lite
                                                                                    *   in snapshot to identifiers
                                                                                    *   of loaded literals in literal
                                                                                    *   storage */
-                                  uint32_t *out_map_len_p) /**< [out] literals number */
+                                  uint32_t *out_map_len_p, /**< [out] literals number */
+                                  bool copy_strings) /**< strings should be copied to memory, otherwise
+                                                      *   they may refer to the buffer, which must
+                                                      *   outlive the engine */
 {
   *out_map_p = NULL;
 
@@ -493,10 +692,31 @@ ecma_load_literals_from_snapshot (const uint8_t *buffer_p, /**< buffer with lite
     return true;
   }
 
+  if (total_count >= UINT16_MAX)
+  {
+    return false;
+  }
+
   map_p = jmem_heap_alloc_block (total_count * sizeof (lit_mem_to_snapshot_id_map_entry_t));
   *out_map_p = map_p;
 
-  if (ecma_load_literals_from_buffer (buffer_p, lit_table_size, map_p, string_count, number_count))
+  ecma_lit_string_index_t index;
+  ecma_lit_string_index_init (&index, string_count);
+
+  bool is_loaded = ecma_load_literals_from_buffer (buffer_p,
+                                                   lit_table_size,
+                                                   map_p,
+                                                   string_count,
+                                                   number_count,
+                                                   &index,
+                                                   copy_strings);
+
+  if (index.buckets_p != NULL)
+  {
+    jmem_heap_free_block (index.buckets_p, index.size * sizeof (jmem_cpointer_t));
+  }
+
+  if (is_loaded)
   {
     return true;
   }
@@ -29,12 +29,16 @@
  */
 
 /**
- * Snapshot literal - offset map
+ * Snapshot literal - index map
+ *
+ * Note:
+ *      literals are referenced by their one based index in the literal table of
+ *      a snapshot, so the entry of a literal can be found by direct indexing.
  */
 typedef struct
 {
   jmem_cpointer_t literal_id; /**< literal id */
-  jmem_cpointer_t literal_offset; /**< literal offset */
+  jmem_cpointer_t literal_offset; /**< literal index */
 } lit_mem_to_snapshot_id_map_entry_t;
 
 extern void ecma_finalize_lit_storage (void);
@@ -51,7 +55,7 @@ ecma_save_literals_for_snapshot (uint8_t *, size_t, size_t *,
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 extern bool
 ecma_load_literals_from_snapshot (const uint8_t *, uint32_t,
-                                  lit_mem_to_snapshot_id_map_entry_t **, uint32_t *);
+                                  lit_mem_to_snapshot_id_map_entry_t **, uint32_t *, bool);
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 
 /**
@@ -175,36 +175,31 @@ ecma_builtin_array_prototype_object_to_locale_string (const ecma_value_t this_ar
                     ecma_builtin_helper_get_to_locale_string_at_index (obj_p, 0),
                     ret_value);
 
-    ecma_string_t *return_string_p = ecma_get_string_from_value (first_value);
-    ecma_ref_ecma_string (return_string_p);
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (first_value));
 
     /* 9-10. */
     for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      ecma_stringbuilder_append (&builder, separator_string_p);
 
       ECMA_TRY_CATCH (next_string_value,
                       ecma_builtin_helper_get_to_locale_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
 
     ECMA_FINALIZE (first_value);
@@ -403,39 +398,34 @@ ecma_builtin_array_prototype_join (const ecma_value_t this_arg, /**< this argume
                     ecma_op_array_get_to_string_at_index (obj_p, 0),
                     ret_value);
 
-    ecma_string_t *return_string_p = ecma_get_string_from_value (first_value);
-    ecma_ref_ecma_string (return_string_p);
+    ecma_stringbuilder_t builder;
+    ecma_stringbuilder_init (&builder);
+    ecma_stringbuilder_append (&builder, ecma_get_string_from_value (first_value));
 
     /* 9-10. */
     for (uint32_t k = 1; ecma_is_value_empty (ret_value) && (k < length); k++)
     {
       /* 10.a */
-      ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
+      ecma_stringbuilder_append (&builder, separator_string_p);
 
       /* 10.b, 10.c */
       ECMA_TRY_CATCH (next_string_value,
                       ecma_op_array_get_to_string_at_index (obj_p, k),
                       ret_value);
 
-      ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
-
-      ecma_deref_ecma_string (return_string_p);
-
       /* 10.d */
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_stringbuilder_append (&builder, ecma_get_string_from_value (next_string_value));
 
       ECMA_FINALIZE (next_string_value);
-
-      ecma_deref_ecma_string (part_string_p);
     }
 
     if (ecma_is_value_empty (ret_value))
     {
-      ret_value = ecma_make_string_value (return_string_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     else
     {
-      ecma_deref_ecma_string (return_string_p);
+      ecma_stringbuilder_destroy (&builder);
     }
 
     ECMA_FINALIZE (first_value);
@@ -1220,14 +1210,12 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
   uint32_t defined_prop_count = 0;
   uint32_t copied_num = 0;
 
-  ecma_collection_iterator_t iter;
-  ecma_collection_iterator_init (&iter, array_index_props_p);
-
   /* Count properties with name that is array index less than len */
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  for (ecma_length_t i = 0;
+       i < array_index_props_p->unit_number && ecma_is_value_empty (ret_value);
+       i++)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_string_t *property_name_p = ecma_get_string_from_value (array_index_props_p->buffer_p[i]);
 
     uint32_t index = ecma_string_get_array_index (property_name_p);
     JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
@@ -1240,13 +1228,12 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
 
   JMEM_DEFINE_LOCAL_ARRAY (values_buffer, defined_prop_count, ecma_value_t);
 
-  ecma_collection_iterator_init (&iter, array_index_props_p);
-
   /* Copy unsorted array into a native c array. */
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  for (ecma_length_t i = 0;
+       i < array_index_props_p->unit_number && ecma_is_value_empty (ret_value);
+       i++)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_string_t *property_name_p = ecma_get_string_from_value (array_index_props_p->buffer_p[i]);
 
     uint32_t index = ecma_string_get_array_index (property_name_p);
     JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
@@ -1300,12 +1287,11 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
 
   /* Undefined properties should be in the back of the array. */
 
-  ecma_collection_iterator_init (&iter, array_index_props_p);
-
-  while (ecma_collection_iterator_next (&iter)
-         && ecma_is_value_empty (ret_value))
+  for (ecma_length_t i = 0;
+       i < array_index_props_p->unit_number && ecma_is_value_empty (ret_value);
+       i++)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+    ecma_string_t *property_name_p = ecma_get_string_from_value (array_index_props_p->buffer_p[i]);
 
     uint32_t index = ecma_string_get_array_index (property_name_p);
     JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
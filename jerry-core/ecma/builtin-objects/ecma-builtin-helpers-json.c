@@ -43,12 +43,9 @@ ecma_has_object_value_in_collection (ecma_collection_header_t *collection_p, /**
 
   ecma_object_t *obj_p = ecma_get_object_from_value (object_value);
 
-  ecma_collection_iterator_t iterator;
-  ecma_collection_iterator_init (&iterator, collection_p);
-
-  while (ecma_collection_iterator_next (&iterator))
+  for (ecma_length_t i = 0; i < collection_p->unit_number; i++)
   {
-    ecma_value_t value = *iterator.current_value_p;
+    ecma_value_t value = collection_p->buffer_p[i];
     ecma_object_t *current_p = ecma_get_object_from_value (value);
 
     if (current_p == obj_p)
@@ -76,12 +73,9 @@ ecma_has_string_value_in_collection (ecma_collection_header_t *collection_p, /**
 
   ecma_string_t *string_p = ecma_get_string_from_value (string_value);
 
-  ecma_collection_iterator_t iterator;
-  ecma_collection_iterator_init (&iterator, collection_p);
-
-  while (ecma_collection_iterator_next (&iterator))
+  for (ecma_length_t i = 0; i < collection_p->unit_number; i++)
   {
-    ecma_value_t value = *iterator.current_value_p;
+    ecma_value_t value = collection_p->buffer_p[i];
     ecma_string_t *current_p = ecma_get_string_from_value (value);
 
     if (ecma_compare_ecma_strings (current_p, string_p))
@@ -94,7 +88,7 @@ ecma_has_string_value_in_collection (ecma_collection_header_t *collection_p, /**
 } /* ecma_has_string_value_in_collection*/
 
 /**
- * Common function to concatenate key-value pairs into an ecma-string.
+ * Common function to append the key-value pairs to a string builder.
  *
  * See also:
  *          ECMA-262 v5, 15.12.3
@@ -102,48 +96,30 @@ ecma_has_string_value_in_collection (ecma_collection_header_t *collection_p, /**
  * Used by:
  *         - ecma_builtin_helper_json_create_formatted_json step 10.b.ii
  *         - ecma_builtin_helper_json_create_non_formatted_json step 10.a.i
- *
- * @return pointer to ecma-string
- *         Returned value must be freed with ecma_deref_ecma_string.
  */
-ecma_string_t *
-ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *partial_p, /**< key-value pairs*/
-                                                      ecma_string_t *separator_p) /**< separator*/
+static void
+ecma_builtin_helper_json_append_separated_properties (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                                      ecma_collection_header_t *partial_p, /**< key-value pairs*/
+                                                      ecma_string_t *indent_str_p) /**< indentation after the
+                                                                                    *   separator (NULL - if the
+                                                                                    *   output is not formatted) */
 {
-  ecma_string_t *properties_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
-  ecma_string_t *tmp_str_p;
-
-  ecma_collection_iterator_t iterator;
-  ecma_collection_iterator_init (&iterator, partial_p);
-
-  uint32_t index = 0;
-
-  while (ecma_collection_iterator_next (&iterator))
+  for (ecma_length_t i = 0; i < partial_p->unit_number; i++)
   {
-    ecma_value_t name_value = *iterator.current_value_p;
-    ecma_string_t *current_p = ecma_get_string_from_value (name_value);
-
-    if (index == 0)
+    if (i > 0)
     {
-      index++;
+      ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_COMMA);
 
-      tmp_str_p = ecma_concat_ecma_strings (properties_str_p, current_p);
-      ecma_deref_ecma_string (properties_str_p);
-      properties_str_p = tmp_str_p;
-      continue;
+      if (indent_str_p != NULL)
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LF);
+        ecma_stringbuilder_append (builder_p, indent_str_p);
+      }
     }
 
-    tmp_str_p = ecma_concat_ecma_strings (properties_str_p, separator_p);
-    ecma_deref_ecma_string (properties_str_p);
-    properties_str_p = tmp_str_p;
-
-    tmp_str_p = ecma_concat_ecma_strings (properties_str_p, current_p);
-    ecma_deref_ecma_string (properties_str_p);
-    properties_str_p = tmp_str_p;
+    ecma_stringbuilder_append (builder_p, ecma_get_string_from_value (partial_p->buffer_p[i]));
   }
-
-  return properties_str_p;
-} /* ecma_builtin_helper_json_create_separated_properties */
+} /* ecma_builtin_helper_json_append_separated_properties */
 
 /**
  * Common function to create a formatted JSON string.
@@ -159,60 +135,29 @@ ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *
  *         Returned value must be freed with ecma_free_value.
  */
 ecma_value_t
-ecma_builtin_helper_json_create_formatted_json (ecma_string_t *left_bracket_p, /**< left bracket*/
-                                                ecma_string_t *right_bracket_p, /**< right bracket*/
+ecma_builtin_helper_json_create_formatted_json (lit_utf8_byte_t left_bracket, /**< left bracket*/
+                                                lit_utf8_byte_t right_bracket, /**< right bracket*/
                                                 ecma_string_t *stepback_p, /**< stepback*/
                                                 ecma_collection_header_t *partial_p, /**< key-value pairs*/
                                                 ecma_json_stringify_context_t *context_p) /**< context*/
 {
   /* 10.b */
-  ecma_string_t *comma_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_COMMA_CHAR);
-  ecma_string_t *line_feed_p = ecma_get_magic_string (LIT_MAGIC_STRING_NEW_LINE_CHAR);
-  ecma_string_t *properties_str_p;
-  ecma_string_t *separator_p;
-
-  /* 10.b.i */
-  ecma_string_t *tmp_str_p = ecma_concat_ecma_strings (comma_str_p, line_feed_p);
-  ecma_deref_ecma_string (comma_str_p);
-  separator_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (separator_p, context_p->indent_str_p);
-  ecma_deref_ecma_string (separator_p);
-  separator_p = tmp_str_p;
-
-  /* 10.b.ii */
-  properties_str_p = ecma_builtin_helper_json_create_separated_properties (partial_p, separator_p);
-  ecma_deref_ecma_string (separator_p);
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
 
   /* 10.b.iii */
-  ecma_string_t *final_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (left_bracket_p, line_feed_p);
-  final_str_p = tmp_str_p;
+  ecma_stringbuilder_append_byte (&builder, left_bracket);
+  ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LF);
+  ecma_stringbuilder_append (&builder, context_p->indent_str_p);
 
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, context_p->indent_str_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
+  /* 10.b.i - 10.b.ii */
+  ecma_builtin_helper_json_append_separated_properties (&builder, partial_p, context_p->indent_str_p);
 
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, properties_str_p);
-  ecma_deref_ecma_string (final_str_p);
-  ecma_deref_ecma_string (properties_str_p);
-  final_str_p = tmp_str_p;
+  ecma_stringbuilder_append_byte (&builder, LIT_CHAR_LF);
+  ecma_stringbuilder_append (&builder, stepback_p);
+  ecma_stringbuilder_append_byte (&builder, right_bracket);
 
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, line_feed_p);
-  ecma_deref_ecma_string (line_feed_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, stepback_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  tmp_str_p = ecma_concat_ecma_strings (final_str_p, right_bracket_p);
-  ecma_deref_ecma_string (final_str_p);
-  final_str_p = tmp_str_p;
-
-  return ecma_make_string_value (final_str_p);
+  return ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
 } /* ecma_builtin_helper_json_create_formatted_json */
 
 /**
@@ -229,50 +174,40 @@ ecma_builtin_helper_json_create_formatted_json (ecma_string_t *left_bracket_p, /
  *         Returned value must be freed with ecma_free_value.
  */
 ecma_value_t
-ecma_builtin_helper_json_create_non_formatted_json (ecma_string_t *left_bracket_p, /**< left bracket*/
-                                                    ecma_string_t *right_bracket_p, /**< right bracket*/
+ecma_builtin_helper_json_create_non_formatted_json (lit_utf8_byte_t left_bracket, /**< left bracket*/
+                                                    lit_utf8_byte_t right_bracket, /**< right bracket*/
                                                     ecma_collection_header_t *partial_p) /**< key-value pairs*/
 {
   /* 10.a */
-  ecma_string_t *comma_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_COMMA_CHAR);
-  ecma_string_t *properties_str_p;
-  ecma_string_t *tmp_str_p;
-
-  /* 10.a.i */
-  properties_str_p = ecma_builtin_helper_json_create_separated_properties (partial_p, comma_str_p);
-  ecma_deref_ecma_string (comma_str_p);
+  ecma_stringbuilder_t builder;
+  ecma_stringbuilder_init (&builder);
 
   /* 10.a.ii */
-  tmp_str_p = ecma_concat_ecma_strings (left_bracket_p, properties_str_p);
-  ecma_deref_ecma_string (properties_str_p);
-  properties_str_p = tmp_str_p;
+  ecma_stringbuilder_append_byte (&builder, left_bracket);
+
+  /* 10.a.i */
+  ecma_builtin_helper_json_append_separated_properties (&builder, partial_p, NULL);
 
-  tmp_str_p = ecma_concat_ecma_strings (properties_str_p, right_bracket_p);
-  ecma_deref_ecma_string (properties_str_p);
-  properties_str_p = tmp_str_p;
+  ecma_stringbuilder_append_byte (&builder, right_bracket);
 
-  return ecma_make_string_value (properties_str_p);
+  return ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
 } /* ecma_builtin_helper_json_create_non_formatted_json */
 
 /**
- * Convert decimal value to 4 digit hexadecimal string value.
+ * Append the 4 digit hexadecimal form of a value to a string builder.
  *
  * See also:
  *          ECMA-262 v5, 15.12.3
  *
  * Used by:
  *         - ecma_builtin_json_quote step 2.c.iii
- *
- * @return pointer to ecma-string
- *         Returned value must be freed with ecma_deref_ecma_string.
  */
-ecma_string_t *
-ecma_builtin_helper_json_create_hex_digit_ecma_string (uint8_t value) /**< value in decimal*/
+void
+ecma_builtin_helper_json_append_hex_digits (ecma_stringbuilder_t *builder_p, /**< string builder */
+                                            uint8_t value) /**< value in decimal*/
 {
   /* 2.c.iii */
-  ecma_string_t *hex_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
-
-  JMEM_DEFINE_LOCAL_ARRAY (hex_buff, 4, lit_utf8_byte_t);
+  lit_utf8_byte_t hex_buff[4];
 
   for (uint32_t i = 0; i < 4; i++)
   {
@@ -294,15 +229,8 @@ ecma_builtin_helper_json_create_hex_digit_ecma_string (uint8_t value) /**< value
     value = value / 16;
   }
 
-  ecma_deref_ecma_string (hex_str_p);
-  hex_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) hex_buff, 4);
-
-  JMEM_FINALIZE_LOCAL_ARRAY (hex_buff);
-
-  JERRY_ASSERT (ecma_string_get_length (hex_str_p));
-
-  return hex_str_p;
-} /* ecma_builtin_helper_json_create_hex_digit_ecma_string */
+  ecma_stringbuilder_append_raw (builder_p, hex_buff, 4);
+} /* ecma_builtin_helper_json_append_hex_digits */
 
 /**
  * @}
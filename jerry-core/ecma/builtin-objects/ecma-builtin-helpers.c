@@ -210,16 +210,13 @@ ecma_builtin_helper_object_get_properties (ecma_object_t *obj_p, /**< object */
                                                                          only_enumerable_properties,
                                                                          false);
 
-  ecma_collection_iterator_t iter;
-  ecma_collection_iterator_init (&iter, props_p);
-
-  while (ecma_collection_iterator_next (&iter))
+  for (ecma_length_t i = 0; i < props_p->unit_number; i++)
   {
     ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
 
     ecma_value_t completion = ecma_builtin_helper_def_prop (new_array_p,
                                                             index_string_p,
-                                                            *iter.current_value_p,
+                                                            props_p->buffer_p[i],
                                                             true, /* Writable */
                                                             true, /* Enumerable */
                                                             true, /* Configurable */
@@ -575,75 +572,62 @@ ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index
     }
     else
     {
-      /* create utf8 string from original string and advance to position */
       ECMA_STRING_TO_UTF8_STRING (original_str_p, original_str_utf8_p, original_str_size);
+      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
 
-      ecma_length_t index = start_pos;
+      /* advance to the start position (characters and bytes are the same in ascii strings) */
+      const bool is_ascii = (original_str_size == original_len);
+      const lit_utf8_byte_t *start_p = original_str_utf8_p;
 
-      const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
-      for (ecma_length_t idx = 0; idx < index; idx++)
+      if (is_ascii)
+      {
+        start_p += start_pos;
+      }
+      else
       {
-        lit_utf8_incr (&original_str_curr_p);
+        for (ecma_length_t idx = 0; idx < start_pos; idx++)
+        {
+          lit_utf8_incr (&start_p);
+        }
       }
 
-      /* create utf8 string from search string */
-      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
+      const lit_utf8_byte_t *original_str_end_p = original_str_utf8_p + original_str_size;
+      const lit_utf8_byte_t *match_p;
 
-      const lit_utf8_byte_t *search_str_curr_p = search_str_utf8_p;
+      if (first_index)
+      {
+        match_p = lit_utf8_find_substring (start_p,
+                                           (lit_utf8_size_t) (original_str_end_p - start_p),
+                                           search_str_utf8_p,
+                                           search_str_size);
+      }
+      else
+      {
+        /* the match must start at or before the start position */
+        const lit_utf8_byte_t *search_end_p = JERRY_MIN (start_p + search_str_size, original_str_end_p);
 
-      /* iterate original string and try to match at each position */
-      bool searching = true;
-      ecma_char_t first_char = lit_utf8_read_next (&search_str_curr_p);
-      while (searching)
+        match_p = lit_utf8_find_last_substring (original_str_utf8_p,
+                                                (lit_utf8_size_t) (search_end_p - original_str_utf8_p),
+                                                search_str_utf8_p,
+                                                search_str_size);
+      }
+
+      if (match_p != NULL)
       {
-        /* match as long as possible */
-        ecma_length_t match_len = 0;
-        const lit_utf8_byte_t *stored_original_str_curr_p = original_str_curr_p;
+        match_found = true;
 
-        if (match_len < search_len &&
-            index + match_len < original_len &&
-            lit_utf8_read_next (&original_str_curr_p) == first_char)
+        if (is_ascii)
         {
-          const lit_utf8_byte_t *nested_search_str_curr_p = search_str_curr_p;
-          match_len++;
-
-          while (match_len < search_len &&
-                 index + match_len < original_len &&
-                 lit_utf8_read_next (&original_str_curr_p) == lit_utf8_read_next (&nested_search_str_curr_p))
-          {
-            match_len++;
-          }
+          *ret_index_p = (ecma_length_t) (match_p - original_str_utf8_p);
         }
-
-        /* check for match */
-        if (match_len == search_len)
+        else if (first_index)
         {
-          match_found = true;
-          *ret_index_p = index;
-
-          break;
+          *ret_index_p = start_pos + lit_utf8_string_length (start_p, (lit_utf8_size_t) (match_p - start_p));
         }
         else
         {
-          /* inc/dec index and update iterators and search condition */
-          original_str_curr_p = stored_original_str_curr_p;
-
-          if (first_index)
-          {
-            if ((searching = (index <= original_len - search_len)))
-            {
-              lit_utf8_incr (&original_str_curr_p);
-              index++;
-            }
-          }
-          else
-          {
-            if ((searching = (index > 0)))
-            {
-              lit_utf8_decr (&original_str_curr_p);
-              index--;
-            }
-          }
+          *ret_index_p = lit_utf8_string_length (original_str_utf8_p,
+                                                 (lit_utf8_size_t) (match_p - original_str_utf8_p));
         }
       }
 
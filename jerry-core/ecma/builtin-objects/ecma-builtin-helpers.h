@@ -156,15 +156,46 @@ typedef struct
 extern bool ecma_has_object_value_in_collection (ecma_collection_header_t *, ecma_value_t);
 extern bool ecma_has_string_value_in_collection (ecma_collection_header_t *, ecma_value_t);
 
-extern ecma_string_t *
-ecma_builtin_helper_json_create_hex_digit_ecma_string (uint8_t);
-extern ecma_string_t *
-ecma_builtin_helper_json_create_separated_properties (ecma_collection_header_t *, ecma_string_t *);
+extern void
+ecma_builtin_helper_json_append_hex_digits (ecma_stringbuilder_t *, uint8_t);
 extern ecma_value_t
-ecma_builtin_helper_json_create_formatted_json (ecma_string_t *, ecma_string_t *, ecma_string_t *,
+ecma_builtin_helper_json_create_formatted_json (lit_utf8_byte_t, lit_utf8_byte_t, ecma_string_t *,
                                                 ecma_collection_header_t *, ecma_json_stringify_context_t *);
 extern ecma_value_t
-ecma_builtin_helper_json_create_non_formatted_json (ecma_string_t *, ecma_string_t *, ecma_collection_header_t *);
+ecma_builtin_helper_json_create_non_formatted_json (lit_utf8_byte_t, lit_utf8_byte_t, ecma_collection_header_t *);
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+
+/* ecma-builtin-json.c */
+
+/**
+ * State of the streaming JSON parser
+ */
+typedef struct
+{
+  ecma_external_pointer_t callback_p; /**< event callback */
+  void *user_data_p; /**< pointer passed to the callback */
+  lit_utf8_byte_t *token_buffer_p; /**< characters of the current string, number or literal token */
+  lit_utf8_size_t token_size; /**< size of the current token */
+  lit_utf8_size_t token_capacity; /**< allocated size of the token buffer */
+  uint8_t *stack_p; /**< types of the enclosing containers (true - object, false - array) */
+  uint32_t depth; /**< number of enclosing containers */
+  uint32_t stack_capacity; /**< allocated size of the container stack */
+  uint32_t skip_depth; /**< depth of the skipped container (0 - if no container is skipped) */
+  uint8_t scan_state; /**< state of the character scanner */
+  uint8_t parse_state; /**< state of the grammar */
+  bool skip_value; /**< the value of the last key is skipped */
+} ecma_json_stream_t;
+
+extern ecma_value_t ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_value_t ecma_builtin_json_parse_utf8_buffer (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_value_t ecma_builtin_json_string_from_value (ecma_value_t);
+
+extern ecma_json_stream_t *ecma_builtin_json_stream_create (ecma_external_pointer_t, void *);
+extern ecma_value_t ecma_builtin_json_stream_feed (ecma_json_stream_t *, const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_value_t ecma_builtin_json_stream_finish (ecma_json_stream_t *);
+
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
 
 /* ecma-builtin-helper-error.c */
 
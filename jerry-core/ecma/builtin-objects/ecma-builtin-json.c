@@ -31,6 +31,9 @@
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 #ifndef CONFIG_DISABLE_JSON_BUILTIN
 
 #define ECMA_BUILTINS_INTERNAL
@@ -69,6 +72,11 @@ typedef enum
   colon_token /**< JSON colon */
 } ecma_json_token_type_t;
 
+/**
+ * Number of recently used property names kept by JSON.parse
+ */
+#define ECMA_JSON_KEY_CACHE_SIZE 16
+
 /**
  * JSON token
  */
@@ -77,6 +85,8 @@ typedef struct
   ecma_json_token_type_t type; /**< type of the current token */
   lit_utf8_byte_t *current_p; /**< current position of the string processed by the parser */
   const lit_utf8_byte_t *end_p; /**< end of the string processed by the parser */
+  ecma_string_t *key_cache[ECMA_JSON_KEY_CACHE_SIZE]; /**< recently used property names (indexed by hash),
+                                                       *   so objects with the same keys share their names */
   union
   {
     struct
@@ -130,10 +140,20 @@ static void
 ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument */
 {
   lit_utf8_byte_t *current_p = token_p->current_p;
-  lit_utf8_byte_t *write_p = current_p;
 
   token_p->u.string.start_p = current_p;
 
+  /* Characters are only moved after the first escape sequence, so
+   * the leading run of ordinary characters is just skipped. */
+  while (*current_p > 0x1f
+         && *current_p != LIT_CHAR_DOUBLE_QUOTE
+         && *current_p != LIT_CHAR_BACKSLASH)
+  {
+    current_p++;
+  }
+
+  lit_utf8_byte_t *write_p = current_p;
+
   while (*current_p != LIT_CHAR_DOUBLE_QUOTE)
   {
     if (*current_p <= 0x1f)
@@ -211,12 +231,17 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
 {
   lit_utf8_byte_t *current_p = token_p->current_p;
   lit_utf8_byte_t *start_p = current_p;
+  bool is_negative = false;
+  uint32_t int_value = 0;
 
   if (*current_p == LIT_CHAR_MINUS)
   {
+    is_negative = true;
     current_p++;
   }
 
+  const lit_utf8_byte_t *int_start_p = current_p;
+
   if (*current_p == LIT_CHAR_0)
   {
     current_p++;
@@ -229,11 +254,28 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
   {
     do
     {
+      int_value = int_value * 10 + (uint32_t) (*current_p - LIT_CHAR_0);
       current_p++;
     }
     while (lit_char_is_decimal_digit (*current_p));
   }
 
+  /* Integers with at most 9 digits are converted directly (the value
+   * cannot overflow), others are handled by the generic conversion. */
+  if (*current_p != LIT_CHAR_DOT
+      && *current_p != LIT_CHAR_LOWERCASE_E
+      && *current_p != LIT_CHAR_UPPERCASE_E
+      && current_p > int_start_p
+      && current_p - int_start_p <= 9)
+  {
+    ecma_number_t number = (ecma_number_t) int_value;
+
+    token_p->type = number_token;
+    token_p->u.number = is_negative ? -number : number;
+    token_p->current_p = current_p;
+    return;
+  }
+
   if (*current_p == LIT_CHAR_DOT)
   {
     current_p++;
@@ -434,6 +476,68 @@ ecma_builtin_json_define_value_property (ecma_object_t *obj_p, /**< this object
   JERRY_ASSERT (ecma_is_value_boolean (completion_value));
 } /* ecma_builtin_json_define_value_property */
 
+/**
+ * Create a property name string for JSON.parse.
+ *
+ * Names are looked up in a small cache first, so the objects
+ * of a parsed document share the strings of their common keys.
+ *
+ * @return pointer to ecma-string descriptor
+ *         Returned value must be freed with ecma_deref_ecma_string.
+ */
+static ecma_string_t *
+ecma_builtin_json_get_property_name (ecma_json_token_t *token_p, /**< token argument */
+                                     const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                     lit_utf8_size_t string_size) /**< string size */
+{
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (string_p, string_size);
+  ecma_string_t **entry_p = token_p->key_cache + (hash % ECMA_JSON_KEY_CACHE_SIZE);
+  ecma_string_t *name_p = *entry_p;
+
+  if (name_p != NULL
+      && name_p->hash == hash
+      && name_p->u.utf8_string.size == string_size
+      && memcmp (name_p + 1, string_p, string_size) == 0)
+  {
+    ecma_ref_ecma_string (name_p);
+    return name_p;
+  }
+
+  name_p = ecma_new_ecma_string_from_utf8 (string_p, string_size);
+
+  /* Only strings with heap allocated characters are worth to be cached. */
+  if (ECMA_STRING_GET_CONTAINER (name_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
+  {
+    if (*entry_p != NULL)
+    {
+      ecma_deref_ecma_string (*entry_p);
+    }
+
+    ecma_ref_ecma_string (name_p);
+    *entry_p = name_p;
+  }
+
+  return name_p;
+} /* ecma_builtin_json_get_property_name */
+
+/**
+ * Store a parsed value in a newly created data property.
+ *
+ * The reference of the value is taken over by the property.
+ */
+static void
+ecma_builtin_json_store_value (ecma_property_value_t *prop_value_p, /**< property value reference */
+                               ecma_value_t value) /**< parsed value */
+{
+  /* Properties do not hold references to objects. */
+  prop_value_p->value = value;
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_deref_object (ecma_get_object_from_value (value));
+  }
+} /* ecma_builtin_json_store_value */
+
 /**
  * Parse next value.
  *
@@ -514,10 +618,30 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
-        ecma_string_t *name_p = ecma_new_ecma_string_from_utf8 (string_start_p, string_size);
-        ecma_builtin_json_define_value_property (object_p, name_p, value);
+        /* The object is created by the parser, so the properties can
+         * be created directly instead of using [[DefineOwnProperty]]. */
+        ecma_string_t *name_p = ecma_builtin_json_get_property_name (token_p, string_start_p, string_size);
+        ecma_property_t *property_p = ecma_find_named_property (object_p, name_p);
+
+        if (property_p != NULL)
+        {
+          /* Duplicated names: the last value is kept. */
+          JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+          ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
+          ecma_free_value (value);
+        }
+        else
+        {
+          ecma_property_value_t *prop_value_p;
+          prop_value_p = ecma_create_named_data_property (object_p,
+                                                          name_p,
+                                                          ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                          NULL);
+          ecma_builtin_json_store_value (prop_value_p, value);
+        }
+
         ecma_deref_ecma_string (name_p);
-        ecma_free_value (value);
         parse_comma = true;
       }
 
@@ -541,6 +665,14 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
       {
         if (ecma_builtin_json_check_right_square_token (token_p))
         {
+          ecma_string_t magic_string_length;
+          ecma_init_ecma_length_string (&magic_string_length);
+
+          ecma_property_t *len_prop_p = ecma_find_named_property (array_p, &magic_string_length);
+          JERRY_ASSERT (len_prop_p != NULL
+                        && ECMA_PROPERTY_GET_TYPE (*len_prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+          ecma_value_assign_uint32 (&ECMA_PROPERTY_VALUE_PTR (len_prop_p)->value, length);
           return ecma_make_object_value (array_p);
         }
 
@@ -560,22 +692,18 @@ ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument *
           break;
         }
 
+        /* The length is updated when the array is completed. */
         ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length);
 
-        ecma_value_t completion = ecma_builtin_helper_def_prop (array_p,
-                                                                index_str_p,
-                                                                value,
-                                                                true, /* Writable */
-                                                                true, /* Enumerable */
-                                                                true, /* Configurable */
-                                                                false); /* Failure handling */
-
-        JERRY_ASSERT (ecma_is_value_true (completion));
+        ecma_property_value_t *prop_value_p;
+        prop_value_p = ecma_create_named_data_property (array_p,
+                                                        index_str_p,
+                                                        ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                        NULL);
+        ecma_builtin_json_store_value (prop_value_p, value);
 
         ecma_deref_ecma_string (index_str_p);
 
-        ecma_free_value (value);
-
         length++;
         parse_comma = true;
       }
@@ -613,174 +741,951 @@ ecma_builtin_json_walk (ecma_object_t *reviver_p, /**< reviver function */
 
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-  ECMA_TRY_CATCH (value_get,
-                  ecma_op_object_get (holder_p, name_p),
-                  ret_value);
+  ECMA_TRY_CATCH (value_get,
+                  ecma_op_object_get (holder_p, name_p),
+                  ret_value);
+
+  if (ecma_is_value_object (value_get))
+  {
+    ecma_object_t *object_p = ecma_get_object_from_value (value_get);
+
+    ecma_collection_header_t *props_p = ecma_op_object_get_property_names (object_p, false, true, false);
+
+    for (ecma_length_t i = 0;
+         i < props_p->unit_number && ecma_is_value_empty (ret_value);
+         i++)
+    {
+      ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
+
+      ECMA_TRY_CATCH (value_walk,
+                      ecma_builtin_json_walk (reviver_p,
+                                              object_p,
+                                              property_name_p),
+                      ret_value);
+
+      /*
+       * We cannot optimize this function since any members
+       * can be changed (deleted) by the reviver function.
+       */
+      if (ecma_is_value_undefined (value_walk))
+      {
+        ecma_value_t delete_val = ecma_op_general_object_delete (object_p,
+                                                                 property_name_p,
+                                                                 false);
+        JERRY_ASSERT (ecma_is_value_boolean (delete_val));
+      }
+      else
+      {
+        ecma_builtin_json_define_value_property (object_p,
+                                                 property_name_p,
+                                                 value_walk);
+      }
+
+      ECMA_FINALIZE (value_walk);
+    }
+
+    ecma_free_values_collection (props_p, true);
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ecma_value_t arguments_list[2];
+
+    arguments_list[0] = ecma_make_string_value (name_p);
+    arguments_list[1] = value_get;
+
+    /*
+     * The completion value can be anything including exceptions.
+     */
+    ret_value = ecma_op_function_call (reviver_p,
+                                       ecma_make_object_value (holder_p),
+                                       arguments_list,
+                                       2);
+  }
+  else
+  {
+    JERRY_ASSERT (ECMA_IS_VALUE_ERROR (ret_value));
+  }
+
+  ECMA_FINALIZE (value_get);
+
+  return ret_value;
+} /* ecma_builtin_json_walk */
+
+/**
+ * Parse a JSON text stored in a writable, zero terminated cesu-8 buffer
+ *
+ * Note:
+ *      the tokenizer unescapes the string literals in place
+ *
+ * @return parsed value - if the text is a valid JSON text
+ *         syntax error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parse_text (lit_utf8_byte_t *str_start_p, /**< JSON text */
+                              lit_utf8_size_t str_size) /**< size of the JSON text */
+{
+  JERRY_ASSERT (str_start_p[str_size] == LIT_BYTE_NULL);
+
+  ecma_json_token_t token;
+  token.current_p = str_start_p;
+  token.end_p = str_start_p + str_size;
+  memset (token.key_cache, 0, sizeof (token.key_cache));
+
+  ecma_value_t final_result = ecma_builtin_json_parse_value (&token);
+
+  for (uint32_t i = 0; i < ECMA_JSON_KEY_CACHE_SIZE; i++)
+  {
+    if (token.key_cache[i] != NULL)
+    {
+      ecma_deref_ecma_string (token.key_cache[i]);
+    }
+  }
+
+  if (!ecma_is_value_undefined (final_result))
+  {
+    ecma_builtin_json_parse_next_token (&token);
+
+    if (token.type != end_token)
+    {
+      ecma_free_value (final_result);
+      final_result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+  }
+
+  if (ecma_is_value_undefined (final_result))
+  {
+    return ecma_raise_syntax_error (ECMA_ERR_MSG (""));
+  }
+
+  return final_result;
+} /* ecma_builtin_json_parse_text */
+
+/**
+ * Parse a JSON text stored in a cesu-8 character buffer
+ *
+ * Note:
+ *      the buffer is copied before parsing, since the
+ *      tokenizer unescapes the string literals in place
+ *
+ * @return parsed value - if the text is a valid JSON text
+ *         syntax error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_parse_buffer (const lit_utf8_byte_t *buffer_p, /**< JSON text */
+                                lit_utf8_size_t buffer_size) /**< size of the JSON text */
+{
+  ecma_value_t final_result;
+
+  JMEM_DEFINE_LOCAL_ARRAY (str_start_p, buffer_size + 1, lit_utf8_byte_t);
+
+  memcpy (str_start_p, buffer_p, buffer_size);
+  str_start_p[buffer_size] = LIT_BYTE_NULL;
+
+  final_result = ecma_builtin_json_parse_text (str_start_p, buffer_size);
+
+  JMEM_FINALIZE_LOCAL_ARRAY (str_start_p);
+
+  return final_result;
+} /* ecma_builtin_json_parse_buffer */
+
+/**
+ * Parse a JSON text stored in a utf-8 character buffer of the application
+ *
+ * Note:
+ *      the 4-byte utf-8 characters are converted to surrogate pairs while the
+ *      buffer is copied. Surrogate pairs are accepted as well, so the cesu-8
+ *      text produced by the engine (e.g. by JSON stringify) can be parsed back.
+ *
+ * @return parsed value - if the text is a valid utf-8 encoded JSON text
+ *         syntax error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_parse_utf8_buffer (const lit_utf8_byte_t *buffer_p, /**< JSON text */
+                                     lit_utf8_size_t buffer_size) /**< size of the JSON text */
+{
+  if (!lit_is_utf8_or_cesu8_string_valid (buffer_p, buffer_size))
+  {
+    return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid UTF-8 string."));
+  }
+
+  ecma_value_t final_result;
+  lit_utf8_size_t str_size = lit_get_utf8_string_cesu8_size (buffer_p, buffer_size);
+
+  JMEM_DEFINE_LOCAL_ARRAY (str_start_p, str_size + 1, lit_utf8_byte_t);
+
+  lit_utf8_size_t converted_size = lit_convert_utf8_string_to_cesu8 (buffer_p, buffer_size, str_start_p);
+  JERRY_ASSERT (converted_size == str_size);
+  str_start_p[str_size] = LIT_BYTE_NULL;
+
+  final_result = ecma_builtin_json_parse_text (str_start_p, str_size);
+
+  JMEM_FINALIZE_LOCAL_ARRAY (str_start_p);
+
+  return final_result;
+} /* ecma_builtin_json_parse_utf8_buffer */
+
+/**
+ * The JSON object's 'parse' routine
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
+                         ecma_value_t arg1, /**< string argument */
+                         ecma_value_t arg2) /**< reviver argument */
+{
+  JERRY_UNUSED (this_arg);
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_TRY_CATCH (string,
+                  ecma_op_to_string (arg1),
+                  ret_value);
+
+  ecma_string_t *string_p = ecma_get_string_from_value (string);
+
+  ECMA_STRING_TO_UTF8_STRING (string_p, str_start_p, string_size);
+
+  ECMA_TRY_CATCH (final_result,
+                  ecma_builtin_json_parse_buffer (str_start_p, string_size),
+                  ret_value);
+
+  if (ecma_op_is_callable (arg2))
+  {
+    ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+    ecma_string_t *name_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    ecma_property_value_t *prop_value_p;
+    prop_value_p = ecma_create_named_data_property (object_p,
+                                                    name_p,
+                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                    NULL);
+
+    ecma_named_data_property_assign_value (object_p, prop_value_p, final_result);
+
+    ret_value = ecma_builtin_json_walk (ecma_get_object_from_value (arg2),
+                                        object_p,
+                                        name_p);
+    ecma_deref_object (object_p);
+    ecma_deref_ecma_string (name_p);
+  }
+  else
+  {
+    ret_value = ecma_copy_value (final_result);
+  }
+
+  ECMA_FINALIZE (final_result);
+
+  ECMA_FINALIZE_UTF8_STRING (str_start_p, string_size);
+
+  ECMA_FINALIZE (string);
+  return ret_value;
+} /* ecma_builtin_json_parse */
+
+/**
+ * States of the character scanner of the streaming JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_SCAN_NONE, /**< between two tokens */
+  ECMA_JSON_SCAN_STRING, /**< inside a string token */
+  ECMA_JSON_SCAN_STRING_ESCAPE, /**< after a backslash inside a string token */
+  ECMA_JSON_SCAN_LITERAL /**< inside a number or a true, false or null literal */
+} ecma_json_scan_state_t;
+
+/**
+ * Grammar states of the streaming JSON parser
+ */
+typedef enum
+{
+  ECMA_JSON_PARSE_VALUE, /**< a value is expected */
+  ECMA_JSON_PARSE_FIRST_VALUE, /**< a value or the end of an array is expected */
+  ECMA_JSON_PARSE_KEY, /**< a property name is expected */
+  ECMA_JSON_PARSE_FIRST_KEY, /**< a property name or the end of an object is expected */
+  ECMA_JSON_PARSE_COLON, /**< a colon is expected */
+  ECMA_JSON_PARSE_SEPARATOR, /**< a comma or the end of the enclosing container is expected */
+  ECMA_JSON_PARSE_DONE, /**< the document is complete, only white spaces can follow */
+  ECMA_JSON_PARSE_STOPPED, /**< parsing was stopped by the callback */
+  ECMA_JSON_PARSE_ERROR /**< the document is invalid */
+} ecma_json_parse_state_t;
+
+/**
+ * Initial size of the buffers of the streaming JSON parser
+ */
+#define ECMA_JSON_STREAM_INITIAL_CAPACITY 32
+
+/**
+ * Grow a buffer of the streaming JSON parser, keeping its content.
+ *
+ * @return pointer to the new buffer
+ */
+static void *
+ecma_builtin_json_stream_grow (void *buffer_p, /**< current buffer (NULL - if not allocated yet) */
+                               uint32_t used_size, /**< used size of the current buffer */
+                               uint32_t required_size, /**< required size */
+                               uint32_t *capacity_p) /**< [in, out] allocated size of the buffer */
+{
+  uint32_t new_capacity = (*capacity_p == 0) ? ECMA_JSON_STREAM_INITIAL_CAPACITY : *capacity_p;
+
+  while (new_capacity < required_size)
+  {
+    new_capacity *= 2;
+  }
+
+  void *new_buffer_p = jmem_heap_alloc_block (new_capacity);
+
+  if (buffer_p != NULL)
+  {
+    memcpy (new_buffer_p, buffer_p, used_size);
+    jmem_heap_free_block (buffer_p, *capacity_p);
+  }
+
+  *capacity_p = new_capacity;
+  return new_buffer_p;
+} /* ecma_builtin_json_stream_grow */
+
+/**
+ * Append characters to the current token of the streaming JSON parser.
+ */
+static void
+ecma_builtin_json_stream_append (ecma_json_stream_t *stream_p, /**< stream */
+                                 const lit_utf8_byte_t *chars_p, /**< characters */
+                                 lit_utf8_size_t size) /**< number of characters */
+{
+  /* One extra byte is kept for the zero terminator required by the tokenizer. */
+  lit_utf8_size_t required_size = stream_p->token_size + size + 1;
+
+  if (required_size > stream_p->token_capacity)
+  {
+    stream_p->token_buffer_p = ecma_builtin_json_stream_grow (stream_p->token_buffer_p,
+                                                              stream_p->token_size,
+                                                              required_size,
+                                                              &stream_p->token_capacity);
+  }
+
+  memcpy (stream_p->token_buffer_p + stream_p->token_size, chars_p, size);
+  stream_p->token_size += size;
+} /* ecma_builtin_json_stream_append */
+
+/**
+ * Report an event to the callback of the streaming JSON parser.
+ *
+ * The value is freed after the callback returns.
+ */
+static void
+ecma_builtin_json_stream_emit (ecma_json_stream_t *stream_p, /**< stream */
+                               ecma_json_stream_event_t event, /**< event */
+                               ecma_value_t value) /**< value of the event */
+{
+  ecma_json_stream_action_t action = jerry_dispatch_json_stream_callback (stream_p->callback_p,
+                                                                          event,
+                                                                          value,
+                                                                          stream_p->user_data_p);
+  ecma_free_value (value);
+
+  if (action == ECMA_JSON_STREAM_STOP)
+  {
+    stream_p->parse_state = ECMA_JSON_PARSE_STOPPED;
+  }
+  else if (action == ECMA_JSON_STREAM_SKIP)
+  {
+    if (event == ECMA_JSON_STREAM_OBJECT_START || event == ECMA_JSON_STREAM_ARRAY_START)
+    {
+      stream_p->skip_depth = stream_p->depth;
+    }
+    else if (event == ECMA_JSON_STREAM_KEY)
+    {
+      stream_p->skip_value = true;
+    }
+  }
+} /* ecma_builtin_json_stream_emit */
+
+/**
+ * Update the grammar state of the streaming JSON parser after a value is completed.
+ */
+static void
+ecma_builtin_json_stream_value_completed (ecma_json_stream_t *stream_p) /**< stream */
+{
+  stream_p->parse_state = (stream_p->depth == 0) ? ECMA_JSON_PARSE_DONE : ECMA_JSON_PARSE_SEPARATOR;
+} /* ecma_builtin_json_stream_value_completed */
+
+/**
+ * Start an object or an array in the streaming JSON parser.
+ */
+static void
+ecma_builtin_json_stream_open (ecma_json_stream_t *stream_p, /**< stream */
+                               bool is_object) /**< true - if an object is started, false - if an array */
+{
+  if (stream_p->depth == stream_p->stack_capacity)
+  {
+    stream_p->stack_p = ecma_builtin_json_stream_grow (stream_p->stack_p,
+                                                       stream_p->depth,
+                                                       stream_p->depth + 1,
+                                                       &stream_p->stack_capacity);
+  }
+
+  stream_p->stack_p[stream_p->depth++] = is_object;
+  stream_p->parse_state = is_object ? ECMA_JSON_PARSE_FIRST_KEY : ECMA_JSON_PARSE_FIRST_VALUE;
+
+  bool skip_value = stream_p->skip_value;
+  stream_p->skip_value = false;
+
+  if (stream_p->skip_depth != 0)
+  {
+    return;
+  }
+
+  if (skip_value)
+  {
+    stream_p->skip_depth = stream_p->depth;
+    return;
+  }
+
+  ecma_builtin_json_stream_emit (stream_p,
+                                 is_object ? ECMA_JSON_STREAM_OBJECT_START : ECMA_JSON_STREAM_ARRAY_START,
+                                 ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+} /* ecma_builtin_json_stream_open */
+
+/**
+ * Finish the innermost object or array in the streaming JSON parser.
+ */
+static void
+ecma_builtin_json_stream_close (ecma_json_stream_t *stream_p, /**< stream */
+                                bool is_object) /**< true - if an object is finished, false - if an array */
+{
+  bool is_reported = (stream_p->skip_depth == 0);
+
+  if (stream_p->skip_depth == stream_p->depth)
+  {
+    stream_p->skip_depth = 0;
+  }
+
+  stream_p->depth--;
+  ecma_builtin_json_stream_value_completed (stream_p);
+
+  if (is_reported)
+  {
+    ecma_builtin_json_stream_emit (stream_p,
+                                   is_object ? ECMA_JSON_STREAM_OBJECT_END : ECMA_JSON_STREAM_ARRAY_END,
+                                   ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  }
+} /* ecma_builtin_json_stream_close */
+
+/**
+ * Process a structural character (brace, square bracket, comma or colon) in the streaming JSON parser.
+ */
+static void
+ecma_builtin_json_stream_process_char (ecma_json_stream_t *stream_p, /**< stream */
+                                       lit_utf8_byte_t chr) /**< structural character */
+{
+  uint8_t parse_state = stream_p->parse_state;
+
+  switch (chr)
+  {
+    case LIT_CHAR_LEFT_BRACE:
+    case LIT_CHAR_LEFT_SQUARE:
+    {
+      if (parse_state == ECMA_JSON_PARSE_VALUE || parse_state == ECMA_JSON_PARSE_FIRST_VALUE)
+      {
+        ecma_builtin_json_stream_open (stream_p, chr == LIT_CHAR_LEFT_BRACE);
+        return;
+      }
+      break;
+    }
+    case LIT_CHAR_RIGHT_BRACE:
+    {
+      if ((parse_state == ECMA_JSON_PARSE_SEPARATOR || parse_state == ECMA_JSON_PARSE_FIRST_KEY)
+          && stream_p->stack_p[stream_p->depth - 1])
+      {
+        ecma_builtin_json_stream_close (stream_p, true);
+        return;
+      }
+      break;
+    }
+    case LIT_CHAR_RIGHT_SQUARE:
+    {
+      if ((parse_state == ECMA_JSON_PARSE_SEPARATOR || parse_state == ECMA_JSON_PARSE_FIRST_VALUE)
+          && !stream_p->stack_p[stream_p->depth - 1])
+      {
+        ecma_builtin_json_stream_close (stream_p, false);
+        return;
+      }
+      break;
+    }
+    case LIT_CHAR_COMMA:
+    {
+      if (parse_state == ECMA_JSON_PARSE_SEPARATOR)
+      {
+        stream_p->parse_state = (stream_p->stack_p[stream_p->depth - 1] ? ECMA_JSON_PARSE_KEY
+                                                                         : ECMA_JSON_PARSE_VALUE);
+        return;
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (chr == LIT_CHAR_COLON);
+
+      if (parse_state == ECMA_JSON_PARSE_COLON)
+      {
+        stream_p->parse_state = ECMA_JSON_PARSE_VALUE;
+        return;
+      }
+      break;
+    }
+  }
+
+  stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+} /* ecma_builtin_json_stream_process_char */
+
+/**
+ * Process the collected string, number or literal token in the streaming JSON parser.
+ *
+ * Note:
+ *      the token is validated as utf-8 and converted to cesu-8 before it is
+ *      tokenized, including the tokens of skipped values
+ */
+static void
+ecma_builtin_json_stream_process_token (ecma_json_stream_t *stream_p) /**< stream */
+{
+  lit_utf8_byte_t *buffer_p = stream_p->token_buffer_p;
+  lit_utf8_size_t size = stream_p->token_size;
+
+  JERRY_ASSERT (size > 0 && size < stream_p->token_capacity);
+
+  stream_p->token_size = 0;
+
+  if (!lit_is_utf8_string_valid (buffer_p, size))
+  {
+    stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+    return;
+  }
+
+  lit_utf8_size_t cesu8_size = lit_get_utf8_string_cesu8_size (buffer_p, size);
+
+  if (cesu8_size != size)
+  {
+    /* Characters outside of the BMP are stored as surrogate pairs. */
+    uint32_t cesu8_capacity = 0;
+    lit_utf8_byte_t *cesu8_buffer_p = ecma_builtin_json_stream_grow (NULL, 0, cesu8_size + 1, &cesu8_capacity);
+
+    lit_convert_utf8_string_to_cesu8 (buffer_p, size, cesu8_buffer_p);
+    jmem_heap_free_block (buffer_p, stream_p->token_capacity);
+
+    stream_p->token_buffer_p = buffer_p = cesu8_buffer_p;
+    stream_p->token_capacity = cesu8_capacity;
+    size = cesu8_size;
+  }
+
+  buffer_p[size] = LIT_BYTE_NULL;
+
+  ecma_json_token_t token;
+  token.current_p = buffer_p;
+  token.end_p = buffer_p + size;
+
+  ecma_builtin_json_parse_next_token (&token);
+
+  uint8_t parse_state = stream_p->parse_state;
+
+  if (token.current_p != token.end_p)
+  {
+    /* Invalid token or garbage after a valid token (e.g. 'truex'). */
+    stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+    return;
+  }
+
+  if (parse_state == ECMA_JSON_PARSE_KEY || parse_state == ECMA_JSON_PARSE_FIRST_KEY)
+  {
+    if (token.type != string_token)
+    {
+      stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+      return;
+    }
+
+    stream_p->parse_state = ECMA_JSON_PARSE_COLON;
+
+    if (stream_p->skip_depth != 0)
+    {
+      return;
+    }
+
+    ecma_string_t *name_p = ecma_new_ecma_string_from_utf8 (token.u.string.start_p, token.u.string.size);
+    ecma_builtin_json_stream_emit (stream_p, ECMA_JSON_STREAM_KEY, ecma_make_string_value (name_p));
+    return;
+  }
+
+  if (parse_state != ECMA_JSON_PARSE_VALUE && parse_state != ECMA_JSON_PARSE_FIRST_VALUE)
+  {
+    stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+    return;
+  }
+
+  bool is_reported = (stream_p->skip_depth == 0 && !stream_p->skip_value);
+
+  stream_p->skip_value = false;
+  ecma_builtin_json_stream_value_completed (stream_p);
+
+  if (!is_reported)
+  {
+    return;
+  }
+
+  ecma_value_t value;
+
+  switch (token.type)
+  {
+    case number_token:
+    {
+      value = ecma_make_number_value (token.u.number);
+      break;
+    }
+    case string_token:
+    {
+      ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (token.u.string.start_p, token.u.string.size);
+      value = ecma_make_string_value (string_p);
+      break;
+    }
+    case null_token:
+    {
+      value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL);
+      break;
+    }
+    case true_token:
+    {
+      value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (token.type == false_token);
+      value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
+      break;
+    }
+  }
+
+  ecma_builtin_json_stream_emit (stream_p, ECMA_JSON_STREAM_VALUE, value);
+} /* ecma_builtin_json_stream_process_token */
+
+/**
+ * Compute the result of the streaming JSON parser from its grammar state.
+ *
+ * @return true - if parsing can be continued
+ *         false - if it was stopped by the callback
+ *         syntax error - if the document is invalid
+ */
+static ecma_value_t
+ecma_builtin_json_stream_get_status (ecma_json_stream_t *stream_p) /**< stream */
+{
+  if (stream_p->parse_state == ECMA_JSON_PARSE_ERROR)
+  {
+    return ecma_raise_syntax_error (ECMA_ERR_MSG (""));
+  }
+
+  return ecma_make_boolean_value (stream_p->parse_state != ECMA_JSON_PARSE_STOPPED);
+} /* ecma_builtin_json_stream_get_status */
+
+/**
+ * Create a streaming JSON parser, which reports the structure of a
+ * JSON text fed in chunks instead of building the resulting value.
+ *
+ * Note:
+ *      the memory used by the parser is proportional to the nesting depth
+ *      of the document and to the size of its longest string or number
+ *
+ * @return new stream, which must be released by ecma_builtin_json_stream_finish
+ */
+ecma_json_stream_t *
+ecma_builtin_json_stream_create (ecma_external_pointer_t callback_p, /**< event callback */
+                                 void *user_data_p) /**< pointer passed to the callback */
+{
+  ecma_json_stream_t *stream_p = (ecma_json_stream_t *) jmem_heap_alloc_block (sizeof (ecma_json_stream_t));
+
+  stream_p->callback_p = callback_p;
+  stream_p->user_data_p = user_data_p;
+  stream_p->token_buffer_p = NULL;
+  stream_p->token_size = 0;
+  stream_p->token_capacity = 0;
+  stream_p->stack_p = NULL;
+  stream_p->depth = 0;
+  stream_p->stack_capacity = 0;
+  stream_p->skip_depth = 0;
+  stream_p->scan_state = ECMA_JSON_SCAN_NONE;
+  stream_p->parse_state = ECMA_JSON_PARSE_VALUE;
+  stream_p->skip_value = false;
+
+  return stream_p;
+} /* ecma_builtin_json_stream_create */
+
+/**
+ * Feed the next chunk of a JSON text to a streaming JSON parser.
+ *
+ * Tokens may be split between chunks. Nothing is done after parsing
+ * is stopped by the callback or an error is detected.
+ *
+ * @return true - if the chunk is processed
+ *         false - if parsing was stopped by the callback
+ *         syntax error - if the document is invalid
+ */
+ecma_value_t
+ecma_builtin_json_stream_feed (ecma_json_stream_t *stream_p, /**< stream */
+                               const lit_utf8_byte_t *chars_p, /**< next chunk of the JSON text */
+                               lit_utf8_size_t size) /**< size of the chunk */
+{
+  const lit_utf8_byte_t *end_p = chars_p + size;
 
-  if (ecma_is_value_object (value_get))
+  while (chars_p < end_p
+         && stream_p->parse_state != ECMA_JSON_PARSE_STOPPED
+         && stream_p->parse_state != ECMA_JSON_PARSE_ERROR)
   {
-    ecma_object_t *object_p = ecma_get_object_from_value (value_get);
+    switch (stream_p->scan_state)
+    {
+      case ECMA_JSON_SCAN_STRING:
+      {
+        /* The characters of a string are copied in runs up to the next quote or backslash. */
+        const lit_utf8_byte_t *start_p = chars_p;
 
-    ecma_collection_header_t *props_p = ecma_op_object_get_property_names (object_p, false, true, false);
+        while (chars_p < end_p
+               && *chars_p != LIT_CHAR_DOUBLE_QUOTE
+               && *chars_p != LIT_CHAR_BACKSLASH)
+        {
+          chars_p++;
+        }
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, props_p);
+        lit_utf8_byte_t last_chr = LIT_BYTE_NULL;
 
-    while (ecma_collection_iterator_next (&iter)
-           && ecma_is_value_empty (ret_value))
-    {
-      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+        if (chars_p < end_p)
+        {
+          last_chr = *chars_p++;
+        }
 
-      ECMA_TRY_CATCH (value_walk,
-                      ecma_builtin_json_walk (reviver_p,
-                                              object_p,
-                                              property_name_p),
-                      ret_value);
+        ecma_builtin_json_stream_append (stream_p, start_p, (lit_utf8_size_t) (chars_p - start_p));
 
-      /*
-       * We cannot optimize this function since any members
-       * can be changed (deleted) by the reviver function.
-       */
-      if (ecma_is_value_undefined (value_walk))
+        if (last_chr == LIT_CHAR_BACKSLASH)
+        {
+          stream_p->scan_state = ECMA_JSON_SCAN_STRING_ESCAPE;
+        }
+        else if (last_chr == LIT_CHAR_DOUBLE_QUOTE)
+        {
+          stream_p->scan_state = ECMA_JSON_SCAN_NONE;
+          ecma_builtin_json_stream_process_token (stream_p);
+        }
+        break;
+      }
+      case ECMA_JSON_SCAN_STRING_ESCAPE:
       {
-        ecma_value_t delete_val = ecma_op_general_object_delete (object_p,
-                                                                 property_name_p,
-                                                                 false);
-        JERRY_ASSERT (ecma_is_value_boolean (delete_val));
+        ecma_builtin_json_stream_append (stream_p, chars_p, 1);
+        chars_p++;
+        stream_p->scan_state = ECMA_JSON_SCAN_STRING;
+        break;
       }
-      else
+      case ECMA_JSON_SCAN_LITERAL:
       {
-        ecma_builtin_json_define_value_property (object_p,
-                                                 property_name_p,
-                                                 value_walk);
+        const lit_utf8_byte_t *start_p = chars_p;
+
+        while (chars_p < end_p
+               && *chars_p != LIT_CHAR_SP
+               && *chars_p != LIT_CHAR_CR
+               && *chars_p != LIT_CHAR_LF
+               && *chars_p != LIT_CHAR_TAB
+               && *chars_p != LIT_CHAR_LEFT_BRACE
+               && *chars_p != LIT_CHAR_RIGHT_BRACE
+               && *chars_p != LIT_CHAR_LEFT_SQUARE
+               && *chars_p != LIT_CHAR_RIGHT_SQUARE
+               && *chars_p != LIT_CHAR_COMMA
+               && *chars_p != LIT_CHAR_COLON
+               && *chars_p != LIT_CHAR_DOUBLE_QUOTE)
+        {
+          chars_p++;
+        }
+
+        ecma_builtin_json_stream_append (stream_p, start_p, (lit_utf8_size_t) (chars_p - start_p));
+
+        /* The delimiter is processed in the next iteration. */
+        if (chars_p < end_p)
+        {
+          stream_p->scan_state = ECMA_JSON_SCAN_NONE;
+          ecma_builtin_json_stream_process_token (stream_p);
+        }
+        break;
       }
+      default:
+      {
+        JERRY_ASSERT (stream_p->scan_state == ECMA_JSON_SCAN_NONE);
 
-      ECMA_FINALIZE (value_walk);
+        switch (*chars_p)
+        {
+          case LIT_CHAR_SP:
+          case LIT_CHAR_CR:
+          case LIT_CHAR_LF:
+          case LIT_CHAR_TAB:
+          {
+            chars_p++;
+            break;
+          }
+          case LIT_CHAR_LEFT_BRACE:
+          case LIT_CHAR_RIGHT_BRACE:
+          case LIT_CHAR_LEFT_SQUARE:
+          case LIT_CHAR_RIGHT_SQUARE:
+          case LIT_CHAR_COMMA:
+          case LIT_CHAR_COLON:
+          {
+            ecma_builtin_json_stream_process_char (stream_p, *chars_p++);
+            break;
+          }
+          case LIT_CHAR_DOUBLE_QUOTE:
+          {
+            ecma_builtin_json_stream_append (stream_p, chars_p, 1);
+            chars_p++;
+            stream_p->scan_state = ECMA_JSON_SCAN_STRING;
+            break;
+          }
+          default:
+          {
+            stream_p->scan_state = ECMA_JSON_SCAN_LITERAL;
+            break;
+          }
+        }
+        break;
+      }
     }
-
-    ecma_free_values_collection (props_p, true);
   }
 
-  if (ecma_is_value_empty (ret_value))
+  return ecma_builtin_json_stream_get_status (stream_p);
+} /* ecma_builtin_json_stream_feed */
+
+/**
+ * Signal the end of the JSON text to a streaming JSON parser and release it.
+ *
+ * @return true - if the document is complete
+ *         false - if parsing was stopped by the callback
+ *         syntax error - if the document is invalid or incomplete
+ */
+ecma_value_t
+ecma_builtin_json_stream_finish (ecma_json_stream_t *stream_p) /**< stream */
+{
+  if (stream_p->parse_state != ECMA_JSON_PARSE_STOPPED
+      && stream_p->parse_state != ECMA_JSON_PARSE_ERROR)
   {
-    ecma_value_t arguments_list[2];
+    /* A number or literal at the end of the text has no delimiter after it. */
+    if (stream_p->scan_state == ECMA_JSON_SCAN_LITERAL)
+    {
+      stream_p->scan_state = ECMA_JSON_SCAN_NONE;
+      ecma_builtin_json_stream_process_token (stream_p);
+    }
 
-    arguments_list[0] = ecma_make_string_value (name_p);
-    arguments_list[1] = value_get;
+    if (stream_p->parse_state != ECMA_JSON_PARSE_STOPPED
+        && (stream_p->scan_state != ECMA_JSON_SCAN_NONE || stream_p->parse_state != ECMA_JSON_PARSE_DONE))
+    {
+      stream_p->parse_state = ECMA_JSON_PARSE_ERROR;
+    }
+  }
 
-    /*
-     * The completion value can be anything including exceptions.
-     */
-    ret_value = ecma_op_function_call (reviver_p,
-                                       ecma_make_object_value (holder_p),
-                                       arguments_list,
-                                       2);
+  ecma_value_t ret_value = ecma_builtin_json_stream_get_status (stream_p);
+
+  if (stream_p->token_buffer_p != NULL)
+  {
+    jmem_heap_free_block (stream_p->token_buffer_p, stream_p->token_capacity);
   }
-  else
+
+  if (stream_p->stack_p != NULL)
   {
-    JERRY_ASSERT (ECMA_IS_VALUE_ERROR (ret_value));
+    jmem_heap_free_block (stream_p->stack_p, stream_p->stack_capacity);
   }
 
-  ECMA_FINALIZE (value_get);
+  jmem_heap_free_block (stream_p, sizeof (ecma_json_stream_t));
 
   return ret_value;
-} /* ecma_builtin_json_walk */
+} /* ecma_builtin_json_stream_finish */
+
+static ecma_value_t
+ecma_builtin_json_str (ecma_string_t *key_p, ecma_object_t *holder_p, ecma_json_stringify_context_t *context_p);
+
+static ecma_value_t
+ecma_builtin_json_object (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
+
+static ecma_value_t
+ecma_builtin_json_array (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
 
 /**
- * The JSON object's 'parse' routine
- *
- * See also:
- *          ECMA-262 v5, 15.12.2
+ * Helper routine for the 'stringify' routine, which serializes
+ * the value after the context is set up (steps 9 - 11)
  *
- * @return ecma value
+ * @return string value - if the value is serializable
+ *         undefined - if it has no JSON representation
+ *         thrown error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
-ecma_builtin_json_parse (ecma_value_t this_arg, /**< 'this' argument */
-                         ecma_value_t arg1, /**< string argument */
-                         ecma_value_t arg2) /**< reviver argument */
+ecma_builtin_json_str_helper (ecma_value_t arg1, /**< value */
+                              ecma_json_stringify_context_t *context_p) /**< context */
 {
-  JERRY_UNUSED (this_arg);
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-  ECMA_TRY_CATCH (string,
-                  ecma_op_to_string (arg1),
-                  ret_value);
-
-  const ecma_string_t *string_p = ecma_get_string_from_value (string);
-  const ecma_length_t string_size = (ecma_length_t) ecma_string_get_size (string_p);
-  const lit_utf8_size_t buffer_size = sizeof (lit_utf8_byte_t) * (string_size + 1);
+  /* 9. */
+  ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
+  ecma_string_t *empty_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
 
-  JMEM_DEFINE_LOCAL_ARRAY (str_start_p, buffer_size, lit_utf8_byte_t);
+  /* 10. */
+  ecma_value_t put_comp_val = ecma_op_object_put (obj_wrapper_p,
+                                                  empty_str_p,
+                                                  arg1,
+                                                  false);
 
-  const lit_utf8_size_t sz = ecma_string_copy_to_utf8_buffer (string_p, str_start_p, buffer_size);
-  JERRY_ASSERT (sz == string_size);
+  JERRY_ASSERT (ecma_is_value_true (put_comp_val));
+  ecma_free_value (put_comp_val);
 
-  str_start_p[string_size] = LIT_BYTE_NULL;
+  /* 11. */
+  ECMA_TRY_CATCH (str_val,
+                  ecma_builtin_json_str (empty_str_p, obj_wrapper_p, context_p),
+                  ret_value);
 
-  ecma_json_token_t token;
-  token.current_p = str_start_p;
-  token.end_p = str_start_p + string_size;
+  ret_value = ecma_copy_value (str_val);
 
-  ecma_value_t final_result = ecma_builtin_json_parse_value (&token);
+  ECMA_FINALIZE (str_val);
 
-  if (!ecma_is_value_undefined (final_result))
-  {
-    ecma_builtin_json_parse_next_token (&token);
+  ecma_deref_object (obj_wrapper_p);
+  ecma_deref_ecma_string (empty_str_p);
 
-    if (token.type != end_token)
-    {
-      ecma_free_value (final_result);
-      final_result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
-    }
-  }
+  return ret_value;
+} /* ecma_builtin_json_str_helper */
 
-  if (ecma_is_value_undefined (final_result))
-  {
-    ret_value = ecma_raise_syntax_error (ECMA_ERR_MSG (""));
-  }
-  else
-  {
-    if (ecma_op_is_callable (arg2))
-    {
-      ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
-      ecma_string_t *name_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+/**
+ * Serialize a value into JSON text without replacer and indentation,
+ * as JSON.stringify does when only the value argument is passed
+ *
+ * @return string value - if the value is serializable
+ *         undefined - if it has no JSON representation
+ *         thrown error - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_string_from_value (ecma_value_t value) /**< value to serialize */
+{
+  ecma_json_stringify_context_t context;
 
-      ecma_property_value_t *prop_value_p;
-      prop_value_p = ecma_create_named_data_property (object_p,
-                                                      name_p,
-                                                      ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                      NULL);
+  context.occurence_stack_p = ecma_new_values_collection (NULL, 0, false);
+  context.indent_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  context.property_list_p = ecma_new_values_collection (NULL, 0, false);
+  context.replacer_function_p = NULL;
+  context.gap_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
 
-      ecma_named_data_property_assign_value (object_p, prop_value_p, final_result);
-      ecma_free_value (final_result);
+  ecma_value_t ret_value = ecma_builtin_json_str_helper (value, &context);
 
-      ret_value = ecma_builtin_json_walk (ecma_get_object_from_value (arg2),
-                                          object_p,
-                                          name_p);
-      ecma_deref_object (object_p);
-      ecma_deref_ecma_string (name_p);
-    }
-    else
-    {
-      ret_value = final_result;
-    }
-  }
+  ecma_deref_ecma_string (context.gap_str_p);
+  ecma_deref_ecma_string (context.indent_str_p);
 
-  JMEM_FINALIZE_LOCAL_ARRAY (str_start_p);
+  ecma_free_values_collection (context.property_list_p, true);
+  ecma_free_values_collection (context.occurence_stack_p, true);
 
-  ECMA_FINALIZE (string);
   return ret_value;
-} /* ecma_builtin_json_parse */
-
-static ecma_value_t
-ecma_builtin_json_str (ecma_string_t *key_p, ecma_object_t *holder_p, ecma_json_stringify_context_t *context_p);
-
-static ecma_value_t
-ecma_builtin_json_object (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
-
-static ecma_value_t
-ecma_builtin_json_array (ecma_object_t *obj_p, ecma_json_stringify_context_t *context_p);
+} /* ecma_builtin_json_string_from_value */
 
 /**
  * The JSON object's 'stringify' routine
@@ -1012,30 +1917,7 @@ ecma_builtin_json_stringify (ecma_value_t this_arg, /**< 'this' argument */
 
     if (ecma_is_value_empty (ret_value))
     {
-      /* 9. */
-      ecma_object_t *obj_wrapper_p = ecma_op_create_object_object_noarg ();
-      ecma_string_t *empty_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
-
-      /* 10. */
-      ecma_value_t put_comp_val = ecma_op_object_put (obj_wrapper_p,
-                                                      empty_str_p,
-                                                      arg1,
-                                                      false);
-
-      JERRY_ASSERT (ecma_is_value_true (put_comp_val));
-      ecma_free_value (put_comp_val);
-
-      /* 11. */
-      ECMA_TRY_CATCH (str_val,
-                      ecma_builtin_json_str (empty_str_p, obj_wrapper_p, &context),
-                      ret_value);
-
-      ret_value = ecma_copy_value (str_val);
-
-      ECMA_FINALIZE (str_val);
-
-      ecma_deref_object (obj_wrapper_p);
-      ecma_deref_ecma_string (empty_str_p);
+      ret_value = ecma_builtin_json_str_helper (arg1, &context);
     }
 
     ecma_deref_ecma_string (context.gap_str_p);
@@ -1052,155 +1934,100 @@ ecma_builtin_json_stringify (ecma_value_t this_arg, /**< 'this' argument */
 /**
  * Abstract operation 'Quote' defined in 15.12.3
  *
+ * The quoted string is appended to the string builder. Characters which
+ * need no escaping are copied in runs rather than one by one.
+ *
  * See also:
  *          ECMA-262 v5, 15.12.3
- *
- * @return ecma value
- *         Returned value must be freed with ecma_free_value.
  */
-static ecma_value_t
-ecma_builtin_json_quote (ecma_string_t *string_p) /**< string that should be quoted*/
+static void
+ecma_builtin_json_quote (ecma_stringbuilder_t *builder_p, /**< string builder */
+                         ecma_string_t *string_p) /**< string that should be quoted*/
 {
   /* 1. */
-  ecma_string_t *quote_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_DOUBLE_QUOTE_CHAR);
-  ecma_ref_ecma_string (quote_str_p);
-  ecma_string_t *product_str_p = quote_str_p;
-  ecma_string_t *tmp_str_p;
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 
   ECMA_STRING_TO_UTF8_STRING (string_p, string_buff, string_buff_size);
 
   const lit_utf8_byte_t *str_p = string_buff;
   const lit_utf8_byte_t *str_end_p = string_buff + string_buff_size;
+  const lit_utf8_byte_t *run_start_p = str_p;
 
+  /* All characters which must be escaped are ascii characters, so the
+   * bytes of multi-byte cesu-8 sequences never need any special handling. */
   while (str_p < str_end_p)
   {
-    ecma_char_t current_char = lit_utf8_read_next (&str_p);
+    lit_utf8_byte_t current_char = *str_p;
 
-    /* 2.a */
-    if (current_char == LIT_CHAR_BACKSLASH || current_char == LIT_CHAR_DOUBLE_QUOTE)
+    if (current_char != LIT_CHAR_BACKSLASH
+        && current_char != LIT_CHAR_DOUBLE_QUOTE
+        && current_char >= LIT_CHAR_SP)
     {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
-
-      /* 2.a.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.a.ii */
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
+      /* 2.d */
+      str_p++;
+      continue;
     }
-    /* 2.b */
-    else if (current_char == LIT_CHAR_BS
-             || current_char == LIT_CHAR_FF
-             || current_char == LIT_CHAR_LF
-             || current_char == LIT_CHAR_CR
-             || current_char == LIT_CHAR_TAB)
-    {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
 
-      /* 2.b.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
+    ecma_stringbuilder_append_raw (builder_p, run_start_p, (lit_utf8_size_t) (str_p - run_start_p));
+    str_p++;
+    run_start_p = str_p;
 
-      /* 2.b.ii */
-      lit_utf8_byte_t abbrev = LIT_CHAR_SP;
+    /* 2.a.i, 2.b.i, 2.c.i */
+    ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_BACKSLASH);
 
-      switch (current_char)
+    switch (current_char)
+    {
+      /* 2.a.ii */
+      case LIT_CHAR_BACKSLASH:
+      case LIT_CHAR_DOUBLE_QUOTE:
       {
-        case LIT_CHAR_BS:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_B;
-          break;
-        }
-        case LIT_CHAR_FF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_F;
-          break;
-        }
-        case LIT_CHAR_LF:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_N;
-          break;
-        }
-        case LIT_CHAR_CR:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_R;
-          break;
-        }
-        case LIT_CHAR_TAB:
-        {
-          abbrev = LIT_CHAR_LOWERCASE_T;
-          break;
-        }
+        ecma_stringbuilder_append_byte (builder_p, current_char);
+        break;
       }
+      /* 2.b.ii - 2.b.iii */
+      case LIT_CHAR_BS:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_B);
+        break;
+      }
+      case LIT_CHAR_FF:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_F);
+        break;
+      }
+      case LIT_CHAR_LF:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_N);
+        break;
+      }
+      case LIT_CHAR_CR:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_R);
+        break;
+      }
+      case LIT_CHAR_TAB:
+      {
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_T);
+        break;
+      }
+      default:
+      {
+        /* 2.c.ii */
+        ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_LOWERCASE_U);
 
-      /* 2.b.iii */
-      ecma_string_t *abbrev_str_p = ecma_new_ecma_string_from_utf8 (&abbrev, 1);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, abbrev_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (abbrev_str_p);
-      product_str_p = tmp_str_p;
-    }
-    /* 2.c */
-    else if (current_char < LIT_CHAR_SP)
-    {
-      ecma_string_t *backslash_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_BACKSLASH_CHAR);
-
-      /* 2.c.i */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, backslash_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (backslash_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.c.ii */
-      lit_utf8_byte_t u_ch = LIT_CHAR_LOWERCASE_U;
-      ecma_string_t *u_ch_str_p = ecma_new_ecma_string_from_utf8 (&u_ch, 1);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, u_ch_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (u_ch_str_p);
-      product_str_p = tmp_str_p;
-
-      /* 2.c.iii */
-      ecma_string_t *hex_str_p = ecma_builtin_helper_json_create_hex_digit_ecma_string ((uint8_t) current_char);
-
-      /* 2.c.iv */
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, hex_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (hex_str_p);
-      product_str_p = tmp_str_p;
-    }
-    /* 2.d */
-    else
-    {
-      ecma_string_t *current_char_str_p = ecma_new_ecma_string_from_code_unit (current_char);
-
-      tmp_str_p = ecma_concat_ecma_strings (product_str_p, current_char_str_p);
-      ecma_deref_ecma_string (product_str_p);
-      ecma_deref_ecma_string (current_char_str_p);
-      product_str_p = tmp_str_p;
+        /* 2.c.iii - 2.c.iv */
+        ecma_builtin_helper_json_append_hex_digits (builder_p, current_char);
+        break;
+      }
     }
   }
 
+  ecma_stringbuilder_append_raw (builder_p, run_start_p, (lit_utf8_size_t) (str_p - run_start_p));
+
   ECMA_FINALIZE_UTF8_STRING (string_buff, string_buff_size);
 
   /* 3. */
-  tmp_str_p = ecma_concat_ecma_strings (product_str_p, quote_str_p);
-  ecma_deref_ecma_string (product_str_p);
-  ecma_deref_ecma_string (quote_str_p);
-  product_str_p = tmp_str_p;
-
-  /* 4. */
-  return ecma_make_string_value (product_str_p);
+  ecma_stringbuilder_append_byte (builder_p, LIT_CHAR_DOUBLE_QUOTE);
 } /* ecma_builtin_json_quote */
 
 /**
@@ -1332,7 +2159,11 @@ ecma_builtin_json_str (ecma_string_t *key_p, /**< property key*/
     else if (ecma_is_value_string (my_val))
     {
       ecma_string_t *value_str_p = ecma_get_string_from_value (my_val);
-      ret_value = ecma_builtin_json_quote (value_str_p);
+      ecma_stringbuilder_t builder;
+
+      ecma_stringbuilder_init (&builder);
+      ecma_builtin_json_quote (&builder, value_str_p);
+      ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&builder));
     }
     /* 9. */
     else if (ecma_is_value_number (my_val))
@@ -1440,12 +2271,9 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
 
     ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, true, false);
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, props_p);
-
-    while (ecma_collection_iterator_next (&iter))
+    for (ecma_length_t i = 0; i < props_p->unit_number; i++)
     {
-      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
 
       ecma_property_t property = ecma_op_object_get_own_property (obj_p,
                                                                   property_name_p,
@@ -1456,7 +2284,7 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
 
       if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDDATA)
       {
-        ecma_append_to_values_collection (property_keys_p, *iter.current_value_p, true);
+        ecma_append_to_values_collection (property_keys_p, props_p->buffer_p[i], true);
       }
     }
 
@@ -1467,12 +2295,11 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
   ecma_collection_header_t *partial_p = ecma_new_values_collection (NULL, 0, true);
 
   /* 8. */
-  ecma_collection_iterator_t iterator;
-  ecma_collection_iterator_init (&iterator, property_keys_p);
-
-  while (ecma_collection_iterator_next (&iterator) && ecma_is_value_empty (ret_value))
+  for (ecma_length_t i = 0;
+       i < property_keys_p->unit_number && ecma_is_value_empty (ret_value);
+       i++)
   {
-    ecma_value_t value = *iterator.current_value_p;
+    ecma_value_t value = property_keys_p->buffer_p[i];
     ecma_string_t *key_p = ecma_get_string_from_value (value);
 
     /* 8.a */
@@ -1483,37 +2310,27 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     /* 8.b */
     if (!ecma_is_value_undefined (str_val))
     {
-      ecma_string_t *colon_p = ecma_get_magic_string (LIT_MAGIC_STRING_COLON_CHAR);
       ecma_string_t *value_str_p = ecma_get_string_from_value (str_val);
-      ecma_string_t *tmp_str_p;
+      ecma_stringbuilder_t builder;
 
-      /* 8.b.i */
-      ecma_value_t str_comp_val = ecma_builtin_json_quote (key_p);
-      JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (str_comp_val));
+      ecma_stringbuilder_init (&builder);
 
-      ecma_string_t *member_str_p = ecma_get_string_from_value (str_comp_val);
+      /* 8.b.i */
+      ecma_builtin_json_quote (&builder, key_p);
 
       /* 8.b.ii */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, colon_p);
-      ecma_free_value (str_comp_val);
-      ecma_deref_ecma_string (colon_p);
-      member_str_p = tmp_str_p;
+      ecma_stringbuilder_append_byte (&builder, LIT_CHAR_COLON);
 
       /* 8.b.iii */
       if (!ecma_string_is_empty (context_p->gap_str_p))
       {
-        ecma_string_t *space_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_SPACE_CHAR);
-
-        tmp_str_p = ecma_concat_ecma_strings (member_str_p, space_str_p);
-        ecma_deref_ecma_string (member_str_p);
-        ecma_deref_ecma_string (space_str_p);
-        member_str_p = tmp_str_p;
+        ecma_stringbuilder_append_byte (&builder, LIT_CHAR_SP);
       }
 
       /* 8.b.iv */
-      tmp_str_p = ecma_concat_ecma_strings (member_str_p, value_str_p);
-      ecma_deref_ecma_string (member_str_p);
-      member_str_p = tmp_str_p;
+      ecma_stringbuilder_append (&builder, value_str_p);
+
+      ecma_string_t *member_str_p = ecma_stringbuilder_finalize (&builder);
 
       /* 8.b.v */
       ecma_value_t member_value = ecma_make_string_value (member_str_p);
@@ -1554,30 +2371,18 @@ ecma_builtin_json_object (ecma_object_t *obj_p, /**< the object*/
     /* 10.a */
     if (ecma_string_is_empty (context_p->gap_str_p))
     {
-      ecma_string_t *left_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-      ecma_string_t *right_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-      ret_value = ecma_builtin_helper_json_create_non_formatted_json (left_brace_str_p,
-                                                                      right_brace_str_p,
+      ret_value = ecma_builtin_helper_json_create_non_formatted_json (LIT_CHAR_LEFT_BRACE,
+                                                                      LIT_CHAR_RIGHT_BRACE,
                                                                       partial_p);
-
-      ecma_deref_ecma_string (left_brace_str_p);
-      ecma_deref_ecma_string (right_brace_str_p);
     }
     /* 10.b */
     else
     {
-      ecma_string_t *left_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_BRACE_CHAR);
-      ecma_string_t *right_brace_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_BRACE_CHAR);
-
-      ret_value = ecma_builtin_helper_json_create_formatted_json (left_brace_str_p,
-                                                                  right_brace_str_p,
+      ret_value = ecma_builtin_helper_json_create_formatted_json (LIT_CHAR_LEFT_BRACE,
+                                                                  LIT_CHAR_RIGHT_BRACE,
                                                                   stepback_p,
                                                                   partial_p,
                                                                   context_p);
-
-      ecma_deref_ecma_string (left_brace_str_p);
-      ecma_deref_ecma_string (right_brace_str_p);
     }
   }
 
@@ -1692,30 +2497,18 @@ ecma_builtin_json_array (ecma_object_t *obj_p, /**< the array object*/
       /* 10.a */
       if (ecma_string_is_empty (context_p->gap_str_p))
       {
-        ecma_string_t *left_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_SQUARE_CHAR);
-        ecma_string_t *right_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_SQUARE_CHAR);
-
-        ret_value = ecma_builtin_helper_json_create_non_formatted_json (left_square_str_p,
-                                                                        right_square_str_p,
+        ret_value = ecma_builtin_helper_json_create_non_formatted_json (LIT_CHAR_LEFT_SQUARE,
+                                                                        LIT_CHAR_RIGHT_SQUARE,
                                                                         partial_p);
-
-        ecma_deref_ecma_string (left_square_str_p);
-        ecma_deref_ecma_string (right_square_str_p);
       }
       /* 10.b */
       else
       {
-        ecma_string_t *left_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LEFT_SQUARE_CHAR);
-        ecma_string_t *right_square_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_RIGHT_SQUARE_CHAR);
-
-        ret_value = ecma_builtin_helper_json_create_formatted_json (left_square_str_p,
-                                                                    right_square_str_p,
+        ret_value = ecma_builtin_helper_json_create_formatted_json (LIT_CHAR_LEFT_SQUARE,
+                                                                    LIT_CHAR_RIGHT_SQUARE,
                                                                     stepback_p,
                                                                     partial_p,
                                                                     context_p);
-
-        ecma_deref_ecma_string (left_square_str_p);
-        ecma_deref_ecma_string (right_square_str_p);
       }
     }
   }
@@ -195,13 +195,11 @@ ecma_builtin_object_object_seal (ecma_value_t this_arg, /**< 'this' argument */
 
     ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, false, false);
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, props_p);
-
-    while (ecma_collection_iterator_next (&iter)
-           && ecma_is_value_empty (ret_value))
+    for (ecma_length_t i = 0;
+         i < props_p->unit_number && ecma_is_value_empty (ret_value);
+         i++)
     {
-      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
 
       // 2.a
       ecma_property_descriptor_t prop_desc;
@@ -270,13 +268,11 @@ ecma_builtin_object_object_freeze (ecma_value_t this_arg, /**< 'this' argument *
     ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, false, false);
 
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, props_p);
-
-    while (ecma_collection_iterator_next (&iter)
-           && ecma_is_value_empty (ret_value))
+    for (ecma_length_t i = 0;
+         i < props_p->unit_number && ecma_is_value_empty (ret_value);
+         i++)
     {
-      ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
 
       // 2.a
       ecma_property_descriptor_t prop_desc;
@@ -393,12 +389,9 @@ ecma_builtin_object_object_is_sealed (ecma_value_t this_arg, /**< 'this' argumen
       // 2.
       ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, false, false);
 
-      ecma_collection_iterator_t iter;
-      ecma_collection_iterator_init (&iter, props_p);
-
-      while (ecma_collection_iterator_next (&iter))
+      for (ecma_length_t i = 0; i < props_p->unit_number; i++)
       {
-        ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+        ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
 
         // 2.a
         ecma_property_t property = ecma_op_object_get_own_property (obj_p,
@@ -464,12 +457,9 @@ ecma_builtin_object_object_is_frozen (ecma_value_t this_arg, /**< 'this' argumen
       // 2.
       ecma_collection_header_t *props_p = ecma_op_object_get_property_names (obj_p, false, false, false);
 
-      ecma_collection_iterator_t iter;
-      ecma_collection_iterator_init (&iter, props_p);
-
-      while (ecma_collection_iterator_next (&iter))
+      for (ecma_length_t i = 0; i < props_p->unit_number; i++)
       {
-        ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+        ecma_string_t *property_name_p = ecma_get_string_from_value (props_p->buffer_p[i]);
 
         // 2.a
         ecma_property_t property = ecma_op_object_get_own_property (obj_p,
@@ -714,20 +704,18 @@ ecma_builtin_object_object_define_properties (ecma_value_t this_arg, /**< 'this'
     ecma_collection_header_t *prop_names_p = ecma_op_object_get_property_names (props_p, false, true, false);
     uint32_t property_number = prop_names_p->unit_number;
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, prop_names_p);
-
     // 4.
     JMEM_DEFINE_LOCAL_ARRAY (property_descriptors, property_number, ecma_property_descriptor_t);
 
     uint32_t property_descriptor_number = 0;
 
-    while (ecma_collection_iterator_next (&iter)
-           && ecma_is_value_empty (ret_value))
+    for (uint32_t index = 0;
+         index < property_number && ecma_is_value_empty (ret_value);
+         index++)
     {
       // 5.a
       ECMA_TRY_CATCH (desc_obj,
-                      ecma_op_object_get (props_p, ecma_get_string_from_value (*iter.current_value_p)),
+                      ecma_op_object_get (props_p, ecma_get_string_from_value (prop_names_p->buffer_p[index])),
                       ret_value);
 
       // 5.b
@@ -743,17 +731,13 @@ ecma_builtin_object_object_define_properties (ecma_value_t this_arg, /**< 'this'
     }
 
     // 6.
-    ecma_collection_iterator_init (&iter, prop_names_p);
     for (uint32_t index = 0;
          index < property_number && ecma_is_value_empty (ret_value);
          index++)
     {
-      bool is_next = ecma_collection_iterator_next (&iter);
-      JERRY_ASSERT (is_next);
-
       ECMA_TRY_CATCH (define_own_prop_ret,
                       ecma_op_object_define_own_property (obj_p,
-                                                          ecma_get_string_from_value (*iter.current_value_p),
+                                                          ecma_get_string_from_value (prop_names_p->buffer_p[index]),
                                                           &property_descriptors[index],
                                                           true),
                       ret_value);
@@ -611,6 +611,7 @@ typedef struct
                                          * depending on the value of is_regexp */
   ecma_length_t match_start; /**< starting position of the match */
   ecma_length_t match_end; /**< end position of the match */
+  ecma_stringbuilder_t result_builder; /**< builder of the result string */
 
   /* Replace value callable part. */
   ecma_object_t *replace_function_p;
@@ -621,46 +622,55 @@ typedef struct
 } ecma_builtin_replace_search_ctx_t;
 
 /**
- * Generic helper function to append a substring at the end of a base string
- *
- * The base string can be kept or freed
- *
- * @return the constructed string
+ * Generic helper function to append a substring to the result string builder
  */
-static ecma_string_t *
-ecma_builtin_string_prototype_object_replace_append_substr (ecma_string_t *base_string_p, /**< base string */
+static void
+ecma_builtin_string_prototype_object_replace_append_substr (ecma_stringbuilder_t *builder_p, /**< string builder */
                                                             ecma_string_t *appended_string_p, /**< appended string */
                                                             ecma_length_t start, /**< start position */
-                                                            ecma_length_t end, /**< end position */
-                                                            bool free_base_string) /**< free base string or not */
+                                                            ecma_length_t end) /**< end position */
 {
-  ecma_string_t *ret_string_p;
-
   JERRY_ASSERT (start <= end);
   JERRY_ASSERT (end <= ecma_string_get_length (appended_string_p));
 
-  if (start < end)
+  if (start == end)
   {
-    ecma_string_t *substring_p = ecma_string_substr (appended_string_p, start, end);
-    ret_string_p = ecma_concat_ecma_strings (base_string_p, substring_p);
+    return;
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (appended_string_p, &size, &is_ascii);
 
+  if (chars_p == NULL)
+  {
+    ecma_string_t *substring_p = ecma_string_substr (appended_string_p, start, end);
+    ecma_stringbuilder_append (builder_p, substring_p);
     ecma_deref_ecma_string (substring_p);
-    if (free_base_string)
-    {
-      ecma_deref_ecma_string (base_string_p);
-    }
+    return;
   }
-  else if (free_base_string)
+
+  if (is_ascii)
   {
-    ret_string_p = base_string_p;
+    ecma_stringbuilder_append_raw (builder_p, chars_p + start, end - start);
+    return;
   }
-  else
+
+  const lit_utf8_byte_t *start_p = chars_p;
+
+  for (ecma_length_t i = 0; i < start; i++)
   {
-    ret_string_p = base_string_p;
-    ecma_ref_ecma_string (ret_string_p);
+    lit_utf8_incr (&start_p);
   }
 
-  return ret_string_p;
+  const lit_utf8_byte_t *end_p = start_p;
+
+  for (ecma_length_t i = start; i < end; i++)
+  {
+    lit_utf8_incr (&end_p);
+  }
+
+  ecma_stringbuilder_append_raw (builder_p, start_p, (lit_utf8_size_t) (end_p - start_p));
 } /* ecma_builtin_string_prototype_object_replace_append_substr */
 
 /**
@@ -764,9 +774,11 @@ ecma_builtin_string_prototype_object_replace_match (ecma_builtin_replace_search_
 } /* ecma_builtin_string_prototype_object_replace_match */
 
 /**
- * Generic helper function to construct the string which replaces the matched part
+ * Generic helper function to append the string which replaces the matched part
+ * to the result string builder
  *
- * @return ecma value
+ * @return empty ecma value - if the replacement string is appended successfully
+ *         error - otherwise
  *         Returned value must be freed with ecma_free_value.
  */
 static ecma_value_t
@@ -832,7 +844,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
                       ecma_op_to_string (result_value),
                       ret_value);
 
-      ret_value = ecma_copy_value (to_string_value);
+      ecma_stringbuilder_append (&context_p->result_builder, ecma_get_string_from_value (to_string_value));
 
       ECMA_FINALIZE (to_string_value);
       ECMA_FINALIZE (result_value);
@@ -863,8 +875,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
      * example: "<xy>".replace(/(x)y/, "$1,$2,$01,$12") === "<x,$2,x,x2>"
      */
 
-    ecma_string_t *result_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
-
+    ecma_stringbuilder_t *builder_p = &context_p->result_builder;
     ecma_length_t previous_start = 0;
     ecma_length_t current_position = 0;
 
@@ -939,11 +950,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
       if (action != LIT_CHAR_NULL)
       {
-        result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                      context_p->replace_string_p,
-                                                                                      previous_start,
-                                                                                      current_position,
-                                                                                      true);
+        ecma_builtin_string_prototype_object_replace_append_substr (builder_p,
+                                                                    context_p->replace_string_p,
+                                                                    previous_start,
+                                                                    current_position);
         replace_str_curr_p++;
         current_position++;
 
@@ -954,20 +964,18 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
         else if (action == LIT_CHAR_GRAVE_ACCENT)
         {
           ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
-          result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        0,
-                                                                                        context_p->match_start,
-                                                                                        true);
+          ecma_builtin_string_prototype_object_replace_append_substr (builder_p,
+                                                                      input_string_p,
+                                                                      0,
+                                                                      context_p->match_start);
         }
         else if (action == LIT_CHAR_SINGLE_QUOTE)
         {
           ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
-          result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        context_p->match_end,
-                                                                                        context_p->input_length,
-                                                                                        true);
+          ecma_builtin_string_prototype_object_replace_append_substr (builder_p,
+                                                                      input_string_p,
+                                                                      context_p->match_end,
+                                                                      context_p->input_length);
         }
         else
         {
@@ -1009,11 +1017,7 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
           if (!ecma_is_value_undefined (submatch_value))
           {
             JERRY_ASSERT (ecma_is_value_string (submatch_value));
-            ecma_string_t *submatch_string_p = ecma_get_string_from_value (submatch_value);
-
-            ecma_string_t *appended_string_p = ecma_concat_ecma_strings (result_string_p, submatch_string_p);
-            ecma_deref_ecma_string (result_string_p);
-            result_string_p = appended_string_p;
+            ecma_stringbuilder_append (builder_p, ecma_get_string_from_value (submatch_value));
           }
 
           ECMA_FINALIZE (submatch_value);
@@ -1036,13 +1040,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
     if (ecma_is_value_empty (ret_value))
     {
-      result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                    context_p->replace_string_p,
-                                                                                    previous_start,
-                                                                                    current_position,
-                                                                                    true);
-
-      ret_value = ecma_make_string_value (result_string_p);
+      ecma_builtin_string_prototype_object_replace_append_substr (builder_p,
+                                                                  context_p->replace_string_p,
+                                                                  previous_start,
+                                                                  current_position);
     }
   }
 
@@ -1066,9 +1067,10 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
   ecma_length_t previous_start = 0;
   bool continue_match = true;
 
-  ecma_string_t *result_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
   ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
 
+  ecma_stringbuilder_init (&context_p->result_builder);
+
   while (continue_match)
   {
     continue_match = false;
@@ -1078,25 +1080,12 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
 
     if (!ecma_is_value_null (match_value))
     {
-      result_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                    input_string_p,
-                                                                                    previous_start,
-                                                                                    context_p->match_start,
-                                                                                    true);
-
-      ECMA_TRY_CATCH (string_value,
-                      ecma_builtin_string_prototype_object_replace_get_string (context_p, match_value),
-                      ret_value);
-
-      JERRY_ASSERT (ecma_is_value_string (string_value));
-
-      ecma_string_t *appended_string_p = ecma_concat_ecma_strings (result_string_p,
-                                                                   ecma_get_string_from_value (string_value));
+      ecma_builtin_string_prototype_object_replace_append_substr (&context_p->result_builder,
+                                                                  input_string_p,
+                                                                  previous_start,
+                                                                  context_p->match_start);
 
-      ecma_deref_ecma_string (result_string_p);
-      result_string_p = appended_string_p;
-
-      ECMA_FINALIZE (string_value);
+      ret_value = ecma_builtin_string_prototype_object_replace_get_string (context_p, match_value);
 
       previous_start = context_p->match_end;
 
@@ -1134,14 +1123,12 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
       if (!context_p->is_global || ecma_is_value_null (match_value))
       {
         /* No more matches */
-        ecma_string_t *appended_string_p;
-        appended_string_p = ecma_builtin_string_prototype_object_replace_append_substr (result_string_p,
-                                                                                        input_string_p,
-                                                                                        previous_start,
-                                                                                        context_p->input_length,
-                                                                                        false);
-
-        ret_value = ecma_make_string_value (appended_string_p);
+        ecma_builtin_string_prototype_object_replace_append_substr (&context_p->result_builder,
+                                                                    input_string_p,
+                                                                    previous_start,
+                                                                    context_p->input_length);
+
+        ret_value = ecma_make_string_value (ecma_stringbuilder_finalize (&context_p->result_builder));
       }
       else
       {
@@ -1152,7 +1139,11 @@ ecma_builtin_string_prototype_object_replace_loop (ecma_builtin_replace_search_c
     ECMA_FINALIZE (match_value);
   }
 
-  ecma_deref_ecma_string (result_string_p);
+  if (ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    ecma_stringbuilder_destroy (&context_p->result_builder);
+  }
+
   return ret_value;
 } /* ecma_builtin_string_prototype_object_replace_loop */
 
@@ -1227,7 +1218,7 @@ ecma_builtin_string_prototype_object_replace_main (ecma_builtin_replace_search_c
  *          which computes the replacement string
  *
  *  The final string is created from several string fragments appended
- *  together by ecma_builtin_string_prototype_object_replace_append_substr.
+ *  to a string builder by ecma_builtin_string_prototype_object_replace_append_substr.
  *
  * See also:
  *          ECMA-262 v5, 15.5.4.11
@@ -1613,6 +1604,78 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
   return ret_value;
 } /* ecma_builtin_helper_split_match */
 
+/**
+ * Split a string by a non-empty string separator for String.prototype.split()
+ *
+ * Note:
+ *      Matching a string separator at a position (SplitMatch) fails or
+ *      succeeds without captures, so the string is only searched for the
+ *      occurrences of the separator and the parts between them are
+ *      created directly from their characters.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.5.4.14 steps 13-16
+ *
+ * Used by:
+ *        - The String.prototype.split routine.
+ */
+static void
+ecma_builtin_helper_split_by_string (ecma_object_t *array_p, /**< result array */
+                                     ecma_string_t *string_p, /**< string to split */
+                                     ecma_string_t *separator_p, /**< non-empty separator */
+                                     ecma_length_t limit) /**< maximum number of parts */
+{
+  ecma_length_t array_length = 0;
+
+  ECMA_STRING_TO_UTF8_STRING (string_p, string_chars_p, string_size);
+  ECMA_STRING_TO_UTF8_STRING (separator_p, separator_chars_p, separator_size);
+
+  JERRY_ASSERT (separator_size > 0);
+
+  const lit_utf8_byte_t *string_end_p = string_chars_p + string_size;
+  const lit_utf8_byte_t *part_start_p = string_chars_p;
+
+  while (array_length < limit)
+  {
+    const lit_utf8_byte_t *match_p = lit_utf8_find_substring (part_start_p,
+                                                              (lit_utf8_size_t) (string_end_p - part_start_p),
+                                                              separator_chars_p,
+                                                              separator_size);
+
+    /* 14-15. */
+    const lit_utf8_byte_t *part_end_p = (match_p != NULL) ? match_p : string_end_p;
+
+    ecma_string_t *part_str_p = ecma_new_ecma_string_from_utf8 (part_start_p,
+                                                                (lit_utf8_size_t) (part_end_p - part_start_p));
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (array_length);
+
+    ecma_value_t put_comp = ecma_builtin_helper_def_prop (array_p,
+                                                          index_str_p,
+                                                          ecma_make_string_value (part_str_p),
+                                                          true,
+                                                          true,
+                                                          true,
+                                                          false);
+
+    JERRY_ASSERT (ecma_is_value_true (put_comp));
+
+    ecma_deref_ecma_string (index_str_p);
+    ecma_deref_ecma_string (part_str_p);
+
+    array_length++;
+
+    if (match_p == NULL)
+    {
+      break;
+    }
+
+    part_start_p = match_p + separator_size;
+  }
+
+  ECMA_FINALIZE_UTF8_STRING (separator_chars_p, separator_size);
+  ECMA_FINALIZE_UTF8_STRING (string_chars_p, string_size);
+} /* ecma_builtin_helper_split_by_string */
+
 /**
  * The String.prototype object's 'split' routine
  *
@@ -1751,6 +1814,14 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_arg, /**< this arg
 
           ecma_free_value (match_result);
         }
+        else if (ecma_is_value_string (separator)
+                 && !ecma_string_is_empty (ecma_get_string_from_value (separator)))
+        {
+          ecma_builtin_helper_split_by_string (new_array_p,
+                                               ecma_get_string_from_value (this_to_string_val),
+                                               ecma_get_string_from_value (separator),
+                                               limit);
+        }
         else /* if (string_length != 0) || !ecma_is_value_empty (ret_value) */
         {
           /* 4. */
@@ -2063,16 +2134,37 @@ ecma_builtin_string_prototype_object_conversion_helper (ecma_value_t this_arg, /
   ECMA_STRING_TO_UTF8_STRING (input_string_p, input_start_p, input_start_size);
 
   /*
-   * The URI encoding has two major phases: first we compute
-   * the length of the lower case string, then we encode it.
+   * The conversion has two major phases: first we compute
+   * the length of the converted string, then we encode it.
+   *
+   * ASCII bytes are converted directly, only the other
+   * code units go through the unicode case tables.
    */
 
+  const lit_utf8_byte_t ascii_range_start = (lit_utf8_byte_t) (lower_case ? LIT_CHAR_ASCII_UPPERCASE_LETTERS_BEGIN
+                                                                          : LIT_CHAR_ASCII_LOWERCASE_LETTERS_BEGIN);
+  const lit_utf8_byte_t ascii_range_end = (lit_utf8_byte_t) (lower_case ? LIT_CHAR_ASCII_UPPERCASE_LETTERS_END
+                                                                        : LIT_CHAR_ASCII_LOWERCASE_LETTERS_END);
+
   lit_utf8_size_t output_length = 0;
+  bool is_changed = false;
   const lit_utf8_byte_t *input_str_curr_p = input_start_p;
   const lit_utf8_byte_t *input_str_end_p = input_start_p + input_start_size;
 
   while (input_str_curr_p < input_str_end_p)
   {
+    if (*input_str_curr_p <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+    {
+      if (*input_str_curr_p >= ascii_range_start && *input_str_curr_p <= ascii_range_end)
+      {
+        is_changed = true;
+      }
+
+      input_str_curr_p++;
+      output_length++;
+      continue;
+    }
+
     ecma_char_t character = lit_utf8_read_next (&input_str_curr_p);
     ecma_char_t character_buffer[LIT_MAXIMUM_OTHER_CASE_LENGTH];
     ecma_length_t character_length;
@@ -2093,57 +2185,85 @@ ecma_builtin_string_prototype_object_conversion_helper (ecma_value_t this_arg, /
 
     JERRY_ASSERT (character_length >= 1 && character_length <= LIT_MAXIMUM_OTHER_CASE_LENGTH);
 
+    if (character_length != 1 || character_buffer[0] != character)
+    {
+      is_changed = true;
+    }
+
     for (ecma_length_t i = 0; i < character_length; i++)
     {
       output_length += lit_code_unit_to_utf8 (character_buffer[i], utf8_byte_buffer);
     }
   }
 
-  /* Second phase. */
-
-  JMEM_DEFINE_LOCAL_ARRAY (output_start_p,
-                           output_length,
-                           lit_utf8_byte_t);
+  if (!is_changed)
+  {
+    /* The string is already in the requested case. */
+    ret_value = ecma_copy_value (to_string_val);
+  }
+  else
+  {
+    /* Second phase. */
 
-  lit_utf8_byte_t *output_char_p = output_start_p;
+    JMEM_DEFINE_LOCAL_ARRAY (output_start_p,
+                             output_length,
+                             lit_utf8_byte_t);
 
-  /* Encoding the output. */
-  input_str_curr_p = input_start_p;
+    lit_utf8_byte_t *output_char_p = output_start_p;
 
-  while (input_str_curr_p < input_str_end_p)
-  {
-    ecma_char_t character = lit_utf8_read_next (&input_str_curr_p);
-    ecma_char_t character_buffer[LIT_MAXIMUM_OTHER_CASE_LENGTH];
-    ecma_length_t character_length;
+    /* Encoding the output. */
+    input_str_curr_p = input_start_p;
 
-    if (lower_case)
-    {
-      character_length = lit_char_to_lower_case (character,
-                                                 character_buffer,
-                                                 LIT_MAXIMUM_OTHER_CASE_LENGTH);
-    }
-    else
+    while (input_str_curr_p < input_str_end_p)
     {
-      character_length = lit_char_to_upper_case (character,
-                                                 character_buffer,
-                                                 LIT_MAXIMUM_OTHER_CASE_LENGTH);
-    }
+      if (*input_str_curr_p <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        lit_utf8_byte_t byte = *input_str_curr_p++;
 
-    JERRY_ASSERT (character_length >= 1 && character_length <= LIT_MAXIMUM_OTHER_CASE_LENGTH);
+        if (byte >= ascii_range_start && byte <= ascii_range_end)
+        {
+          /* Upper and lower case ASCII letters only differ in this bit. */
+          byte ^= (lit_utf8_byte_t) (LIT_CHAR_LOWERCASE_A - LIT_CHAR_UPPERCASE_A);
+        }
 
-    for (ecma_length_t i = 0; i < character_length; i++)
-    {
-      output_char_p += lit_code_unit_to_utf8 (character_buffer[i], output_char_p);
+        *output_char_p++ = byte;
+        continue;
+      }
+
+      ecma_char_t character = lit_utf8_read_next (&input_str_curr_p);
+      ecma_char_t character_buffer[LIT_MAXIMUM_OTHER_CASE_LENGTH];
+      ecma_length_t character_length;
+
+      if (lower_case)
+      {
+        character_length = lit_char_to_lower_case (character,
+                                                   character_buffer,
+                                                   LIT_MAXIMUM_OTHER_CASE_LENGTH);
+      }
+      else
+      {
+        character_length = lit_char_to_upper_case (character,
+                                                   character_buffer,
+                                                   LIT_MAXIMUM_OTHER_CASE_LENGTH);
+      }
+
+      JERRY_ASSERT (character_length >= 1 && character_length <= LIT_MAXIMUM_OTHER_CASE_LENGTH);
+
+      for (ecma_length_t i = 0; i < character_length; i++)
+      {
+        output_char_p += lit_code_unit_to_utf8 (character_buffer[i], output_char_p);
+      }
     }
-  }
 
-  JERRY_ASSERT (output_start_p + output_length == output_char_p);
+    JERRY_ASSERT (output_start_p + output_length == output_char_p);
+
+    ecma_string_t *output_string_p = ecma_new_ecma_string_from_utf8 (output_start_p, output_length);
 
-  ecma_string_t *output_string_p = ecma_new_ecma_string_from_utf8 (output_start_p, output_length);
+    ret_value = ecma_make_string_value (output_string_p);
 
-  ret_value = ecma_make_string_value (output_string_p);
+    JMEM_FINALIZE_LOCAL_ARRAY (output_start_p);
+  }
 
-  JMEM_FINALIZE_LOCAL_ARRAY (output_start_p);
   ECMA_FINALIZE_UTF8_STRING (input_start_p, input_start_size);
 
   ECMA_FINALIZE (to_string_val);
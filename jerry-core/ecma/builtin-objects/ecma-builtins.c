@@ -350,47 +350,33 @@ static const ecma_builtin_property_list_reference_t ecma_builtin_property_list_r
 };
 
 /**
- * If the property's name is one of built-in properties of the object
- * that is not instantiated yet, instantiate the property and
- * return pointer to the instantiated property.
+ * Get the built-in part of a built-in object
  *
- * @return pointer property, if one was instantiated,
- *         NULL - otherwise.
+ * @return pointer to the built-in part
  */
-ecma_property_t *
-ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
-                                          ecma_string_t *string_p) /**< property's name */
+static ecma_built_in_props_t *
+ecma_builtin_get_built_in_props (ecma_object_t *object_p) /**< built-in object */
 {
-  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
-
-  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
-      && ecma_builtin_function_is_routine (object_p))
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_CLASS)
   {
-    if (ecma_string_is_length (string_p))
-    {
-      /*
-       * Lazy instantiation of 'length' property
-       *
-       * Note:
-       *      We don't need to mark that the property was already lazy instantiated,
-       *      as it is non-configurable and so can't be deleted
-       */
-
-      ecma_property_t *len_prop_p;
-      ecma_property_value_t *len_prop_value_p = ecma_create_named_data_property (object_p,
-                                                                                 string_p,
-                                                                                 ECMA_PROPERTY_FIXED,
-                                                                                 &len_prop_p);
-
-      ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
-      len_prop_value_p->value = ecma_make_integer_value (ext_obj_p->u.built_in.length);
-
-      return len_prop_p;
-    }
-
-    return NULL;
+    return &((ecma_extended_built_in_object_t *) object_p)->built_in;
   }
 
+  return &((ecma_extended_object_t *) object_p)->u.built_in;
+} /* ecma_builtin_get_built_in_props */
+
+/**
+ * Find the descriptor of a built-in property of the object
+ * which is not instantiated yet
+ *
+ * @return pointer to the property descriptor, if the property is not instantiated,
+ *         NULL - otherwise.
+ */
+static const ecma_builtin_property_descriptor_t *
+ecma_builtin_find_lazy_property (ecma_object_t *object_p, /**< object */
+                                 ecma_string_t *string_p, /**< property's name */
+                                 bool mark_instantiated) /**< mark the property as instantiated */
+{
   lit_magic_string_id_t magic_string_id;
 
   if (!ecma_is_string_magic (string_p, &magic_string_id))
@@ -398,17 +384,7 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
     return NULL;
   }
 
-  ecma_built_in_props_t *built_in_props_p;
-
-  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_CLASS)
-  {
-    built_in_props_p = &((ecma_extended_built_in_object_t *) object_p)->built_in;
-  }
-  else
-  {
-    built_in_props_p = &((ecma_extended_object_t *) object_p)->u.built_in;
-  }
-
+  ecma_built_in_props_t *built_in_props_p = ecma_builtin_get_built_in_props (object_p);
   ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_props_p->id;
 
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
@@ -441,7 +417,10 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
       return NULL;
     }
 
-    built_in_props_p->instantiated_bitset |= bit_for_index;
+    if (mark_instantiated)
+    {
+      built_in_props_p->instantiated_bitset |= bit_for_index;
+    }
   }
   else
   {
@@ -449,16 +428,11 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
     ecma_value_t *mask_prop_p = ecma_find_internal_property (object_p,
                                                              ECMA_INTERNAL_PROPERTY_INSTANTIATED_MASK_32_63);
 
-    uint32_t instantiated_bitset;
+    uint32_t instantiated_bitset = 0;
 
-    if (mask_prop_p == NULL)
+    if (mask_prop_p != NULL)
     {
-      mask_prop_p = ecma_create_internal_property (object_p, ECMA_INTERNAL_PROPERTY_INSTANTIATED_MASK_32_63);
-      instantiated_bitset = 0;
-    }
-    else
-    {
-      instantiated_bitset = *mask_prop_p;
+      instantiated_bitset = (uint32_t) *mask_prop_p;
 
       if (instantiated_bitset & bit_for_index)
       {
@@ -467,27 +441,45 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
       }
     }
 
-    *mask_prop_p = (instantiated_bitset | bit_for_index);
+    if (mark_instantiated)
+    {
+      if (mask_prop_p == NULL)
+      {
+        mask_prop_p = ecma_create_internal_property (object_p, ECMA_INTERNAL_PROPERTY_INSTANTIATED_MASK_32_63);
+      }
+
+      *mask_prop_p = (instantiated_bitset | bit_for_index);
+    }
   }
 
-  ecma_value_t value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  return curr_property_p;
+} /* ecma_builtin_find_lazy_property */
 
-  switch (curr_property_p->type)
+/**
+ * Construct the value of a built-in property from its descriptor
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_builtin_make_property_value (ecma_builtin_id_t builtin_id, /**< built-in object's identifier */
+                                  const ecma_builtin_property_descriptor_t *property_p) /**< property descriptor */
+{
+  switch (property_p->type)
   {
     case ECMA_BUILTIN_PROPERTY_SIMPLE:
     {
-      value = ecma_make_simple_value (curr_property_p->value);
-      break;
+      return ecma_make_simple_value (property_p->value);
     }
     case ECMA_BUILTIN_PROPERTY_NUMBER:
     {
       ecma_number_t num = 0.0;
 
-      if (curr_property_p->value < ECMA_BUILTIN_NUMBER_MAX)
+      if (property_p->value < ECMA_BUILTIN_NUMBER_MAX)
       {
-        num = curr_property_p->value;
+        num = property_p->value;
       }
-      else if (curr_property_p->value < ECMA_BUILTIN_NUMBER_NAN)
+      else if (property_p->value < ECMA_BUILTIN_NUMBER_NAN)
       {
         static const ecma_number_t builtin_number_list[] =
         {
@@ -503,11 +495,11 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
           ECMA_NUMBER_SQRT_1_2
         };
 
-        num = builtin_number_list[curr_property_p->value - ECMA_BUILTIN_NUMBER_MAX];
+        num = builtin_number_list[property_p->value - ECMA_BUILTIN_NUMBER_MAX];
       }
       else
       {
-        switch (curr_property_p->value)
+        switch (property_p->value)
         {
           case ECMA_BUILTIN_NUMBER_NAN:
           {
@@ -532,34 +524,85 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
         }
       }
 
-      value = ecma_make_number_value (num);
-      break;
+      return ecma_make_number_value (num);
     }
     case ECMA_BUILTIN_PROPERTY_STRING:
     {
-      value = ecma_make_string_value (ecma_get_magic_string (curr_property_p->value));
-      break;
+      return ecma_make_string_value (ecma_get_magic_string (property_p->value));
     }
     case ECMA_BUILTIN_PROPERTY_OBJECT:
     {
-      value = ecma_make_object_value (ecma_builtin_get (curr_property_p->value));
-      break;
+      return ecma_make_object_value (ecma_builtin_get (property_p->value));
     }
     case ECMA_BUILTIN_PROPERTY_ROUTINE:
     {
       ecma_object_t *func_obj_p;
       func_obj_p = ecma_builtin_make_function_object_for_routine (builtin_id,
-                                                                  ECMA_GET_ROUTINE_ID (curr_property_p->value),
-                                                                  ECMA_GET_ROUTINE_LENGTH (curr_property_p->value));
-      value = ecma_make_object_value (func_obj_p);
-      break;
+                                                                  ECMA_GET_ROUTINE_ID (property_p->value),
+                                                                  ECMA_GET_ROUTINE_LENGTH (property_p->value));
+      return ecma_make_object_value (func_obj_p);
     }
     default:
     {
       JERRY_UNREACHABLE ();
-      return NULL;
+      return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
     }
   }
+} /* ecma_builtin_make_property_value */
+
+/**
+ * If the property's name is one of built-in properties of the object
+ * that is not instantiated yet, instantiate the property and
+ * return pointer to the instantiated property.
+ *
+ * @return pointer property, if one was instantiated,
+ *         NULL - otherwise.
+ */
+ecma_property_t *
+ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
+                                          ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
+      && ecma_builtin_function_is_routine (object_p))
+  {
+    if (ecma_string_is_length (string_p))
+    {
+      /*
+       * Lazy instantiation of 'length' property
+       *
+       * Note:
+       *      We don't need to mark that the property was already lazy instantiated,
+       *      as it is non-configurable and so can't be deleted
+       */
+
+      ecma_property_t *len_prop_p;
+      ecma_property_value_t *len_prop_value_p = ecma_create_named_data_property (object_p,
+                                                                                 string_p,
+                                                                                 ECMA_PROPERTY_FIXED,
+                                                                                 &len_prop_p);
+
+      ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+      len_prop_value_p->value = ecma_make_integer_value (ext_obj_p->u.built_in.length);
+
+      return len_prop_p;
+    }
+
+    return NULL;
+  }
+
+  const ecma_builtin_property_descriptor_t *curr_property_p = ecma_builtin_find_lazy_property (object_p,
+                                                                                                string_p,
+                                                                                                true);
+
+  if (curr_property_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) ecma_builtin_get_built_in_props (object_p)->id;
+  ecma_value_t value = ecma_builtin_make_property_value (builtin_id, curr_property_p);
 
   ecma_property_t *prop_p;
   ecma_property_value_t *prop_value_p = ecma_create_named_data_property (object_p,
@@ -578,6 +621,61 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
   return prop_p;
 } /* ecma_builtin_try_to_instantiate_property */
 
+/**
+ * Get the value of a built-in property of the object without instantiating it
+ *
+ * Reading a property does not change it, so the value is constructed from the
+ * constant property descriptor and the property is only created on the heap when
+ * it is modified or its attributes are requested (see also:
+ * ecma_builtin_try_to_instantiate_property). Routines and the properties of the
+ * global object are still instantiated, because the identity of a routine must be
+ * preserved and the global cells store pointers to the properties of the global object.
+ *
+ * @return ecma value of the property, if the property is not instantiated yet,
+ *         ECMA_SIMPLE_VALUE_NOT_FOUND - otherwise
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_builtin_try_to_get_property_value (ecma_object_t *object_p, /**< object */
+                                        ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
+      && ecma_builtin_function_is_routine (object_p))
+  {
+    if (ecma_string_is_length (string_p))
+    {
+      ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+      return ecma_make_integer_value (ext_obj_p->u.built_in.length);
+    }
+
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_NOT_FOUND);
+  }
+
+  const ecma_builtin_property_descriptor_t *curr_property_p = ecma_builtin_find_lazy_property (object_p,
+                                                                                                string_p,
+                                                                                                false);
+
+  if (curr_property_p == NULL)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_NOT_FOUND);
+  }
+
+  if (curr_property_p->type == ECMA_BUILTIN_PROPERTY_ROUTINE
+      || ecma_builtin_is (object_p, ECMA_BUILTIN_ID_GLOBAL))
+  {
+    ecma_property_t *prop_p = ecma_builtin_try_to_instantiate_property (object_p, string_p);
+
+    JERRY_ASSERT (prop_p != NULL && ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+    return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (prop_p)->value);
+  }
+
+  ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) ecma_builtin_get_built_in_props (object_p)->id;
+  return ecma_builtin_make_property_value (builtin_id, curr_property_p);
+} /* ecma_builtin_try_to_get_property_value */
+
 /**
  * List names of a built-in object's lazy instantiated properties
  *
@@ -652,7 +750,7 @@ ecma_builtin_list_lazy_property_names (ecma_object_t *object_p, /**< a built-in
         }
         else
         {
-          instantiated_bitset = *mask_prop_p;
+          instantiated_bitset = (uint32_t) *mask_prop_p;
         }
       }
 
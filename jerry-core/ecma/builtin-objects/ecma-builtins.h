@@ -60,6 +60,8 @@ ecma_builtin_dispatch_construct (ecma_object_t *,
                                  const ecma_value_t *, ecma_length_t);
 extern ecma_property_t *
 ecma_builtin_try_to_instantiate_property (ecma_object_t *, ecma_string_t *);
+extern ecma_value_t
+ecma_builtin_try_to_get_property_value (ecma_object_t *, ecma_string_t *);
 extern void
 ecma_builtin_list_lazy_property_names (ecma_object_t *,
                                        bool,
@@ -0,0 +1,807 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-for-in.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "jcontext.h"
+#include "jmem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforin For-in enumeration
+ * @{
+ *
+ * A for-in statement lists the enumerable own names of one object at a
+ * time: the names of a prototype are collected only when the names of
+ * the previous object of the chain are exhausted. Each object has a
+ * compact name block: array indices are stored as numbers and converted
+ * to strings when they are enumerated, other names are compressed pointers.
+ *
+ * The blocks of small objects are also stored in a cache keyed by the
+ * property layout of the object, so enumerating objects with the same
+ * shape (e.g. created by the same constructor) reuses the same block.
+ */
+
+/**
+ * Get the total number of names in a name block
+ */
+static inline uint32_t __attr_always_inline___
+ecma_for_in_names_get_count (const ecma_for_in_names_t *names_p) /**< name block */
+{
+  return names_p->index_count + names_p->name_count;
+} /* ecma_for_in_names_get_count */
+
+/**
+ * Get the size of a name block
+ */
+static inline size_t __attr_always_inline___
+ecma_for_in_names_get_size (uint32_t index_count, /**< number of array index names */
+                            uint32_t name_count, /**< number of other names */
+                            uint32_t layout_length) /**< number of layout entries */
+{
+  return (sizeof (ecma_for_in_names_t)
+          + index_count * sizeof (uint32_t)
+          + (name_count + layout_length) * sizeof (jmem_cpointer_t));
+} /* ecma_for_in_names_get_size */
+
+/**
+ * Get the array index names of a name block
+ */
+static inline uint32_t * __attr_always_inline___
+ecma_for_in_names_get_indices (ecma_for_in_names_t *names_p) /**< name block */
+{
+  return (uint32_t *) (names_p + 1);
+} /* ecma_for_in_names_get_indices */
+
+/**
+ * Get the non array index names of a name block
+ */
+static inline jmem_cpointer_t * __attr_always_inline___
+ecma_for_in_names_get_names (ecma_for_in_names_t *names_p) /**< name block */
+{
+  return (jmem_cpointer_t *) (ecma_for_in_names_get_indices (names_p) + names_p->index_count);
+} /* ecma_for_in_names_get_names */
+
+/**
+ * Get the layout entries of a name block
+ */
+static inline jmem_cpointer_t * __attr_always_inline___
+ecma_for_in_names_get_layout (ecma_for_in_names_t *names_p) /**< name block */
+{
+  return ecma_for_in_names_get_names (names_p) + names_p->name_count;
+} /* ecma_for_in_names_get_layout */
+
+/**
+ * Decrease the reference counter of a name block and free it when it is not used anymore
+ */
+static void
+ecma_for_in_names_deref (ecma_for_in_names_t *names_p) /**< name block */
+{
+  JERRY_ASSERT (names_p->refs > 0);
+
+  names_p->refs = (uint16_t) (names_p->refs - 1);
+
+  if (names_p->refs > 0)
+  {
+    return;
+  }
+
+  jmem_cpointer_t *names_cp_p = ecma_for_in_names_get_names (names_p);
+
+  /* The layout entries directly follow the names and hold a reference as well. */
+  for (uint32_t i = 0; i < names_p->name_count + names_p->layout_length; i++)
+  {
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]));
+  }
+
+  jmem_heap_free_block (names_p,
+                        ecma_for_in_names_get_size (names_p->index_count,
+                                                    names_p->name_count,
+                                                    names_p->layout_length));
+} /* ecma_for_in_names_deref */
+
+/**
+ * Get the first property pair of an object
+ *
+ * @return pointer to the property pair, or NULL if the object has no properties
+ */
+static ecma_property_header_t *
+ecma_for_in_get_first_property_pair (ecma_object_t *obj_p) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[0]) == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
+  return prop_iter_p;
+} /* ecma_for_in_get_first_property_pair */
+
+/**
+ * Check whether a property is a named data or accessor property
+ *
+ * @return true - if the property is a named property,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_for_in_is_named_property (ecma_property_t property) /**< property */
+{
+  return (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          || ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+} /* ecma_for_in_is_named_property */
+
+/**
+ * Check whether an object is a String object, which has virtual index properties
+ *
+ * @return true - if the object is a String object,
+ *         false - otherwise
+ */
+static bool
+ecma_for_in_is_string_object (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_CLASS)
+  {
+    return false;
+  }
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
+  return ext_object_p->u.class_prop.class_id == LIT_MAGIC_STRING_STRING_UL;
+} /* ecma_for_in_is_string_object */
+
+/**
+ * Restore the heap property of a subtree, whose children are heaps
+ */
+static void
+ecma_for_in_sift_down (uint32_t *indices_p, /**< array indices */
+                       uint32_t root, /**< root of the subtree */
+                       uint32_t end) /**< end of the heap */
+{
+  uint32_t value = indices_p[root];
+
+  while (true)
+  {
+    uint32_t child = 2 * root + 1;
+
+    if (child >= end)
+    {
+      break;
+    }
+
+    if (child + 1 < end && indices_p[child + 1] > indices_p[child])
+    {
+      child++;
+    }
+
+    if (indices_p[child] <= value)
+    {
+      break;
+    }
+
+    indices_p[root] = indices_p[child];
+    root = child;
+  }
+
+  indices_p[root] = value;
+} /* ecma_for_in_sift_down */
+
+/**
+ * Sort array indices into ascending order
+ */
+static void
+ecma_for_in_sort_indices (uint32_t *indices_p, /**< array indices */
+                          uint32_t count) /**< number of indices */
+{
+  uint32_t sorted_count = 1;
+
+  /* Indices are usually created in ascending order. */
+  while (sorted_count < count && indices_p[sorted_count - 1] < indices_p[sorted_count])
+  {
+    sorted_count++;
+  }
+
+  if (sorted_count >= count)
+  {
+    return;
+  }
+
+  for (uint32_t i = count / 2; i > 0; i--)
+  {
+    ecma_for_in_sift_down (indices_p, i - 1, count);
+  }
+
+  for (uint32_t end = count - 1; end > 0; end--)
+  {
+    uint32_t max_index = indices_p[0];
+    indices_p[0] = indices_p[end];
+    indices_p[end] = max_index;
+
+    ecma_for_in_sift_down (indices_p, 0, end);
+  }
+} /* ecma_for_in_sort_indices */
+
+/**
+ * List the enumerable own property names of an object
+ *
+ * Note:
+ *      built-in and function objects have no enumerable lazy properties,
+ *      so only the virtual indices of String objects are added to the
+ *      names of the property list.
+ *
+ * @return name block (with one reference)
+ */
+static ecma_for_in_names_t *
+ecma_for_in_list_names (ecma_object_t *obj_p) /**< object */
+{
+  uint32_t virtual_index_count = 0;
+  bool is_cacheable = true;
+
+  if (ecma_for_in_is_string_object (obj_p))
+  {
+    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
+    ecma_string_t *prim_value_str_p = ecma_get_string_from_value (ext_object_p->u.class_prop.value);
+
+    virtual_index_count = ecma_string_get_length (prim_value_str_p);
+    is_cacheable = false;
+  }
+
+  uint32_t index_count = virtual_index_count;
+  uint32_t name_count = 0;
+  uint32_t property_count = 0;
+
+  for (ecma_property_header_t *prop_iter_p = ecma_for_in_get_first_property_pair (obj_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp))
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_iter_p->types[i];
+
+      if (!ecma_for_in_is_named_property (property))
+      {
+        continue;
+      }
+
+      property_count++;
+
+      if (ecma_is_property_enumerable (property))
+      {
+        ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
+
+        if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+        {
+          index_count++;
+        }
+        else
+        {
+          name_count++;
+        }
+      }
+    }
+  }
+
+  uint32_t layout_length = 0;
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  if (is_cacheable && property_count <= ECMA_FOR_IN_CACHE_MAX_PROPERTIES)
+  {
+    layout_length = property_count;
+  }
+#else /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  JERRY_UNUSED (is_cacheable);
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+  ecma_for_in_names_t *names_p;
+  names_p = (ecma_for_in_names_t *) jmem_heap_alloc_block (ecma_for_in_names_get_size (index_count,
+                                                                                       name_count,
+                                                                                       layout_length));
+  names_p->refs = 1;
+  names_p->layout_length = (uint16_t) layout_length;
+  names_p->layout_enumerable = 0;
+  names_p->index_count = index_count;
+  names_p->name_count = name_count;
+
+  uint32_t *indices_p = ecma_for_in_names_get_indices (names_p);
+  jmem_cpointer_t *names_cp_p = ecma_for_in_names_get_names (names_p);
+  jmem_cpointer_t *layout_p = ecma_for_in_names_get_layout (names_p);
+
+  for (uint32_t i = 0; i < virtual_index_count; i++)
+  {
+    indices_p[i] = i;
+  }
+
+  /* The property list is in reverse creation order, so the names are filled from end to begin. */
+  uint32_t index_pos = index_count;
+  uint32_t name_pos = name_count;
+  uint32_t layout_pos = 0;
+
+  for (ecma_property_header_t *prop_iter_p = ecma_for_in_get_first_property_pair (obj_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp))
+  {
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_iter_p->types[i];
+
+      if (!ecma_for_in_is_named_property (property))
+      {
+        continue;
+      }
+
+      bool is_enumerable = ecma_is_property_enumerable (property);
+
+      ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
+
+      if (layout_pos < layout_length)
+      {
+        /* The layout is compared by name pointers, so the names must stay alive
+         * while the block is cached: otherwise a new name could reuse the address. */
+        ecma_ref_ecma_string (name_p);
+        layout_p[layout_pos] = prop_pair_p->names_cp[i];
+
+        if (is_enumerable)
+        {
+          names_p->layout_enumerable |= (uint32_t) (1u << layout_pos);
+        }
+
+        layout_pos++;
+      }
+
+      if (!is_enumerable)
+      {
+        continue;
+      }
+
+      uint32_t index = ecma_string_get_array_index (name_p);
+
+      if (index != ECMA_STRING_NOT_ARRAY_INDEX)
+      {
+        JERRY_ASSERT (index_pos > virtual_index_count);
+        indices_p[--index_pos] = index;
+      }
+      else
+      {
+        JERRY_ASSERT (name_pos > 0);
+        ecma_ref_ecma_string (name_p);
+        names_cp_p[--name_pos] = prop_pair_p->names_cp[i];
+      }
+    }
+  }
+
+  JERRY_ASSERT (index_pos == virtual_index_count && name_pos == 0 && layout_pos == layout_length);
+
+  ecma_for_in_sort_indices (indices_p, index_count);
+
+  return names_p;
+} /* ecma_for_in_list_names */
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+
+/**
+ * Check whether the property layout of an object equals to the layout recorded in a name block
+ *
+ * @return true - if the layouts are the same,
+ *         false - otherwise
+ */
+static bool
+ecma_for_in_cache_match (ecma_for_in_names_t *names_p, /**< cached name block */
+                         ecma_property_header_t *prop_iter_p) /**< first property pair of the object */
+{
+  jmem_cpointer_t *layout_p = ecma_for_in_names_get_layout (names_p);
+  uint32_t layout_pos = 0;
+
+  while (prop_iter_p != NULL)
+  {
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      ecma_property_t property = prop_iter_p->types[i];
+
+      if (!ecma_for_in_is_named_property (property))
+      {
+        continue;
+      }
+
+      if (layout_pos >= names_p->layout_length
+          || layout_p[layout_pos] != prop_pair_p->names_cp[i]
+          || ecma_is_property_enumerable (property) != (((names_p->layout_enumerable >> layout_pos) & 0x1) != 0))
+      {
+        return false;
+      }
+
+      layout_pos++;
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return layout_pos == names_p->layout_length;
+} /* ecma_for_in_cache_match */
+
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+/**
+ * Get the enumerable own property names of an object
+ *
+ * @return name block (the caller must release the returned reference)
+ */
+static ecma_for_in_names_t *
+ecma_for_in_get_names (ecma_object_t *obj_p) /**< object */
+{
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  ecma_for_in_names_t **entry_p = NULL;
+  ecma_property_header_t *prop_iter_p = ecma_for_in_get_first_property_pair (obj_p);
+
+  if (prop_iter_p != NULL && !ecma_for_in_is_string_object (obj_p))
+  {
+    /* The most recently added properties are likely different for objects with different layouts. */
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+    uint32_t hash = (uint32_t) (prop_pair_p->names_cp[0] ^ prop_pair_p->names_cp[1]);
+
+    entry_p = JERRY_CONTEXT (ecma_for_in_cache) + (hash & (ECMA_FOR_IN_CACHE_SIZE - 1));
+
+    ecma_for_in_names_t *cached_names_p = *entry_p;
+
+    if (cached_names_p != NULL
+        && cached_names_p->refs < UINT16_MAX
+        && ecma_for_in_cache_match (cached_names_p, prop_iter_p))
+    {
+      cached_names_p->refs = (uint16_t) (cached_names_p->refs + 1);
+      return cached_names_p;
+    }
+  }
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+  ecma_for_in_names_t *names_p = ecma_for_in_list_names (obj_p);
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  if (entry_p != NULL && names_p->layout_length > 0)
+  {
+    if (*entry_p != NULL)
+    {
+      ecma_for_in_names_deref (*entry_p);
+    }
+
+    names_p->refs = (uint16_t) (names_p->refs + 1);
+    *entry_p = names_p;
+  }
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+  return names_p;
+} /* ecma_for_in_get_names */
+
+/**
+ * Check whether a name block contains a name
+ *
+ * @return true - if the name is found,
+ *         false - otherwise
+ */
+static bool
+ecma_for_in_names_contain (ecma_for_in_names_t *names_p, /**< name block */
+                           ecma_string_t *name_p) /**< property name */
+{
+  uint32_t index = ecma_string_get_array_index (name_p);
+
+  if (index != ECMA_STRING_NOT_ARRAY_INDEX)
+  {
+    uint32_t *indices_p = ecma_for_in_names_get_indices (names_p);
+    uint32_t lower = 0;
+    uint32_t upper = names_p->index_count;
+
+    while (lower < upper)
+    {
+      uint32_t middle = lower + (upper - lower) / 2;
+
+      if (indices_p[middle] == index)
+      {
+        return true;
+      }
+
+      if (indices_p[middle] < index)
+      {
+        lower = middle + 1;
+      }
+      else
+      {
+        upper = middle;
+      }
+    }
+
+    return false;
+  }
+
+  jmem_cpointer_t *names_cp_p = ecma_for_in_names_get_names (names_p);
+
+  for (uint32_t i = 0; i < names_p->name_count; i++)
+  {
+    if (ecma_compare_ecma_strings (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]), name_p))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_for_in_names_contain */
+
+/**
+ * Check whether a name of the current object should be enumerated
+ *
+ * A name is skipped if it has been deleted, or it is shadowed by a property
+ * of a previous object of the prototype chain, or it has been enumerated
+ * already (the shadowing property might have been deleted since then).
+ *
+ * @return true - if the name should be enumerated,
+ *         false - otherwise
+ */
+static bool
+ecma_for_in_is_visible (ecma_for_in_iterator_t *iterator_p, /**< iterator */
+                        ecma_string_t *name_p) /**< property name */
+{
+  ecma_object_t *obj_p = iterator_p->object_p;
+
+  while (true)
+  {
+    ecma_property_t property = ecma_op_object_get_own_property (obj_p,
+                                                                name_p,
+                                                                NULL,
+                                                                ECMA_PROPERTY_GET_NO_OPTIONS);
+
+    if (property != ECMA_PROPERTY_TYPE_NOT_FOUND)
+    {
+      if (obj_p != iterator_p->level_object_p)
+      {
+        return false;
+      }
+      break;
+    }
+
+    if (obj_p == iterator_p->level_object_p)
+    {
+      return false;
+    }
+
+    obj_p = ecma_get_object_prototype (obj_p);
+    JERRY_ASSERT (obj_p != NULL);
+  }
+
+  for (ecma_for_in_level_t *level_p = iterator_p->visited_p;
+       level_p != NULL;
+       level_p = level_p->next_p)
+  {
+    if (ecma_for_in_names_contain (level_p->names_p, name_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_for_in_is_visible */
+
+/**
+ * Initialize the for-in cache
+ */
+void
+ecma_for_in_cache_init (void)
+{
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  memset (JERRY_CONTEXT (ecma_for_in_cache), 0, sizeof (JERRY_CONTEXT (ecma_for_in_cache)));
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_init */
+
+/**
+ * Release all name blocks of the for-in cache
+ */
+void
+ecma_for_in_cache_invalidate (void)
+{
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  for (uint32_t i = 0; i < ECMA_FOR_IN_CACHE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (ecma_for_in_cache)[i] != NULL)
+    {
+      ecma_for_in_names_deref (JERRY_CONTEXT (ecma_for_in_cache)[i]);
+      JERRY_CONTEXT (ecma_for_in_cache)[i] = NULL;
+    }
+  }
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_invalidate */
+
+/**
+ * Create an iterator, which lists the enumerable property names of an
+ * object and its prototype chain (ECMA-262 v5, 12.6.4)
+ *
+ * Note:
+ *      the object must be kept alive by the caller until the iterator is freed
+ *
+ * @return iterator, whose first name is already found (see ecma_op_for_in_iterator_has_next)
+ *         - if the object or its prototypes has enumerable properties,
+ *         NULL - otherwise
+ */
+ecma_for_in_iterator_t *
+ecma_op_for_in_create_iterator (ecma_object_t *obj_p) /**< object */
+{
+  ecma_object_t *level_object_p = obj_p;
+  ecma_for_in_names_t *names_p = ecma_for_in_get_names (obj_p);
+
+  while (ecma_for_in_names_get_count (names_p) == 0)
+  {
+    ecma_for_in_names_deref (names_p);
+
+    level_object_p = ecma_get_object_prototype (level_object_p);
+
+    if (level_object_p == NULL)
+    {
+      return NULL;
+    }
+
+    names_p = ecma_for_in_get_names (level_object_p);
+  }
+
+  ecma_for_in_iterator_t *iterator_p;
+  iterator_p = (ecma_for_in_iterator_t *) jmem_heap_alloc_block (sizeof (ecma_for_in_iterator_t));
+
+  iterator_p->object_p = obj_p;
+  iterator_p->level_object_p = level_object_p;
+  iterator_p->names_p = names_p;
+  iterator_p->visited_p = NULL;
+  iterator_p->position = 0;
+  iterator_p->current_name = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  /* The first name is taken without a 'has next' query. */
+  if (!ecma_op_for_in_iterator_has_next (iterator_p))
+  {
+    ecma_op_for_in_free_iterator (iterator_p);
+    return NULL;
+  }
+
+  return iterator_p;
+} /* ecma_op_for_in_create_iterator */
+
+/**
+ * Find the next property name, which should be enumerated
+ *
+ * @return true - if a name is found, it can be taken by ecma_op_for_in_iterator_get_next,
+ *         false - if the enumeration is finished
+ */
+bool
+ecma_op_for_in_iterator_has_next (ecma_for_in_iterator_t *iterator_p) /**< iterator */
+{
+  JERRY_ASSERT (ecma_is_value_empty (iterator_p->current_name));
+
+  while (iterator_p->names_p != NULL)
+  {
+    ecma_for_in_names_t *names_p = iterator_p->names_p;
+
+    if (iterator_p->position < ecma_for_in_names_get_count (names_p))
+    {
+      uint32_t position = iterator_p->position++;
+      ecma_string_t *name_p;
+
+      if (position < names_p->index_count)
+      {
+        name_p = ecma_new_ecma_string_from_uint32 (ecma_for_in_names_get_indices (names_p)[position]);
+      }
+      else
+      {
+        jmem_cpointer_t name_cp = ecma_for_in_names_get_names (names_p)[position - names_p->index_count];
+        name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp);
+        ecma_ref_ecma_string (name_p);
+      }
+
+      if (ecma_for_in_is_visible (iterator_p, name_p))
+      {
+        iterator_p->current_name = ecma_make_string_value (name_p);
+        return true;
+      }
+
+      ecma_deref_ecma_string (name_p);
+      continue;
+    }
+
+    /* The names of the current object are exhausted: continue with the prototype. */
+    iterator_p->names_p = NULL;
+
+    ecma_object_t *prototype_p = ecma_get_object_prototype (iterator_p->level_object_p);
+
+    if (prototype_p == NULL)
+    {
+      ecma_for_in_names_deref (names_p);
+      break;
+    }
+
+    if (ecma_for_in_names_get_count (names_p) > 0)
+    {
+      ecma_for_in_level_t *level_p;
+      level_p = (ecma_for_in_level_t *) jmem_heap_alloc_block (sizeof (ecma_for_in_level_t));
+      level_p->next_p = iterator_p->visited_p;
+      level_p->names_p = names_p;
+      iterator_p->visited_p = level_p;
+    }
+    else
+    {
+      ecma_for_in_names_deref (names_p);
+    }
+
+    iterator_p->level_object_p = prototype_p;
+    iterator_p->position = 0;
+
+    names_p = ecma_for_in_get_names (prototype_p);
+    iterator_p->names_p = names_p;
+  }
+
+  return false;
+} /* ecma_op_for_in_iterator_has_next */
+
+/**
+ * Take the name found by the last ecma_op_for_in_iterator_has_next call
+ *
+ * @return property name
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_for_in_iterator_get_next (ecma_for_in_iterator_t *iterator_p) /**< iterator */
+{
+  ecma_value_t name = iterator_p->current_name;
+
+  JERRY_ASSERT (ecma_is_value_string (name));
+
+  iterator_p->current_name = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  return name;
+} /* ecma_op_for_in_iterator_get_next */
+
+/**
+ * Free an iterator
+ */
+void
+ecma_op_for_in_free_iterator (ecma_for_in_iterator_t *iterator_p) /**< iterator */
+{
+  if (iterator_p->names_p != NULL)
+  {
+    ecma_for_in_names_deref (iterator_p->names_p);
+  }
+
+  ecma_for_in_level_t *level_p = iterator_p->visited_p;
+
+  while (level_p != NULL)
+  {
+    ecma_for_in_level_t *next_p = level_p->next_p;
+
+    ecma_for_in_names_deref (level_p->names_p);
+    jmem_heap_free_block (level_p, sizeof (ecma_for_in_level_t));
+
+    level_p = next_p;
+  }
+
+  ecma_free_value (iterator_p->current_name);
+  jmem_heap_free_block (iterator_p, sizeof (ecma_for_in_iterator_t));
+} /* ecma_op_for_in_free_iterator */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,42 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_FOR_IN_H
+#define ECMA_FOR_IN_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforin For-in enumeration
+ * @{
+ */
+
+extern void ecma_for_in_cache_init (void);
+extern void ecma_for_in_cache_invalidate (void);
+
+extern ecma_for_in_iterator_t *ecma_op_for_in_create_iterator (ecma_object_t *);
+extern bool ecma_op_for_in_iterator_has_next (ecma_for_in_iterator_t *);
+extern ecma_value_t ecma_op_for_in_iterator_get_next (ecma_for_in_iterator_t *);
+extern void ecma_op_for_in_free_iterator (ecma_for_in_iterator_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_FOR_IN_H */
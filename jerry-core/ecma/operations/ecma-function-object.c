@@ -535,6 +535,7 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                           this_binding,
                           local_env_p,
                           false,
+                          func_obj_p,
                           arguments_list_p,
                           arguments_list_len);
 
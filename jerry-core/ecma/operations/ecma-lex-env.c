@@ -18,6 +18,7 @@
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-gc.h"
+#include "ecma-global-cells.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
@@ -104,6 +105,12 @@ ecma_op_has_binding (ecma_object_t *lex_env_p, /**< lexical environment */
 
     ecma_object_t *binding_obj_p = ecma_get_lex_env_binding_object (lex_env_p);
 
+    if (lex_env_p == ecma_get_global_environment ()
+        && ecma_global_cells_lookup (binding_obj_p, name_p) != NULL)
+    {
+      return true;
+    }
+
     return ecma_op_object_has_property (binding_obj_p, name_p);
   }
 } /* ecma_op_has_binding */
@@ -209,6 +216,19 @@ ecma_op_set_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environment
 
     ecma_object_t *binding_obj_p = ecma_get_lex_env_binding_object (lex_env_p);
 
+    if (lex_env_p == ecma_get_global_environment ())
+    {
+      ecma_property_t *property_p = ecma_global_cells_lookup (binding_obj_p, name_p);
+
+      if (property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ecma_is_property_writable (*property_p))
+      {
+        ecma_named_data_property_assign_value (binding_obj_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
+        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+      }
+    }
+
     ecma_value_t completion = ecma_op_object_put (binding_obj_p,
                                                   name_p,
                                                   value,
@@ -257,6 +277,17 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
 
     ecma_object_t *binding_obj_p = ecma_get_lex_env_binding_object (lex_env_p);
 
+    if (lex_env_p == ecma_get_global_environment ())
+    {
+      ecma_property_t *property_p = ecma_global_cells_lookup (binding_obj_p, name_p);
+
+      if (property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+      }
+    }
+
     ecma_value_t result = ecma_op_object_find (binding_obj_p, name_p);
 
     if (!ecma_is_value_found (result))
@@ -37,81 +37,17 @@
  */
 
 /**
- * Arguments object creation operation.
+ * Create the index, length and callee properties of an Arguments object.
  *
- * See also: ECMA-262 v5, 10.6
+ * See also: ECMA-262 v5, 10.6 steps 7, 11, 13 and 14
  */
-void
-ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
-                                 ecma_object_t *lex_env_p, /**< lexical environment the Arguments
-                                                                object is created for */
-                                 const ecma_value_t *arguments_list_p, /**< arguments list */
-                                 ecma_length_t arguments_number, /**< length of arguments list */
-                                 const ecma_compiled_code_t *bytecode_data_p) /**< byte code */
+static void
+ecma_op_arguments_object_init_properties (ecma_object_t *obj_p, /**< arguments object */
+                                          ecma_object_t *func_obj_p, /**< callee function */
+                                          const ecma_value_t *arguments_list_p, /**< arguments list */
+                                          ecma_length_t arguments_number, /**< length of arguments list */
+                                          bool is_strict) /**< strict mode */
 {
-  bool is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
-
-  ecma_length_t formal_params_number;
-  jmem_cpointer_t *literal_p;
-
-  if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
-  {
-    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_data_p;
-    uint8_t *byte_p = (uint8_t *) bytecode_data_p;
-
-    formal_params_number = args_p->argument_end;
-    literal_p = (jmem_cpointer_t *) (byte_p + sizeof (cbc_uint16_arguments_t));
-  }
-  else
-  {
-    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_data_p;
-    uint8_t *byte_p = (uint8_t *) bytecode_data_p;
-
-    formal_params_number = args_p->argument_end;
-    literal_p = (jmem_cpointer_t *) (byte_p + sizeof (cbc_uint8_arguments_t));
-  }
-
-  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
-
-  ecma_object_t *obj_p;
-
-  if (!is_strict && arguments_number > 0 && formal_params_number > 0)
-  {
-    size_t formal_params_size = formal_params_number * sizeof (jmem_cpointer_t);
-
-    obj_p = ecma_create_object (prototype_p,
-                                sizeof (ecma_extended_object_t) + formal_params_size,
-                                ECMA_OBJECT_TYPE_ARGUMENTS);
-
-    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
-
-    ECMA_SET_INTERNAL_VALUE_POINTER (ext_object_p->u.arguments.lex_env_cp, lex_env_p);
-
-    ext_object_p->u.arguments.length = formal_params_number;
-
-    jmem_cpointer_t *arg_Literal_p = (jmem_cpointer_t *) (ext_object_p + 1);
-
-    memcpy (arg_Literal_p, literal_p, formal_params_size);
-
-    for (ecma_length_t i = 0; i < formal_params_number; i++)
-    {
-      if (arg_Literal_p[i] != JMEM_CP_NULL)
-      {
-        ecma_string_t *name_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, arg_Literal_p[i]);
-        ecma_ref_ecma_string (name_p);
-      }
-    }
-  }
-  else
-  {
-    obj_p = ecma_create_object (prototype_p, sizeof (ecma_extended_object_t), ECMA_OBJECT_TYPE_CLASS);
-
-    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
-    ext_object_p->u.class_prop.class_id = LIT_MAGIC_STRING_ARGUMENTS_UL;
-  }
-
-  ecma_deref_object (prototype_p);
-
   ecma_property_value_t *prop_value_p;
 
   // 11.a, 11.b
@@ -199,6 +135,85 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
 
     ecma_deref_object (thrower_p);
   }
+} /* ecma_op_arguments_object_init_properties */
+
+/**
+ * Arguments object creation operation.
+ *
+ * See also: ECMA-262 v5, 10.6
+ */
+void
+ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
+                                 ecma_object_t *lex_env_p, /**< lexical environment the Arguments
+                                                                object is created for */
+                                 const ecma_value_t *arguments_list_p, /**< arguments list */
+                                 ecma_length_t arguments_number, /**< length of arguments list */
+                                 const ecma_compiled_code_t *bytecode_data_p) /**< byte code */
+{
+  bool is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
+
+  ecma_length_t formal_params_number;
+  jmem_cpointer_t *literal_p;
+
+  if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_data_p;
+    uint8_t *byte_p = (uint8_t *) bytecode_data_p;
+
+    formal_params_number = args_p->argument_end;
+    literal_p = (jmem_cpointer_t *) (byte_p + sizeof (cbc_uint16_arguments_t));
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_data_p;
+    uint8_t *byte_p = (uint8_t *) bytecode_data_p;
+
+    formal_params_number = args_p->argument_end;
+    literal_p = (jmem_cpointer_t *) (byte_p + sizeof (cbc_uint8_arguments_t));
+  }
+
+  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+
+  ecma_object_t *obj_p;
+
+  if (!is_strict && arguments_number > 0 && formal_params_number > 0)
+  {
+    size_t formal_params_size = formal_params_number * sizeof (jmem_cpointer_t);
+
+    obj_p = ecma_create_object (prototype_p,
+                                sizeof (ecma_extended_object_t) + formal_params_size,
+                                ECMA_OBJECT_TYPE_ARGUMENTS);
+
+    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
+
+    ECMA_SET_INTERNAL_VALUE_POINTER (ext_object_p->u.arguments.lex_env_cp, lex_env_p);
+
+    ext_object_p->u.arguments.length = formal_params_number;
+
+    jmem_cpointer_t *arg_Literal_p = (jmem_cpointer_t *) (ext_object_p + 1);
+
+    memcpy (arg_Literal_p, literal_p, formal_params_size);
+
+    for (ecma_length_t i = 0; i < formal_params_number; i++)
+    {
+      if (arg_Literal_p[i] != JMEM_CP_NULL)
+      {
+        ecma_string_t *name_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, arg_Literal_p[i]);
+        ecma_ref_ecma_string (name_p);
+      }
+    }
+  }
+  else
+  {
+    obj_p = ecma_create_object (prototype_p, sizeof (ecma_extended_object_t), ECMA_OBJECT_TYPE_CLASS);
+
+    ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
+    ext_object_p->u.class_prop.class_id = LIT_MAGIC_STRING_ARGUMENTS_UL;
+  }
+
+  ecma_deref_object (prototype_p);
+
+  ecma_op_arguments_object_init_properties (obj_p, func_obj_p, arguments_list_p, arguments_number, is_strict);
 
   ecma_string_t *arguments_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_ARGUMENTS);
 
@@ -227,6 +242,35 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
   ecma_deref_object (obj_p);
 } /* ecma_op_create_arguments_object */
 
+/**
+ * Create an unmapped Arguments object, whose elements are
+ * not bound to the formal parameters of the function.
+ *
+ * Note:
+ *      the object is not stored in any lexical environment.
+ *
+ * @return arguments object
+ *         Returned object must be freed with ecma_deref_object
+ */
+ecma_object_t *
+ecma_op_create_unmapped_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
+                                          const ecma_value_t *arguments_list_p, /**< arguments list */
+                                          ecma_length_t arguments_number, /**< length of arguments list */
+                                          bool is_strict) /**< strict mode */
+{
+  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+  ecma_object_t *obj_p = ecma_create_object (prototype_p,
+                                             sizeof (ecma_extended_object_t),
+                                             ECMA_OBJECT_TYPE_CLASS);
+  ecma_deref_object (prototype_p);
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_p;
+  ext_object_p->u.class_prop.class_id = LIT_MAGIC_STRING_ARGUMENTS_UL;
+
+  ecma_op_arguments_object_init_properties (obj_p, func_obj_p, arguments_list_p, arguments_number, is_strict);
+  return obj_p;
+} /* ecma_op_create_unmapped_arguments_object */
+
 /**
  * [[DefineOwnProperty]] ecma Arguments object's operation
  *
@@ -22,6 +22,8 @@
 extern void
 ecma_op_create_arguments_object (ecma_object_t *, ecma_object_t *, const ecma_value_t *,
                                  ecma_length_t, const ecma_compiled_code_t *);
+extern ecma_object_t *
+ecma_op_create_unmapped_arguments_object (ecma_object_t *, const ecma_value_t *, ecma_length_t, bool);
 
 extern ecma_value_t
 ecma_op_arguments_object_delete (ecma_object_t *, ecma_string_t *, bool);
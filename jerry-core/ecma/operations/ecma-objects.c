@@ -382,7 +382,8 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
 
     if (ecma_get_object_is_builtin (object_p))
     {
-      property_p = ecma_builtin_try_to_instantiate_property (object_p, property_name_p);
+      /* Unmodified built-in properties are not instantiated by reading them. */
+      return ecma_builtin_try_to_get_property_value (object_p, property_name_p);
     }
     else if (type == ECMA_OBJECT_TYPE_FUNCTION)
     {
@@ -495,13 +496,15 @@ ecma_op_object_get_own_data_prop (ecma_object_t *object_p, /**< the object */
 
 #ifndef JERRY_NDEBUG
   /* Because ecma_op_object_find_own might create a property
-   * this check is executed after the function return. */
+   * this check is executed after the function return. Unmodified
+   * properties of built-in objects are not created by reading them. */
   ecma_property_t *property_p = ecma_find_named_property (object_p,
                                                           property_name_p);
 
-  JERRY_ASSERT (property_p != NULL
-                && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
-                && !ecma_is_property_configurable (*property_p));
+  JERRY_ASSERT ((property_p == NULL && ecma_get_object_is_builtin (object_p))
+                || (property_p != NULL
+                    && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                    && !ecma_is_property_configurable (*property_p)));
 #endif /* !JERRY_NDEBUG */
 
   return result;
@@ -1167,15 +1170,12 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
-    ecma_collection_iterator_t iter;
-    ecma_collection_iterator_init (&iter, prop_names_p);
-
     uint32_t own_names_hashes_bitmap[ECMA_OBJECT_HASH_BITMAP_SIZE / bitmap_row_size];
     memset (own_names_hashes_bitmap, 0, sizeof (own_names_hashes_bitmap));
 
-    while (ecma_collection_iterator_next (&iter))
+    for (ecma_length_t j = 0; j < prop_names_p->unit_number; j++)
     {
-      ecma_string_t *name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *name_p = ecma_get_string_from_value (prop_names_p->buffer_p[j]);
 
       uint8_t hash = (uint8_t) name_p->hash;
       uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
@@ -1220,11 +1220,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
             if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
             {
-              ecma_collection_iterator_init (&iter, prop_names_p);
-
-              while (ecma_collection_iterator_next (&iter))
+              for (ecma_length_t j = 0; j < prop_names_p->unit_number; j++)
               {
-                ecma_string_t *name2_p = ecma_get_string_from_value (*iter.current_value_p);
+                ecma_string_t *name2_p = ecma_get_string_from_value (prop_names_p->buffer_p[j]);
 
                 if (ecma_compare_ecma_strings (name_p, name2_p))
                 {
@@ -1267,10 +1265,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                       prop_iter_p->next_property_cp);
     }
 
-    ecma_collection_iterator_init (&iter, prop_names_p);
-    while (ecma_collection_iterator_next (&iter))
+    for (ecma_length_t j = 0; j < prop_names_p->unit_number; j++)
     {
-      ecma_string_t *name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *name_p = ecma_get_string_from_value (prop_names_p->buffer_p[j]);
 
       uint32_t index = ecma_string_get_array_index (name_p);
 
@@ -1294,10 +1291,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     uint32_t name_pos = array_index_named_properties_count + string_named_properties_count;
     uint32_t array_index_name_pos = 0;
 
-    ecma_collection_iterator_init (&iter, prop_names_p);
-    while (ecma_collection_iterator_next (&iter))
+    for (ecma_length_t j = 0; j < prop_names_p->unit_number; j++)
     {
-      ecma_string_t *name_p = ecma_get_string_from_value (*iter.current_value_p);
+      ecma_string_t *name_p = ecma_get_string_from_value (prop_names_p->buffer_p[j]);
 
       uint32_t index = ecma_string_get_array_index (name_p);
 
@@ -1386,12 +1382,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
         /* name with same hash already occured */
         bool is_equal_found = false;
 
-        ecma_collection_iterator_t iter;
-        ecma_collection_iterator_init (&iter, ret_p);
-
-        while (ecma_collection_iterator_next (&iter))
+        for (ecma_length_t j = 0; j < ret_p->unit_number; j++)
         {
-          ecma_string_t *iter_name_p = ecma_get_string_from_value (*iter.current_value_p);
+          ecma_string_t *iter_name_p = ecma_get_string_from_value (ret_p->buffer_p[j]);
 
           if (ecma_compare_ecma_strings (name_p, iter_name_p))
           {
@@ -1399,10 +1392,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
           }
         }
 
-        ecma_collection_iterator_init (&iter, skipped_non_enumerable_p);
-        while (ecma_collection_iterator_next (&iter))
+        for (ecma_length_t j = 0; j < skipped_non_enumerable_p->unit_number; j++)
         {
-          ecma_string_t *iter_name_p = ecma_get_string_from_value (*iter.current_value_p);
+          ecma_string_t *iter_name_p = ecma_get_string_from_value (skipped_non_enumerable_p->buffer_p[j]);
 
           if (ecma_compare_ecma_strings (name_p, iter_name_p))
           {
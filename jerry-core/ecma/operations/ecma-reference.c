@@ -17,6 +17,7 @@
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-global-cells.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
@@ -88,6 +89,17 @@ ecma_op_resolve_reference_value (ecma_object_t *lex_env_p, /**< starting lexical
 
       ecma_object_t *binding_obj_p = ecma_get_lex_env_binding_object (lex_env_p);
 
+      if (lex_env_p == ecma_get_global_environment ())
+      {
+        ecma_property_t *property_p = ecma_global_cells_lookup (binding_obj_p, name_p);
+
+        if (property_p != NULL
+            && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+        {
+          return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+        }
+      }
+
       ecma_value_t prop_value = ecma_op_object_find (binding_obj_p, name_p);
 
       if (ecma_is_value_found (prop_value))
@@ -356,8 +356,531 @@ re_canonicalize (ecma_char_t ch, /**< character */
 } /* re_canonicalize */
 
 /**
- * Recursive function for RegExp matching. Tests for a regular expression
- * match and returns a MatchResult value.
+ * States of the frames stored on the backtrack stack of the RegExp matcher.
+ *
+ * The matcher executes the bytecode in a loop. When it reaches a point where
+ * more than one path can be taken, it pushes a frame onto the backtrack stack
+ * and follows the first path. When a path fails, the top frame is resumed: it
+ * either selects the next path or restores the matcher state and fails as well.
+ *
+ * Frame layouts (bytecode and string pointers are stored as offsets):
+ *   SAVE_AT_START:            next alternative, string, old global start
+ *   LOOKAHEAD(_CONT):         next alternative, string, opcode, saved string pointers
+ *   NON_GREEDY_ZERO_GROUP:    group start operands, string, old group start
+ *   GROUP_START(_CONT):       next alternative, bytecode after the group (or 0), string,
+ *                             start index, iteration index, old group start, old iteration count
+ *   NON_GREEDY_GROUP_END:     group end operands, string, old group end
+ *   GROUP_END(_CONT):         group end operands, next alternative, old group start, old group end
+ *   (NON_)GREEDY_ITERATOR:    iterator operands, string, number of iterations
+ *
+ * The last word of each frame is a header, which contains the state and the size of the frame.
+ * The stack is a list of heap allocated segments, so frames are never moved.
+ */
+typedef enum
+{
+  RE_BACKTRACK_SAVE_AT_START,         /**< try the next alternative of the pattern */
+  RE_BACKTRACK_LOOKAHEAD,             /**< try the next alternative of a lookahead */
+  RE_BACKTRACK_LOOKAHEAD_CONT,        /**< restore the string pointers saved before a lookahead */
+  RE_BACKTRACK_NON_GREEDY_ZERO_GROUP, /**< enter a non-greedy group after skipping it failed */
+  RE_BACKTRACK_GROUP_START,           /**< try the next alternative of a group */
+  RE_BACKTRACK_GROUP_START_CONT,      /**< restore the group start after skipping a greedy group failed */
+  RE_BACKTRACK_NON_GREEDY_GROUP_END,  /**< iterate a non-greedy group after leaving it failed */
+  RE_BACKTRACK_GROUP_END,             /**< try the next alternative of a group iteration */
+  RE_BACKTRACK_GROUP_END_CONT,        /**< restore the group end after leaving the group failed */
+  RE_BACKTRACK_NON_GREEDY_ITERATOR,   /**< match one more atom of a non-greedy iterator */
+  RE_BACKTRACK_GREEDY_ITERATOR        /**< give back one atom of a greedy iterator */
+} re_backtrack_state_t;
+
+/**
+ * Result of a matcher step which may push a backtrack frame
+ */
+typedef enum
+{
+  RE_MATCH_STEP_CONTINUE,   /**< continue matching at the new bytecode position */
+  RE_MATCH_STEP_BACKTRACK,  /**< current path failed */
+  RE_MATCH_STEP_STACK_LIMIT /**< backtrack stack cannot be grown */
+} re_match_step_t;
+
+/**
+ * Number of words in the first segment of the backtrack stack
+ */
+#define RE_BACKTRACK_SEGMENT_INITIAL_SIZE 64u
+
+/**
+ * Maximum number of words in a segment of the backtrack stack (unless a single frame needs more)
+ */
+#define RE_BACKTRACK_SEGMENT_MAX_SIZE 1024u
+
+/**
+ * Create the header word of a backtrack frame
+ */
+#define RE_BACKTRACK_HEADER(state, size) (((uint32_t) (size) << 8) | (uint32_t) (state))
+
+/**
+ * Get the state of a backtrack frame from its header word
+ */
+#define RE_BACKTRACK_GET_STATE(header) ((re_backtrack_state_t) ((header) & 0xff))
+
+/**
+ * Get the size of a backtrack frame (including the header) from its header word
+ */
+#define RE_BACKTRACK_GET_SIZE(header) ((header) >> 8)
+
+/**
+ * Convert a bytecode pointer to a backtrack stack word
+ */
+#define RE_BC_TO_WORD(re_ctx_p, bc_p) ((uint32_t) ((bc_p) - (re_ctx_p)->bc_start_p))
+
+/**
+ * Convert a backtrack stack word to a bytecode pointer
+ */
+#define RE_WORD_TO_BC(re_ctx_p, word) ((re_ctx_p)->bc_start_p + (word))
+
+/**
+ * Convert a (possibly NULL) input string pointer to a backtrack stack word
+ */
+#define RE_STR_TO_WORD(re_ctx_p, str_p) \
+  ((str_p) == NULL ? 0 : (uint32_t) ((str_p) - (re_ctx_p)->input_start_p) + 1)
+
+/**
+ * Convert a backtrack stack word to a (possibly NULL) input string pointer
+ */
+#define RE_WORD_TO_STR(re_ctx_p, word) \
+  ((word) == 0 ? NULL : (re_ctx_p)->input_start_p + (word) - 1)
+
+/**
+ * Allocate a new segment for the backtrack stack
+ *
+ * @return true  - if successful
+ *         false - if there is not enough memory
+ */
+static bool
+re_backtrack_push_segment (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                           uint32_t frame_size) /**< size of the frame, which does not fit into the current segment */
+{
+  re_backtrack_segment_t *segment_p = re_ctx_p->free_segment_p;
+
+  if (segment_p != NULL && segment_p->size >= frame_size)
+  {
+    re_ctx_p->free_segment_p = NULL;
+  }
+  else
+  {
+    uint32_t size = JERRY_MIN (re_ctx_p->stack_size * 2, RE_BACKTRACK_SEGMENT_MAX_SIZE);
+    size = JERRY_MAX (size, RE_BACKTRACK_SEGMENT_INITIAL_SIZE);
+    size = JERRY_MAX (size, frame_size);
+
+    segment_p = ((re_backtrack_segment_t *)
+                 jmem_heap_alloc_block_null_on_error (sizeof (re_backtrack_segment_t) + size * sizeof (uint32_t)));
+
+    if (segment_p == NULL)
+    {
+      return false;
+    }
+
+    segment_p->size = size;
+  }
+
+  segment_p->prev_p = re_ctx_p->segment_p;
+  segment_p->prev_top = re_ctx_p->stack_top;
+
+  re_ctx_p->segment_p = segment_p;
+  re_ctx_p->stack_p = (uint32_t *) (segment_p + 1);
+  re_ctx_p->stack_top = 0;
+  re_ctx_p->stack_size = segment_p->size;
+  return true;
+} /* re_backtrack_push_segment */
+
+/**
+ * Free a segment of the backtrack stack
+ */
+static void
+re_backtrack_free_segment (re_backtrack_segment_t *segment_p) /**< segment */
+{
+  jmem_heap_free_block (segment_p, sizeof (re_backtrack_segment_t) + segment_p->size * sizeof (uint32_t));
+} /* re_backtrack_free_segment */
+
+/**
+ * Continue with the previous segment of the backtrack stack after the current one became empty.
+ * The current segment is kept for reuse.
+ */
+static void
+re_backtrack_pop_segment (re_matcher_ctx_t *re_ctx_p) /**< RegExp matcher context */
+{
+  re_backtrack_segment_t *segment_p = re_ctx_p->segment_p;
+  JERRY_ASSERT (segment_p->prev_p != NULL);
+
+  if (re_ctx_p->free_segment_p != NULL)
+  {
+    re_backtrack_free_segment (re_ctx_p->free_segment_p);
+  }
+
+  re_ctx_p->free_segment_p = segment_p;
+  re_ctx_p->segment_p = segment_p->prev_p;
+  re_ctx_p->stack_p = (uint32_t *) (re_ctx_p->segment_p + 1);
+  re_ctx_p->stack_top = segment_p->prev_top;
+  re_ctx_p->stack_size = re_ctx_p->segment_p->size;
+} /* re_backtrack_pop_segment */
+
+/**
+ * Push a new frame onto the backtrack stack of the matcher
+ *
+ * @return pointer to the first word of the frame - if successful
+ *         NULL - if the stack cannot be grown
+ */
+static uint32_t *
+re_backtrack_push (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                   re_backtrack_state_t state, /**< state of the frame */
+                   uint32_t size) /**< number of words in the frame (without the header) */
+{
+  if (re_ctx_p->stack_top + size + 1 > re_ctx_p->stack_size
+      && !re_backtrack_push_segment (re_ctx_p, size + 1))
+  {
+    return NULL;
+  }
+
+  uint32_t *frame_p = re_ctx_p->stack_p + re_ctx_p->stack_top;
+  frame_p[size] = RE_BACKTRACK_HEADER (state, size + 1);
+  re_ctx_p->stack_top += size + 1;
+
+  return frame_p;
+} /* re_backtrack_push */
+
+/**
+ * Change the state of the top frame of the backtrack stack
+ */
+static inline void __attr_always_inline___
+re_backtrack_set_state (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                        re_backtrack_state_t state) /**< new state */
+{
+  uint32_t *header_p = re_ctx_p->stack_p + re_ctx_p->stack_top - 1;
+  *header_p = RE_BACKTRACK_HEADER (state, RE_BACKTRACK_GET_SIZE (*header_p));
+} /* re_backtrack_set_state */
+
+/**
+ * Remove the top frame of the backtrack stack
+ */
+static inline void __attr_always_inline___
+re_backtrack_pop (re_matcher_ctx_t *re_ctx_p) /**< RegExp matcher context */
+{
+  JERRY_ASSERT (re_ctx_p->stack_top > 0);
+  re_ctx_p->stack_top -= RE_BACKTRACK_GET_SIZE (re_ctx_p->stack_p[re_ctx_p->stack_top - 1]);
+
+  if (re_ctx_p->stack_top == 0
+      && re_ctx_p->segment_p->prev_p != NULL)
+  {
+    re_backtrack_pop_segment (re_ctx_p);
+  }
+} /* re_backtrack_pop */
+
+/**
+ * Remove all frames from the backtrack stack
+ */
+static void
+re_backtrack_reset (re_matcher_ctx_t *re_ctx_p) /**< RegExp matcher context */
+{
+  while (re_ctx_p->segment_p != NULL
+         && re_ctx_p->segment_p->prev_p != NULL)
+  {
+    re_backtrack_pop_segment (re_ctx_p);
+  }
+
+  re_ctx_p->stack_top = 0;
+} /* re_backtrack_reset */
+
+/**
+ * Free the backtrack stack of the matcher
+ */
+static void
+re_backtrack_stack_free (re_matcher_ctx_t *re_ctx_p) /**< RegExp matcher context */
+{
+  re_backtrack_reset (re_ctx_p);
+
+  if (re_ctx_p->segment_p != NULL)
+  {
+    re_backtrack_free_segment (re_ctx_p->segment_p);
+    re_ctx_p->segment_p = NULL;
+  }
+
+  if (re_ctx_p->free_segment_p != NULL)
+  {
+    re_backtrack_free_segment (re_ctx_p->free_segment_p);
+    re_ctx_p->free_segment_p = NULL;
+  }
+
+  re_ctx_p->stack_p = NULL;
+  re_ctx_p->stack_size = 0;
+} /* re_backtrack_stack_free */
+
+/**
+ * Restore the saved string pointers from a lookahead frame
+ */
+static void
+re_backtrack_restore_saved (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                            const uint32_t *backup_p) /**< saved string pointers of the frame */
+{
+  uint32_t size = re_ctx_p->num_of_captures + re_ctx_p->num_of_non_captures;
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    re_ctx_p->saved_p[i] = RE_WORD_TO_STR (re_ctx_p, backup_p[i]);
+  }
+} /* re_backtrack_restore_saved */
+
+/**
+ * Compute the indices of the saved string pointers and the iteration counter of a group
+ */
+static void
+re_get_group_indices (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                      re_opcode_t op, /**< group start or end opcode */
+                      uint32_t idx, /**< group index operand */
+                      uint32_t *start_idx_p, /**< [out] index of the saved group start */
+                      uint32_t *end_idx_p, /**< [out] index of the saved group end */
+                      uint32_t *iter_idx_p) /**< [out] index of the iteration counter */
+{
+  if (RE_IS_CAPTURE_GROUP (op))
+  {
+    JERRY_ASSERT (idx <= re_ctx_p->num_of_captures / 2);
+    *iter_idx_p = idx - 1;
+    *start_idx_p = idx * 2;
+    *end_idx_p = (idx * 2) + 1;
+  }
+  else
+  {
+    JERRY_ASSERT (idx <= re_ctx_p->num_of_non_captures);
+    *iter_idx_p = idx + (re_ctx_p->num_of_captures / 2) - 1;
+    *start_idx_p = idx + re_ctx_p->num_of_captures;
+    *end_idx_p = *start_idx_p;
+  }
+} /* re_get_group_indices */
+
+/**
+ * Match a single character atom: a character, a period or a character class.
+ *
+ * @return true  - if matched, the bytecode and the string pointers are advanced
+ *         false - otherwise
+ */
+static bool
+re_match_char_atom (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                    re_opcode_t op, /**< opcode of the atom */
+                    uint8_t **bc_p, /**< [in, out] bytecode pointer after the opcode */
+                    const lit_utf8_byte_t **str_p) /**< [in, out] input string pointer */
+{
+  const lit_utf8_byte_t *str_curr_p = *str_p;
+
+  if (str_curr_p >= re_ctx_p->input_end_p)
+  {
+    JERRY_TRACE_MSG ("End of input: fail\n");
+    return false;
+  }
+
+  bool is_ignorecase = re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
+  ecma_char_t curr_ch = lit_utf8_read_next (&str_curr_p);
+
+  switch (op)
+  {
+    case RE_OP_CHAR:
+    {
+      ecma_char_t ch = re_get_char (bc_p); /* Already canonicalized. */
+      JERRY_TRACE_MSG ("Character matching %d to %d\n", ch, curr_ch);
+
+      if (ch != re_canonicalize (curr_ch, is_ignorecase))
+      {
+        return false;
+      }
+      break;
+    }
+    case RE_OP_PERIOD:
+    {
+      JERRY_TRACE_MSG ("Period matching '.' to %u\n", (unsigned int) curr_ch);
+
+      if (lit_char_is_line_terminator (curr_ch))
+      {
+        return false;
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (op == RE_OP_CHAR_CLASS || op == RE_OP_INV_CHAR_CLASS);
+      JERRY_TRACE_MSG ("Execute RE_OP_CHAR_CLASS/RE_OP_INV_CHAR_CLASS\n");
+
+      const uint8_t *bitmap_p = *bc_p;
+      *bc_p += RE_CHAR_CLASS_BITMAP_SIZE;
+
+      uint32_t num_of_ranges = re_get_value (bc_p);
+      uint8_t *ranges_p = *bc_p;
+      *bc_p += num_of_ranges * 2 * sizeof (ecma_char_t);
+
+      bool is_match = false;
+
+      if (curr_ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        is_match = (bitmap_p[curr_ch / JERRY_BITSINBYTE] & (1u << (curr_ch % JERRY_BITSINBYTE))) != 0;
+      }
+      else
+      {
+        /* The ranges are already canonicalized. */
+        curr_ch = re_canonicalize (curr_ch, is_ignorecase);
+
+        while (num_of_ranges > 0 && !is_match)
+        {
+          ecma_char_t ch1 = re_get_char (&ranges_p);
+          ecma_char_t ch2 = re_get_char (&ranges_p);
+
+          is_match = (curr_ch >= ch1 && curr_ch <= ch2);
+          num_of_ranges--;
+        }
+      }
+
+      if (is_match != (op == RE_OP_CHAR_CLASS))
+      {
+        return false;
+      }
+      break;
+    }
+  }
+
+  *str_p = str_curr_p;
+  return true;
+} /* re_match_char_atom */
+
+/**
+ * Enter a group: save the group start and try the first alternative.
+ *
+ * @return true  - if successful
+ *         false - if the backtrack stack cannot be grown
+ */
+static bool
+re_match_group_start (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                      re_opcode_t op, /**< group start opcode */
+                      uint8_t **bc_p, /**< [in, out] bytecode pointer after the opcode */
+                      const lit_utf8_byte_t *str_p) /**< input string pointer */
+{
+  uint8_t *bc_curr_p = *bc_p;
+  uint32_t start_idx, end_idx, iter_idx;
+  uint32_t end_bc = 0;
+
+  re_get_group_indices (re_ctx_p, op, re_get_value (&bc_curr_p), &start_idx, &end_idx, &iter_idx);
+
+  if (op != RE_OP_CAPTURE_GROUP_START
+      && op != RE_OP_NON_CAPTURE_GROUP_START)
+  {
+    uint32_t offset = re_get_value (&bc_curr_p);
+
+    if (op == RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START
+        || op == RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START)
+    {
+      /* Try to match after the close paren if zero is allowed. */
+      end_bc = RE_BC_TO_WORD (re_ctx_p, bc_curr_p + offset);
+    }
+  }
+
+  uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_GROUP_START, 7);
+
+  if (frame_p == NULL)
+  {
+    return false;
+  }
+
+  uint32_t offset = re_get_value (&bc_curr_p);
+
+  frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_curr_p + offset);
+  frame_p[1] = end_bc;
+  frame_p[2] = RE_STR_TO_WORD (re_ctx_p, str_p);
+  frame_p[3] = start_idx;
+  frame_p[4] = iter_idx;
+  frame_p[5] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[start_idx]);
+  frame_p[6] = re_ctx_p->num_of_iterations_p[iter_idx];
+
+  re_ctx_p->saved_p[start_idx] = str_p;
+  re_ctx_p->num_of_iterations_p[iter_idx] = 0;
+
+  *bc_p = bc_curr_p;
+  return true;
+} /* re_match_group_start */
+
+/**
+ * Complete an iteration of a greedy group: try to iterate again,
+ * and if it fails, try to match the bytecode after the group.
+ *
+ * @return RE_MATCH_STEP_CONTINUE - if matching continues at the updated bytecode pointer
+ *         RE_MATCH_STEP_BACKTRACK - if the current path failed
+ *         RE_MATCH_STEP_STACK_LIMIT - if the backtrack stack cannot be grown
+ */
+static re_match_step_t
+re_match_group_end (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                    re_opcode_t op, /**< group end opcode */
+                    uint8_t **bc_p, /**< [in, out] bytecode pointer after the opcode */
+                    const lit_utf8_byte_t *str_p) /**< input string pointer */
+{
+  uint8_t *operands_p = *bc_p;
+  uint8_t *bc_curr_p = operands_p;
+  uint32_t start_idx, end_idx, iter_idx;
+
+  re_get_group_indices (re_ctx_p, op, re_get_value (&bc_curr_p), &start_idx, &end_idx, &iter_idx);
+
+  uint32_t min = re_get_value (&bc_curr_p);
+  uint32_t max = re_get_value (&bc_curr_p);
+  uint32_t offset = re_get_value (&bc_curr_p);
+  uint32_t *num_of_iter_p = re_ctx_p->num_of_iterations_p + iter_idx;
+
+  /* Check the empty iteration if the minimum number of iterations is reached. */
+  if (*num_of_iter_p >= min
+      && str_p == re_ctx_p->saved_p[start_idx])
+  {
+    return RE_MATCH_STEP_BACKTRACK;
+  }
+
+  uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_GROUP_END, 4);
+
+  if (frame_p == NULL)
+  {
+    return RE_MATCH_STEP_STACK_LIMIT;
+  }
+
+  (*num_of_iter_p)++;
+
+  /* The string position is not stored: it can be read back from the saved group
+   * end, since every change made after this point is reverted before resuming. */
+  frame_p[0] = RE_BC_TO_WORD (re_ctx_p, operands_p);
+  frame_p[3] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[end_idx]);
+  re_ctx_p->saved_p[end_idx] = str_p;
+
+  if (*num_of_iter_p < max)
+  {
+    bc_curr_p -= offset;
+    offset = re_get_value (&bc_curr_p);
+
+    frame_p[1] = RE_BC_TO_WORD (re_ctx_p, bc_curr_p + offset);
+    frame_p[2] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[start_idx]);
+    re_ctx_p->saved_p[start_idx] = str_p;
+
+    *bc_p = bc_curr_p;
+    return RE_MATCH_STEP_CONTINUE;
+  }
+
+  if (*num_of_iter_p >= min
+      && *num_of_iter_p <= max)
+  {
+    /* Try to match the rest of the bytecode. */
+    re_backtrack_set_state (re_ctx_p, RE_BACKTRACK_GROUP_END_CONT);
+    *bc_p = bc_curr_p;
+    return RE_MATCH_STEP_CONTINUE;
+  }
+
+  re_ctx_p->saved_p[end_idx] = RE_WORD_TO_STR (re_ctx_p, frame_p[3]);
+  (*num_of_iter_p)--;
+  re_backtrack_pop (re_ctx_p);
+  return RE_MATCH_STEP_BACKTRACK;
+} /* re_match_group_end */
+
+/**
+ * RegExp matching. Tests for a regular expression match and returns a MatchResult value.
+ *
+ * The bytecode is executed in a loop. Choice points are recorded on an explicit
+ * backtrack stack allocated on the heap, so the depth of the matching is not limited
+ * by the native stack.
  *
  * See also:
  *          ECMA-262 v5, 15.10.2.1
@@ -373,61 +896,73 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
                  const lit_utf8_byte_t *str_p, /**< input string pointer */
                  const lit_utf8_byte_t **out_str_p) /**< [out] matching substring iterator */
 {
-  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
   re_opcode_t op;
-
   const lit_utf8_byte_t *str_curr_p = str_p;
 
-  while ((op = re_get_opcode (&bc_p)))
+  re_backtrack_reset (re_ctx_p);
+
+  while (true)
   {
+#if CONFIG_REGEXP_STEP_LIMIT > 0
+    if (++re_ctx_p->steps > CONFIG_REGEXP_STEP_LIMIT)
+    {
+      re_backtrack_stack_free (re_ctx_p);
+      return ecma_raise_range_error (ECMA_ERR_MSG ("RegExp step limit is exceeded."));
+    }
+#endif /* CONFIG_REGEXP_STEP_LIMIT > 0 */
+
+    op = re_get_opcode (&bc_p);
+
     switch (op)
     {
       case RE_OP_MATCH:
       {
         JERRY_TRACE_MSG ("Execute RE_OP_MATCH: match\n");
-        *out_str_p = str_curr_p;
-        ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
-        return ret_value; /* match */
-      }
-      case RE_OP_CHAR:
-      {
-        if (str_curr_p >= re_ctx_p->input_end_p)
+
+        /* End of a lookahead: the choice points created inside the lookahead are dropped. */
+        while (RE_BACKTRACK_GET_STATE (re_ctx_p->stack_p[re_ctx_p->stack_top - 1]) != RE_BACKTRACK_LOOKAHEAD)
         {
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          re_backtrack_pop (re_ctx_p);
         }
 
-        bool is_ignorecase = re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
-        ecma_char_t ch1 = (ecma_char_t) re_get_char (&bc_p); /* Already canonicalized. */
-        ecma_char_t ch2 = re_canonicalize (lit_utf8_read_next (&str_curr_p), is_ignorecase);
-        JERRY_TRACE_MSG ("Character matching %d to %d: ", ch1, ch2);
+        uint32_t *frame_p = re_ctx_p->stack_p + re_ctx_p->stack_top;
+        frame_p -= RE_BACKTRACK_GET_SIZE (frame_p[-1]);
 
-        if (ch1 != ch2)
+        bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
+
+        while (*bc_p == RE_OP_ALTERNATIVE)
         {
-          JERRY_TRACE_MSG ("fail\n");
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          bc_p++;
+          uint32_t offset = re_get_value (&bc_p);
+          bc_p += offset;
         }
 
-        JERRY_TRACE_MSG ("match\n");
+        JERRY_ASSERT (*bc_p == RE_OP_MATCH);
+        bc_p++;
 
-        break; /* tail merge */
-      }
-      case RE_OP_PERIOD:
-      {
-        if (str_curr_p >= re_ctx_p->input_end_p)
+        if ((re_opcode_t) frame_p[2] == RE_OP_LOOKAHEAD_POS)
         {
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          JERRY_TRACE_MSG ("Execute RE_OP_LOOKAHEAD_POS: match\n");
+          re_backtrack_set_state (re_ctx_p, RE_BACKTRACK_LOOKAHEAD_CONT);
+          break; /* tail merge */
         }
 
-        ecma_char_t ch = lit_utf8_read_next (&str_curr_p);
-        JERRY_TRACE_MSG ("Period matching '.' to %u: ", (unsigned int) ch);
-
-        if (lit_char_is_line_terminator (ch))
+        JERRY_TRACE_MSG ("Execute RE_OP_LOOKAHEAD_NEG: fail\n");
+        re_backtrack_restore_saved (re_ctx_p, frame_p + 3);
+        re_backtrack_pop (re_ctx_p);
+        goto backtrack;
+      }
+      case RE_OP_CHAR:
+      case RE_OP_PERIOD:
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_INV_CHAR_CLASS:
+      {
+        if (!re_match_char_atom (re_ctx_p, op, &bc_p, &str_curr_p))
         {
-          JERRY_TRACE_MSG ("fail\n");
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          goto backtrack;
         }
 
-        JERRY_TRACE_MSG ("match\n");
         break; /* tail merge */
       }
       case RE_OP_ASSERT_START:
@@ -443,7 +978,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         if (!(re_ctx_p->flags & RE_FLAG_MULTILINE))
         {
           JERRY_TRACE_MSG ("fail\n");
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          goto backtrack;
         }
 
         if (lit_char_is_line_terminator (lit_utf8_peek_prev (str_curr_p)))
@@ -453,7 +988,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         }
 
         JERRY_TRACE_MSG ("fail\n");
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+        goto backtrack;
       }
       case RE_OP_ASSERT_END:
       {
@@ -468,7 +1003,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         if (!(re_ctx_p->flags & RE_FLAG_MULTILINE))
         {
           JERRY_TRACE_MSG ("fail\n");
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          goto backtrack;
         }
 
         if (lit_char_is_line_terminator (lit_utf8_peek_next (str_curr_p)))
@@ -478,7 +1013,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         }
 
         JERRY_TRACE_MSG ("fail\n");
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+        goto backtrack;
       }
       case RE_OP_ASSERT_WORD_BOUNDARY:
       case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
@@ -509,7 +1044,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           if (is_wordchar_left == is_wordchar_right)
           {
             JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+            goto backtrack;
           }
         }
         else
@@ -520,7 +1055,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           if (is_wordchar_left != is_wordchar_right)
           {
             JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+            goto backtrack;
           }
         }
 
@@ -530,118 +1065,25 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
       case RE_OP_LOOKAHEAD_POS:
       case RE_OP_LOOKAHEAD_NEG:
       {
-        ecma_value_t match_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-        const lit_utf8_byte_t *sub_str_p = NULL;
-
         uint32_t array_size = re_ctx_p->num_of_captures + re_ctx_p->num_of_non_captures;
-        JMEM_DEFINE_LOCAL_ARRAY (saved_bck_p, array_size, lit_utf8_byte_t *);
-
-        size_t size = (size_t) (array_size) * sizeof (lit_utf8_byte_t *);
-        memcpy (saved_bck_p, re_ctx_p->saved_p, size);
-
-        do
-        {
-          uint32_t offset = re_get_value (&bc_p);
-
-          if (!sub_str_p)
-          {
-            match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-            if (ECMA_IS_VALUE_ERROR (match_value))
-            {
-              break;
-            }
-          }
-          bc_p += offset;
-        }
-        while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
-
-        if (!ECMA_IS_VALUE_ERROR (match_value))
-        {
-          JERRY_TRACE_MSG ("Execute RE_OP_LOOKAHEAD_POS/NEG: ");
-          ecma_free_value (match_value);
-          if ((op == RE_OP_LOOKAHEAD_POS && sub_str_p)
-              || (op == RE_OP_LOOKAHEAD_NEG && !sub_str_p))
-          {
-            JERRY_TRACE_MSG ("match\n");
-            match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-          }
-          else
-          {
-            JERRY_TRACE_MSG ("fail\n");
-            match_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
-          }
-        }
-
-        if (!ECMA_IS_VALUE_ERROR (match_value))
-        {
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-          }
-          else
-          {
-            JERRY_ASSERT (ecma_is_value_boolean (match_value));
-            /* restore saved */
-            memcpy (re_ctx_p->saved_p, saved_bck_p, size);
-          }
-        }
+        uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_LOOKAHEAD, 3 + array_size);
 
-        JMEM_FINALIZE_LOCAL_ARRAY (saved_bck_p);
-        return match_value;
-      }
-      case RE_OP_CHAR_CLASS:
-      case RE_OP_INV_CHAR_CLASS:
-      {
-        uint32_t num_of_ranges;
-        bool is_match;
-
-        JERRY_TRACE_MSG ("Execute RE_OP_CHAR_CLASS/RE_OP_INV_CHAR_CLASS, ");
-        if (str_curr_p >= re_ctx_p->input_end_p)
+        if (frame_p == NULL)
         {
-          JERRY_TRACE_MSG ("fail\n");
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+          goto stack_limit;
         }
 
-        bool is_ignorecase = re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
-        ecma_char_t curr_ch = re_canonicalize (lit_utf8_read_next (&str_curr_p), is_ignorecase);
+        uint32_t offset = re_get_value (&bc_p);
 
-        num_of_ranges = re_get_value (&bc_p);
-        is_match = false;
+        frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_p + offset);
+        frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+        frame_p[2] = (uint32_t) op;
 
-        while (num_of_ranges)
+        for (uint32_t i = 0; i < array_size; i++)
         {
-          ecma_char_t ch1 = re_canonicalize (re_get_char (&bc_p), is_ignorecase);
-          ecma_char_t ch2 = re_canonicalize (re_get_char (&bc_p), is_ignorecase);
-          JERRY_TRACE_MSG ("num_of_ranges=%u, ch1=%u, ch2=%u, curr_ch=%u; ",
-                           (unsigned int) num_of_ranges, (unsigned int) ch1,
-                           (unsigned int) ch2, (unsigned int) curr_ch);
-
-          if (curr_ch >= ch1 && curr_ch <= ch2)
-          {
-            /* We must read all the ranges from bytecode. */
-            is_match = true;
-          }
-          num_of_ranges--;
+          frame_p[3 + i] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[i]);
         }
 
-        if (op == RE_OP_CHAR_CLASS)
-        {
-          if (!is_match)
-          {
-            JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
-          }
-        }
-        else
-        {
-          JERRY_ASSERT (op == RE_OP_INV_CHAR_CLASS);
-          if (is_match)
-          {
-            JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
-          }
-        }
-        JERRY_TRACE_MSG ("match\n");
         break; /* tail merge */
       }
       case RE_OP_BACKREFERENCE:
@@ -668,7 +1110,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           if (str_curr_p >= re_ctx_p->input_end_p)
           {
             JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+            goto backtrack;
           }
 
           ch1 = lit_utf8_read_next (&sub_str_p);
@@ -677,7 +1119,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           if (ch1 != ch2)
           {
             JERRY_TRACE_MSG ("fail\n");
-            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+            goto backtrack;
           }
         }
         JERRY_TRACE_MSG ("match\n");
@@ -685,36 +1127,21 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
       }
       case RE_OP_SAVE_AT_START:
       {
-        uint8_t *old_bc_p;
-
         JERRY_TRACE_MSG ("Execute RE_OP_SAVE_AT_START\n");
-        const lit_utf8_byte_t *old_start_p = re_ctx_p->saved_p[RE_GLOBAL_START_IDX];
-        re_ctx_p->saved_p[RE_GLOBAL_START_IDX] = str_curr_p;
+        uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_SAVE_AT_START, 3);
 
-        do
+        if (frame_p == NULL)
         {
-          uint32_t offset = re_get_value (&bc_p);
-          const lit_utf8_byte_t *sub_str_p = NULL;
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
-          {
-            return match_value;
-          }
-
-          bc_p += offset;
-          old_bc_p = bc_p;
+          goto stack_limit;
         }
-        while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
-        bc_p = old_bc_p;
 
-        re_ctx_p->saved_p[RE_GLOBAL_START_IDX] = old_start_p;
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+        uint32_t offset = re_get_value (&bc_p);
+
+        frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_p + offset);
+        frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+        frame_p[2] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[RE_GLOBAL_START_IDX]);
+        re_ctx_p->saved_p[RE_GLOBAL_START_IDX] = str_curr_p;
+        break; /* tail merge */
       }
       case RE_OP_SAVE_AND_MATCH:
       {
@@ -750,188 +1177,81 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         *  On non-greedy iterations we have to execute the bytecode
         *  after the group first, if zero iteration is allowed.
         */
-        uint32_t start_idx, iter_idx, offset;
-        const lit_utf8_byte_t *old_start_p = NULL;
-        const lit_utf8_byte_t *sub_str_p = NULL;
-        uint8_t *old_bc_p;
+        uint32_t start_idx, end_idx, iter_idx;
+        uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_NON_GREEDY_ZERO_GROUP, 3);
 
-        old_bc_p = bc_p; /* save the bytecode start position of the group start */
-        start_idx = re_get_value (&bc_p);
-        offset = re_get_value (&bc_p);
-
-        if (RE_IS_CAPTURE_GROUP (op))
-        {
-          JERRY_ASSERT (start_idx <= re_ctx_p->num_of_captures / 2);
-          iter_idx = start_idx - 1;
-          start_idx *= 2;
-
-          old_start_p = re_ctx_p->saved_p[start_idx];
-          re_ctx_p->saved_p[start_idx] = str_curr_p;
-        }
-        else
-        {
-          JERRY_ASSERT (start_idx < re_ctx_p->num_of_non_captures);
-          iter_idx = start_idx + (re_ctx_p->num_of_captures / 2) - 1;
-          start_idx += re_ctx_p->num_of_captures;
-        }
-        re_ctx_p->num_of_iterations_p[iter_idx] = 0;
-
-        /* Jump all over to the end of the END opcode. */
-        bc_p += offset;
-
-        /* Try to match after the close paren if zero is allowed */
-        ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-
-        if (ecma_is_value_true (match_value))
-        {
-          *out_str_p = sub_str_p;
-          return match_value; /* match */
-        }
-        else if (ECMA_IS_VALUE_ERROR (match_value))
+        if (frame_p == NULL)
         {
-          return match_value;
+          goto stack_limit;
         }
+
+        frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_p);
+        frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+
+        re_get_group_indices (re_ctx_p, op, re_get_value (&bc_p), &start_idx, &end_idx, &iter_idx);
+        uint32_t offset = re_get_value (&bc_p);
+
+        frame_p[2] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[start_idx]);
+
         if (RE_IS_CAPTURE_GROUP (op))
         {
-          re_ctx_p->saved_p[start_idx] = old_start_p;
+          re_ctx_p->saved_p[start_idx] = str_curr_p;
         }
+        re_ctx_p->num_of_iterations_p[iter_idx] = 0;
 
-        bc_p = old_bc_p;
-        /* FALLTHRU */
+        /* Jump all over to the end of the END opcode. */
+        bc_p += offset;
+        break; /* tail merge */
       }
       case RE_OP_CAPTURE_GROUP_START:
       case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
       case RE_OP_NON_CAPTURE_GROUP_START:
       case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
       {
-        uint32_t start_idx, iter_idx, old_iteration_cnt, offset;
-        const lit_utf8_byte_t *sub_str_p = NULL;
-        uint8_t *old_bc_p;
-        uint8_t *end_bc_p = NULL;
-        start_idx = re_get_value (&bc_p);
-
-        if (op != RE_OP_CAPTURE_GROUP_START
-            && op != RE_OP_NON_CAPTURE_GROUP_START)
-        {
-          offset = re_get_value (&bc_p);
-          end_bc_p = bc_p + offset;
-        }
-
-        if (RE_IS_CAPTURE_GROUP (op))
-        {
-          JERRY_ASSERT (start_idx <= re_ctx_p->num_of_captures / 2);
-          iter_idx = start_idx - 1;
-          start_idx *= 2;
-        }
-        else
-        {
-          JERRY_ASSERT (start_idx < re_ctx_p->num_of_non_captures);
-          iter_idx = start_idx + (re_ctx_p->num_of_captures / 2) - 1;
-          start_idx += re_ctx_p->num_of_captures;
-        }
-
-        const lit_utf8_byte_t *old_start_p = re_ctx_p->saved_p[start_idx];
-        old_iteration_cnt = re_ctx_p->num_of_iterations_p[iter_idx];
-        re_ctx_p->saved_p[start_idx] = str_curr_p;
-        re_ctx_p->num_of_iterations_p[iter_idx] = 0;
-
-        do
-        {
-          offset = re_get_value (&bc_p);
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
-          {
-            return match_value;
-          }
-
-          bc_p += offset;
-          old_bc_p = bc_p;
-        }
-        while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
-        bc_p = old_bc_p;
-        re_ctx_p->num_of_iterations_p[iter_idx] = old_iteration_cnt;
-
-        /* Try to match after the close paren if zero is allowed. */
-        if (op == RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START
-            || op == RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START)
+        if (!re_match_group_start (re_ctx_p, op, &bc_p, str_curr_p))
         {
-          JERRY_ASSERT (end_bc_p);
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, end_bc_p, str_curr_p, &sub_str_p);
-
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
-          {
-            return match_value;
-          }
+          goto stack_limit;
         }
 
-        re_ctx_p->saved_p[start_idx] = old_start_p;
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+        break; /* tail merge */
       }
       case RE_OP_CAPTURE_NON_GREEDY_GROUP_END:
       case RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END:
       {
-        uint32_t end_idx, iter_idx, min, max;
-        uint8_t *old_bc_p;
-
         /*
         *  On non-greedy iterations we have to execute the bytecode
         *  after the group first. Try to iterate only if it fails.
         */
-        old_bc_p = bc_p; /* save the bytecode start position of the group end */
-        end_idx = re_get_value (&bc_p);
+        uint8_t *operands_p = bc_p;
+        uint32_t start_idx, end_idx, iter_idx, min, max;
+
+        re_get_group_indices (re_ctx_p, op, re_get_value (&bc_p), &start_idx, &end_idx, &iter_idx);
         min = re_get_value (&bc_p);
         max = re_get_value (&bc_p);
         re_get_value (&bc_p); /* start offset */
 
-        if (RE_IS_CAPTURE_GROUP (op))
-        {
-          JERRY_ASSERT (end_idx <= re_ctx_p->num_of_captures / 2);
-          iter_idx = end_idx - 1;
-          end_idx = (end_idx * 2) + 1;
-        }
-        else
-        {
-          JERRY_ASSERT (end_idx <= re_ctx_p->num_of_non_captures);
-          iter_idx = end_idx + (re_ctx_p->num_of_captures / 2) - 1;
-          end_idx += re_ctx_p->num_of_captures;
-        }
-
-        re_ctx_p->num_of_iterations_p[iter_idx]++;
+        uint32_t *num_of_iter_p = re_ctx_p->num_of_iterations_p + iter_idx;
+        (*num_of_iter_p)++;
 
-        if (re_ctx_p->num_of_iterations_p[iter_idx] >= min
-            && re_ctx_p->num_of_iterations_p[iter_idx] <= max)
+        if (*num_of_iter_p >= min
+            && *num_of_iter_p <= max)
         {
-          const lit_utf8_byte_t *old_end_p = re_ctx_p->saved_p[end_idx];
-          re_ctx_p->saved_p[end_idx] = str_curr_p;
-
-          const lit_utf8_byte_t *sub_str_p = NULL;
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
+          uint32_t *frame_p = re_backtrack_push (re_ctx_p, RE_BACKTRACK_NON_GREEDY_GROUP_END, 3);
 
-          if (ecma_is_value_true (match_value))
+          if (frame_p == NULL)
           {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
-          {
-            return match_value;
+            goto stack_limit;
           }
 
-          re_ctx_p->saved_p[end_idx] = old_end_p;
+          frame_p[0] = RE_BC_TO_WORD (re_ctx_p, operands_p);
+          frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+          frame_p[2] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[end_idx]);
+          re_ctx_p->saved_p[end_idx] = str_curr_p;
+          break; /* tail merge */
         }
-        re_ctx_p->num_of_iterations_p[iter_idx]--;
-        bc_p = old_bc_p;
+
+        (*num_of_iter_p)--;
+        bc_p = operands_p;
 
         /* If non-greedy fails and try to iterate... */
         /* FALLTHRU */
@@ -939,228 +1259,327 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
       case RE_OP_CAPTURE_GREEDY_GROUP_END:
       case RE_OP_NON_CAPTURE_GREEDY_GROUP_END:
       {
-        uint32_t start_idx, end_idx, iter_idx, min, max, offset;
-        const lit_utf8_byte_t *old_start_p = NULL;
-        const lit_utf8_byte_t *old_end_p = NULL;
-        const lit_utf8_byte_t *sub_str_p = NULL;
-        uint8_t *old_bc_p;
-
-        end_idx = re_get_value (&bc_p);
-        min = re_get_value (&bc_p);
-        max = re_get_value (&bc_p);
-        offset = re_get_value (&bc_p);
+        re_match_step_t step = re_match_group_end (re_ctx_p, op, &bc_p, str_curr_p);
 
-        if (RE_IS_CAPTURE_GROUP (op))
+        if (step == RE_MATCH_STEP_BACKTRACK)
         {
-          JERRY_ASSERT (end_idx <= re_ctx_p->num_of_captures / 2);
-          iter_idx = end_idx - 1;
-          start_idx = end_idx * 2;
-          end_idx = start_idx + 1;
+          goto backtrack;
         }
-        else
+        else if (step == RE_MATCH_STEP_STACK_LIMIT)
         {
-          JERRY_ASSERT (end_idx <= re_ctx_p->num_of_non_captures);
-          iter_idx = end_idx + (re_ctx_p->num_of_captures / 2) - 1;
-          end_idx += re_ctx_p->num_of_captures;
-          start_idx = end_idx;
+          goto stack_limit;
         }
 
-        /* Check the empty iteration if the minimum number of iterations is reached. */
-        if (re_ctx_p->num_of_iterations_p[iter_idx] >= min
-            && str_curr_p== re_ctx_p->saved_p[start_idx])
-        {
-          return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
-        }
+        break; /* tail merge */
+      }
+      case RE_OP_NON_GREEDY_ITERATOR:
+      case RE_OP_GREEDY_ITERATOR:
+      {
+        uint8_t *operands_p = bc_p;
+        uint32_t min, max, offset, num_of_iter;
 
-        re_ctx_p->num_of_iterations_p[iter_idx]++;
+        min = re_get_value (&bc_p);
+        max = re_get_value (&bc_p);
+        offset = re_get_value (&bc_p);
+        JERRY_TRACE_MSG ("Iterator, min=%lu, max=%lu, offset=%ld\n",
+                         (unsigned long) min, (unsigned long) max, (long) offset);
 
-        old_bc_p = bc_p; /* Save the bytecode end position of the END opcodes for matching after it. */
-        old_end_p = re_ctx_p->saved_p[end_idx];
-        re_ctx_p->saved_p[end_idx] = str_curr_p;
+        /* Simple iterators contain a single character atom, which is matched in place. */
+        bool is_greedy = (op == RE_OP_GREEDY_ITERATOR);
+        uint32_t limit = is_greedy ? max : min;
 
-        if (re_ctx_p->num_of_iterations_p[iter_idx] < max)
+        for (num_of_iter = 0; num_of_iter < limit; num_of_iter++)
         {
-          bc_p -= offset;
-          offset = re_get_value (&bc_p);
-
-          old_start_p = re_ctx_p->saved_p[start_idx];
-          re_ctx_p->saved_p[start_idx] = str_curr_p;
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
+          uint8_t *atom_bc_p = bc_p;
 
-          if (ecma_is_value_true (match_value))
+          if (!re_match_char_atom (re_ctx_p, re_get_opcode (&atom_bc_p), &atom_bc_p, &str_curr_p))
           {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
+            break;
           }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
+        }
+
+        if (num_of_iter < min)
+        {
+          goto backtrack;
+        }
+
+        /* A choice point is needed only if the number of iterations can still be changed. */
+        if (num_of_iter != (is_greedy ? min : max))
+        {
+          uint32_t *frame_p = re_backtrack_push (re_ctx_p,
+                                                 (is_greedy ? RE_BACKTRACK_GREEDY_ITERATOR
+                                                            : RE_BACKTRACK_NON_GREEDY_ITERATOR),
+                                                 3);
+
+          if (frame_p == NULL)
           {
-            return match_value;
+            goto stack_limit;
           }
 
-          re_ctx_p->saved_p[start_idx] = old_start_p;
+          frame_p[0] = RE_BC_TO_WORD (re_ctx_p, operands_p);
+          frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+          frame_p[2] = num_of_iter;
+        }
 
-          /* Try to match alternatives if any. */
-          bc_p += offset;
-          while (*bc_p == RE_OP_ALTERNATIVE)
-          {
-            bc_p++; /* RE_OP_ALTERNATIVE */
-            offset = re_get_value (&bc_p);
+        bc_p += offset;
+        break; /* tail merge */
+      }
+      default:
+      {
+        JERRY_TRACE_MSG ("UNKNOWN opcode (%u)!\n", (unsigned int) op);
+        re_backtrack_stack_free (re_ctx_p);
+        return ecma_raise_common_error (ECMA_ERR_MSG ("Unknown RegExp opcode."));
+      }
+    }
 
-            old_start_p = re_ctx_p->saved_p[start_idx];
-            re_ctx_p->saved_p[start_idx] = str_curr_p;
+    continue;
+
+backtrack:
+    /* The current path failed: resume the most recent choice point. */
+    if (re_ctx_p->stack_top == 0)
+    {
+      return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+    }
 
-            ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
+    uint32_t header = re_ctx_p->stack_p[re_ctx_p->stack_top - 1];
+    uint32_t *frame_p = re_ctx_p->stack_p + re_ctx_p->stack_top - RE_BACKTRACK_GET_SIZE (header);
 
-            if (ecma_is_value_true (match_value))
-            {
-              *out_str_p = sub_str_p;
-              return match_value; /* match */
-            }
-            else if (ECMA_IS_VALUE_ERROR (match_value))
-            {
-              return match_value;
-            }
+    switch (RE_BACKTRACK_GET_STATE (header))
+    {
+      case RE_BACKTRACK_SAVE_AT_START:
+      case RE_BACKTRACK_LOOKAHEAD:
+      {
+        bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
 
-            re_ctx_p->saved_p[start_idx] = old_start_p;
-            bc_p += offset;
-          }
+        if (*bc_p == RE_OP_ALTERNATIVE)
+        {
+          bc_p++;
+          uint32_t offset = re_get_value (&bc_p);
+          frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_p + offset);
+          break;
         }
 
-        if (re_ctx_p->num_of_iterations_p[iter_idx] >= min
-            && re_ctx_p->num_of_iterations_p[iter_idx] <= max)
+        if (RE_BACKTRACK_GET_STATE (header) == RE_BACKTRACK_SAVE_AT_START)
         {
-          /* Try to match the rest of the bytecode. */
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, old_bc_p, str_curr_p, &sub_str_p);
+          re_ctx_p->saved_p[RE_GLOBAL_START_IDX] = RE_WORD_TO_STR (re_ctx_p, frame_p[2]);
+          re_backtrack_pop (re_ctx_p);
+          goto backtrack;
+        }
 
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
-          {
-            return match_value;
-          }
+        /* None of the alternatives of the lookahead matched. */
+        JERRY_ASSERT (*bc_p == RE_OP_MATCH);
+        bc_p++;
+
+        if ((re_opcode_t) frame_p[2] == RE_OP_LOOKAHEAD_NEG)
+        {
+          JERRY_TRACE_MSG ("Execute RE_OP_LOOKAHEAD_NEG: match\n");
+          re_backtrack_set_state (re_ctx_p, RE_BACKTRACK_LOOKAHEAD_CONT);
+          break;
         }
 
-        /* restore if fails */
-        re_ctx_p->saved_p[end_idx] = old_end_p;
-        re_ctx_p->num_of_iterations_p[iter_idx]--;
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+        JERRY_TRACE_MSG ("Execute RE_OP_LOOKAHEAD_POS: fail\n");
+        /* FALLTHRU */
       }
-      case RE_OP_NON_GREEDY_ITERATOR:
+      case RE_BACKTRACK_LOOKAHEAD_CONT:
       {
-        uint32_t min, max, offset, num_of_iter;
-        const lit_utf8_byte_t *sub_str_p = NULL;
-
-        min = re_get_value (&bc_p);
-        max = re_get_value (&bc_p);
+        re_backtrack_restore_saved (re_ctx_p, frame_p + 3);
+        re_backtrack_pop (re_ctx_p);
+        goto backtrack;
+      }
+      case RE_BACKTRACK_NON_GREEDY_ZERO_GROUP:
+      {
+        uint32_t start_idx, end_idx, iter_idx;
 
-        offset = re_get_value (&bc_p);
-        JERRY_TRACE_MSG ("Non-greedy iterator, min=%lu, max=%lu, offset=%ld\n",
-                         (unsigned long) min, (unsigned long) max, (long) offset);
+        bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
+        op = (re_opcode_t) bc_p[-1];
 
-        num_of_iter = 0;
-        while (num_of_iter <= max)
+        if (RE_IS_CAPTURE_GROUP (op))
         {
-          if (num_of_iter >= min)
-          {
-            ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p + offset, str_curr_p, &sub_str_p);
-
-            if (ecma_is_value_true (match_value))
-            {
-              *out_str_p = sub_str_p;
-              return match_value; /* match */
-            }
-            else if (ECMA_IS_VALUE_ERROR (match_value))
-            {
-              return match_value;
-            }
-          }
+          uint8_t *operands_p = bc_p;
+          re_get_group_indices (re_ctx_p, op, re_get_value (&operands_p), &start_idx, &end_idx, &iter_idx);
+          re_ctx_p->saved_p[start_idx] = RE_WORD_TO_STR (re_ctx_p, frame_p[2]);
+        }
 
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
+        re_backtrack_pop (re_ctx_p);
 
-          if (!ecma_is_value_true (match_value))
-          {
-            if (ECMA_IS_VALUE_ERROR (match_value))
-            {
-              return match_value;
-            }
+        if (!re_match_group_start (re_ctx_p, op, &bc_p, str_curr_p))
+        {
+          goto stack_limit;
+        }
+        break;
+      }
+      case RE_BACKTRACK_GROUP_START:
+      {
+        bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[2]);
 
-            break;
-          }
+        if (*bc_p == RE_OP_ALTERNATIVE)
+        {
+          bc_p++;
+          uint32_t offset = re_get_value (&bc_p);
+          frame_p[0] = RE_BC_TO_WORD (re_ctx_p, bc_p + offset);
+          break;
+        }
 
-          str_curr_p = sub_str_p;
-          num_of_iter++;
+        re_ctx_p->num_of_iterations_p[frame_p[4]] = frame_p[6];
+
+        if (frame_p[1] != 0)
+        {
+          /* Try to match after the close paren if zero is allowed. */
+          bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[1]);
+          re_backtrack_set_state (re_ctx_p, RE_BACKTRACK_GROUP_START_CONT);
+          break;
         }
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+
+        /* FALLTHRU */
       }
-      case RE_OP_GREEDY_ITERATOR:
+      case RE_BACKTRACK_GROUP_START_CONT:
       {
-        uint32_t min, max, offset, num_of_iter;
-        const lit_utf8_byte_t *sub_str_p = NULL;
+        re_ctx_p->saved_p[frame_p[3]] = RE_WORD_TO_STR (re_ctx_p, frame_p[5]);
+        re_backtrack_pop (re_ctx_p);
+        goto backtrack;
+      }
+      case RE_BACKTRACK_NON_GREEDY_GROUP_END:
+      {
+        uint32_t start_idx, end_idx, iter_idx;
 
-        min = re_get_value (&bc_p);
-        max = re_get_value (&bc_p);
+        bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
+        op = (re_opcode_t) bc_p[-1];
 
-        offset = re_get_value (&bc_p);
-        JERRY_TRACE_MSG ("Greedy iterator, min=%lu, max=%lu, offset=%ld\n",
-                         (unsigned long) min, (unsigned long) max, (long) offset);
+        uint8_t *operands_p = bc_p;
+        re_get_group_indices (re_ctx_p, op, re_get_value (&operands_p), &start_idx, &end_idx, &iter_idx);
+        re_ctx_p->saved_p[end_idx] = RE_WORD_TO_STR (re_ctx_p, frame_p[2]);
+        re_ctx_p->num_of_iterations_p[iter_idx]--;
+        re_backtrack_pop (re_ctx_p);
 
-        num_of_iter = 0;
+        re_match_step_t step = re_match_group_end (re_ctx_p, op, &bc_p, str_curr_p);
 
-        while (num_of_iter < max)
+        if (step == RE_MATCH_STEP_BACKTRACK)
         {
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_curr_p, &sub_str_p);
-
-          if (!ecma_is_value_true (match_value))
-          {
-            if (ECMA_IS_VALUE_ERROR (match_value))
-            {
-              return match_value;
-            }
+          goto backtrack;
+        }
+        else if (step == RE_MATCH_STEP_STACK_LIMIT)
+        {
+          goto stack_limit;
+        }
+        break;
+      }
+      case RE_BACKTRACK_GROUP_END:
+      case RE_BACKTRACK_GROUP_END_CONT:
+      {
+        uint8_t *operands_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        uint32_t start_idx, end_idx, iter_idx;
 
-            break;
-          }
+        op = (re_opcode_t) operands_p[-1];
+        re_get_group_indices (re_ctx_p, op, re_get_value (&operands_p), &start_idx, &end_idx, &iter_idx);
 
-          str_curr_p = sub_str_p;
-          num_of_iter++;
-        }
+        uint32_t *num_of_iter_p = re_ctx_p->num_of_iterations_p + iter_idx;
 
-        while (num_of_iter >= min)
+        if (RE_BACKTRACK_GET_STATE (header) == RE_BACKTRACK_GROUP_END)
         {
-          ecma_value_t match_value = re_match_regexp (re_ctx_p, bc_p + offset, str_curr_p, &sub_str_p);
+          uint32_t min = re_get_value (&operands_p);
+          uint32_t max = re_get_value (&operands_p);
+          re_get_value (&operands_p); /* start offset */
 
-          if (ecma_is_value_true (match_value))
-          {
-            *out_str_p = sub_str_p;
-            return match_value; /* match */
-          }
-          else if (ECMA_IS_VALUE_ERROR (match_value))
+          re_ctx_p->saved_p[start_idx] = RE_WORD_TO_STR (re_ctx_p, frame_p[2]);
+          str_curr_p = re_ctx_p->saved_p[end_idx];
+          bc_p = RE_WORD_TO_BC (re_ctx_p, frame_p[1]);
+
+          /* Try to match alternatives if any. */
+          if (*bc_p == RE_OP_ALTERNATIVE)
           {
-            return match_value;
+            bc_p++; /* RE_OP_ALTERNATIVE */
+            uint32_t offset = re_get_value (&bc_p);
+
+            frame_p[1] = RE_BC_TO_WORD (re_ctx_p, bc_p + offset);
+            frame_p[2] = RE_STR_TO_WORD (re_ctx_p, re_ctx_p->saved_p[start_idx]);
+            re_ctx_p->saved_p[start_idx] = str_curr_p;
+            break;
           }
 
-          if (num_of_iter == min)
+          if (*num_of_iter_p >= min
+              && *num_of_iter_p <= max)
           {
+            /* Try to match the rest of the bytecode. */
+            bc_p = operands_p;
+            re_backtrack_set_state (re_ctx_p, RE_BACKTRACK_GROUP_END_CONT);
             break;
           }
+        }
+
+        /* restore if fails */
+        re_ctx_p->saved_p[end_idx] = RE_WORD_TO_STR (re_ctx_p, frame_p[3]);
+        (*num_of_iter_p)--;
+        re_backtrack_pop (re_ctx_p);
+        goto backtrack;
+      }
+      case RE_BACKTRACK_NON_GREEDY_ITERATOR:
+      {
+        uint8_t *operands_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        re_get_value (&operands_p); /* min */
+        uint32_t max = re_get_value (&operands_p);
+        uint32_t offset = re_get_value (&operands_p);
+
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
+        bc_p = operands_p;
 
-          lit_utf8_read_prev (&str_curr_p);
-          num_of_iter--;
+        if (!re_match_char_atom (re_ctx_p, re_get_opcode (&bc_p), &bc_p, &str_curr_p))
+        {
+          re_backtrack_pop (re_ctx_p);
+          goto backtrack;
+        }
+
+        uint32_t num_of_iter = frame_p[2] + 1;
+
+        if (num_of_iter == max)
+        {
+          re_backtrack_pop (re_ctx_p);
+        }
+        else
+        {
+          frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+          frame_p[2] = num_of_iter;
         }
-        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+
+        bc_p = operands_p + offset;
+        break;
       }
       default:
       {
-        JERRY_TRACE_MSG ("UNKNOWN opcode (%u)!\n", (unsigned int) op);
-        return ecma_raise_common_error (ECMA_ERR_MSG ("Unknown RegExp opcode."));
+        JERRY_ASSERT (RE_BACKTRACK_GET_STATE (header) == RE_BACKTRACK_GREEDY_ITERATOR);
+
+        uint8_t *operands_p = RE_WORD_TO_BC (re_ctx_p, frame_p[0]);
+        uint32_t min = re_get_value (&operands_p);
+        re_get_value (&operands_p); /* max */
+        uint32_t offset = re_get_value (&operands_p);
+
+        str_curr_p = RE_WORD_TO_STR (re_ctx_p, frame_p[1]);
+        lit_utf8_read_prev (&str_curr_p);
+
+        uint32_t num_of_iter = frame_p[2] - 1;
+
+        if (num_of_iter == min)
+        {
+          re_backtrack_pop (re_ctx_p);
+        }
+        else
+        {
+          frame_p[1] = RE_STR_TO_WORD (re_ctx_p, str_curr_p);
+          frame_p[2] = num_of_iter;
+        }
+
+        bc_p = operands_p + offset;
+        break;
       }
     }
   }
 
-  JERRY_UNREACHABLE ();
-  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
+stack_limit:
+  re_backtrack_stack_free (re_ctx_p);
+  return ecma_raise_range_error (ECMA_ERR_MSG ("RegExp executor stack limit is exceeded."));
 } /* re_match_regexp */
 
 /**
@@ -1215,7 +1634,101 @@ re_set_result_array_properties (ecma_object_t *array_obj_p, /**< result array */
 } /* re_set_result_array_properties */
 
 /**
- * RegExp helper function to start the recursive matching algorithm
+ * Advance the input to the next position where a match can start, using
+ * the results of the bytecode analysis.
+ *
+ * @return true  - if a candidate position is found (the input and the index are updated)
+ *         false - if no match can start at or after the current position
+ */
+static bool
+re_find_match_candidate (const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                         const re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                         const lit_utf8_byte_t **str_p, /**< [in, out] current position of the input */
+                         int32_t *index_p) /**< [in, out] character index of the current position */
+{
+  const lit_utf8_byte_t *str_curr_p = *str_p;
+  const lit_utf8_byte_t *input_end_p = re_ctx_p->input_end_p;
+
+  if (bc_p->analysis_flags & RE_ANALYSIS_ANCHORED_START)
+  {
+    return str_curr_p == re_ctx_p->input_start_p;
+  }
+
+  if (bc_p->prefix_size > 0)
+  {
+    const lit_utf8_byte_t *search_p = str_curr_p;
+    const lit_utf8_byte_t first_byte = bc_p->prefix[0];
+    const size_t prefix_size = bc_p->prefix_size;
+
+    while (true)
+    {
+      if ((size_t) (input_end_p - search_p) < prefix_size)
+      {
+        return false;
+      }
+
+      if (*search_p == first_byte
+          && memcmp (search_p + 1, bc_p->prefix + 1, prefix_size - 1) == 0)
+      {
+        break;
+      }
+
+      search_p++;
+    }
+
+    /* The prefix starts with a complete character, so search_p is on a character boundary. */
+    *index_p += (int32_t) lit_utf8_string_length (str_curr_p, (lit_utf8_size_t) (search_p - str_curr_p));
+    *str_p = search_p;
+    return true;
+  }
+
+  if (bc_p->analysis_flags & RE_ANALYSIS_FIRST_CHARS)
+  {
+    const uint8_t *bitmap_p = bc_p->first_char_bitmap;
+    bool is_non_ascii_possible = (bc_p->analysis_flags & RE_ANALYSIS_NON_ASCII_FIRST_CHAR) != 0;
+    int32_t index = *index_p;
+
+    while (true)
+    {
+      if (str_curr_p >= input_end_p)
+      {
+        /* The pattern always consumes a character, so it cannot match at the end. */
+        return false;
+      }
+
+      lit_utf8_byte_t byte = *str_curr_p;
+
+      if (byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        if (bitmap_p[byte / JERRY_BITSINBYTE] & (1u << (byte % JERRY_BITSINBYTE)))
+        {
+          break;
+        }
+
+        str_curr_p++;
+      }
+      else
+      {
+        if (is_non_ascii_possible)
+        {
+          break;
+        }
+
+        lit_utf8_incr (&str_curr_p);
+      }
+
+      index++;
+    }
+
+    *index_p = index;
+    *str_p = str_curr_p;
+  }
+
+  return true;
+} /* re_find_match_candidate */
+
+/**
+ * RegExp helper function to start the matching algorithm
  * and create the result Array object
  *
  * See also:
@@ -1304,6 +1817,14 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
 
   bool is_match = false;
   re_ctx.num_of_iterations_p = num_of_iter_p;
+  re_ctx.segment_p = NULL;
+  re_ctx.free_segment_p = NULL;
+  re_ctx.stack_p = NULL;
+  re_ctx.stack_top = 0;
+  re_ctx.stack_size = 0;
+#if CONFIG_REGEXP_STEP_LIMIT > 0
+  re_ctx.steps = 0;
+#endif /* CONFIG_REGEXP_STEP_LIMIT > 0 */
   int32_t index = 0;
   ecma_length_t input_str_len;
 
@@ -1338,6 +1859,7 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
   /* 2. Try to match */
   const lit_utf8_byte_t *sub_str_p = NULL;
   uint8_t *bc_start_p = (uint8_t *) (bc_p + 1);
+  re_ctx.bc_start_p = bc_start_p;
 
   while (ecma_is_value_empty (ret_value))
   {
@@ -1355,6 +1877,12 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
     }
     else
     {
+      if (!re_find_match_candidate (bc_p, &re_ctx, &input_curr_p, &index))
+      {
+        index = (int32_t) input_str_len + 1;
+        continue;
+      }
+
       ECMA_TRY_CATCH (match_value, re_match_regexp (&re_ctx,
                                                     bc_start_p,
                                                     input_curr_p,
@@ -1452,6 +1980,7 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
     }
   }
 
+  re_backtrack_stack_free (&re_ctx);
   JMEM_FINALIZE_LOCAL_ARRAY (num_of_iter_p);
   JMEM_FINALIZE_LOCAL_ARRAY (saved_p);
   ECMA_FINALIZE_UTF8_STRING (input_buffer_p, input_buffer_size);
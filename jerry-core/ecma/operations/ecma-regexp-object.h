@@ -39,6 +39,16 @@ typedef enum
   RE_FLAG_MULTILINE = (1u << 3)    /**< ECMA-262 v5, 15.10.7.4 */
 } re_flags_t;
 
+/**
+ * Segment of the backtrack stack of the RegExp matcher, followed by the words of the segment
+ */
+typedef struct re_backtrack_segment_t
+{
+  struct re_backtrack_segment_t *prev_p; /**< previous segment */
+  uint32_t prev_top;                     /**< number of used words of the previous segment */
+  uint32_t size;                         /**< number of words of this segment */
+} re_backtrack_segment_t;
+
 /**
  * RegExp executor context
  */
@@ -50,6 +60,15 @@ typedef struct
   uint32_t num_of_captures;             /**< number of capture groups */
   uint32_t num_of_non_captures;         /**< number of non-capture groups */
   uint32_t *num_of_iterations_p;        /**< number of iterations */
+  uint8_t *bc_start_p;                  /**< start of the RegExp bytecode */
+  re_backtrack_segment_t *segment_p;    /**< current segment of the backtrack stack */
+  re_backtrack_segment_t *free_segment_p; /**< unused segment kept for reuse */
+  uint32_t *stack_p;                    /**< words of the current segment */
+  uint32_t stack_top;                   /**< number of used words of the current segment */
+  uint32_t stack_size;                  /**< number of words of the current segment */
+#if CONFIG_REGEXP_STEP_LIMIT > 0
+  uint32_t steps;                       /**< number of executed matcher steps */
+#endif /* CONFIG_REGEXP_STEP_LIMIT > 0 */
   uint16_t flags;                       /**< RegExp flags */
 } re_matcher_ctx_t;
 
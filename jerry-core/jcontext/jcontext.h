@@ -23,6 +23,7 @@
 #include "ecma-builtins.h"
 #include "jmem-allocator.h"
 #include "jmem-config.h"
+#include "js-parser.h"
 #include "re-bytecode.h"
 #include "vm-defines.h"
 
@@ -46,21 +47,31 @@ typedef struct
   /* Update JERRY_CONTEXT_FIRST_MEMBER if the first member changes */
   ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  const re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  const re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache (rows of entries ordered by their last use) */
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT]; /**< List of marked (visited during
                                                                *   current GC session) and umarked objects */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
-#ifdef JERRY_CPOINTER_32_BIT
+#ifdef JMEM_POOLS_16_BYTE_CHUNKS
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
-#endif /* JERRY_CPOINTER_32_BIT */
+#endif /* JMEM_POOLS_16_BYTE_CHUNKS */
   jmem_free_unused_memory_callback_t jmem_free_unused_memory_callback; /**< Callback for freeing up memory. */
   const lit_utf8_byte_t **lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   ecma_lit_storage_item_t *string_list_first_p; /**< first item of the literal string list */
   ecma_lit_storage_item_t *number_list_first_p; /**< first item of the literal number list */
   ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment */
+#ifndef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  ecma_global_cell_t ecma_global_cells[ECMA_GLOBAL_CELLS_COUNT]; /**< cells of global object properties */
+#endif /* !CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  ecma_for_in_names_t *ecma_for_in_cache[ECMA_FOR_IN_CACHE_SIZE]; /**< names of recently enumerated objects */
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+  parser_code_cache_entry_t parser_code_cache[PARSER_CODE_CACHE_SIZE]; /**< byte code of recently parsed sources
+                                                                        *   (ordered by their last use) */
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
   vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
@@ -72,13 +83,14 @@ typedef struct
   uint8_t ecma_gc_visited_flip_flag; /**< current state of an object's visited flag */
   uint8_t is_direct_eval_form_call; /**< direct call from eval */
   uint8_t jerry_api_available; /**< API availability flag */
-#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
-#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+  uint8_t jerry_has_host_references; /**< the heap refers to memory owned by the application */
 
 #ifdef JMEM_STATS
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
   jmem_pools_stats_t jmem_pools_stats; /**< pools' memory usage statistics */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_stats_t re_cache_stats; /**< RegExp bytecode cache statistics */
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 #endif /* JMEM_STATS */
 
 #ifdef JERRY_VALGRIND_FREYA
@@ -88,11 +88,22 @@ typedef uint32_t jerry_size_t;
  */
 typedef uint32_t jerry_length_t;
 
+#ifndef JERRY_VALUE_NAN_BOXING
+
 /**
  * Description of a JerryScript value
  */
 typedef uint32_t jerry_value_t;
 
+#else /* JERRY_VALUE_NAN_BOXING */
+
+/**
+ * Description of a JerryScript value (NaN boxed 64 bit representation)
+ */
+typedef uint64_t jerry_value_t;
+
+#endif /* !JERRY_VALUE_NAN_BOXING */
+
 
 /**
  * Description of ECMA property descriptor
@@ -136,6 +147,19 @@ typedef struct
   jerry_value_t setter;
 } jerry_property_descriptor_t;
 
+/**
+ * Description of a compilation unit of a snapshot
+ */
+typedef struct
+{
+  const jerry_char_t *name_p; /**< name of the unit (can be NULL for unnamed units) */
+  size_t name_size; /**< size of the name */
+  const jerry_char_t *source_p; /**< script source */
+  size_t source_size; /**< script source size */
+  bool is_for_global; /**< the unit would be executed as global (true) or eval (false) */
+  bool is_strict; /**< strict mode */
+} jerry_snapshot_unit_t;
+
 /**
  * Type of an external function handler
  */
@@ -149,6 +173,51 @@ typedef jerry_value_t (*jerry_external_handler_t) (const jerry_value_t function_
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * Free callback of an external string
+ */
+typedef void (*jerry_external_string_free_callback_t) (const jerry_char_t *str_p, jerry_size_t str_size);
+
+/**
+ * Writer callback receiving the text produced by JSON serialization
+ */
+typedef void (*jerry_json_writer_t) (const jerry_char_t *text_p, jerry_size_t text_size, void *user_data_p);
+
+/**
+ * Events reported by the streaming JSON parser
+ */
+typedef enum
+{
+  JERRY_JSON_EVENT_OBJECT_START, /**< start of an object */
+  JERRY_JSON_EVENT_OBJECT_END, /**< end of an object */
+  JERRY_JSON_EVENT_ARRAY_START, /**< start of an array */
+  JERRY_JSON_EVENT_ARRAY_END, /**< end of an array */
+  JERRY_JSON_EVENT_KEY, /**< property name of an object member (string value) */
+  JERRY_JSON_EVENT_VALUE /**< string, number, boolean or null value */
+} jerry_json_event_t;
+
+/**
+ * Actions requested by the callback of the streaming JSON parser
+ */
+typedef enum
+{
+  JERRY_JSON_ACTION_CONTINUE, /**< continue parsing */
+  JERRY_JSON_ACTION_SKIP, /**< skip the started object or array, or the value of the key */
+  JERRY_JSON_ACTION_STOP /**< stop parsing */
+} jerry_json_action_t;
+
+/**
+ * Callback of the streaming JSON parser
+ */
+typedef jerry_json_action_t (*jerry_json_stream_callback_t) (jerry_json_event_t event,
+                                                             const jerry_value_t value,
+                                                             void *user_data_p);
+
+/**
+ * State of a streaming JSON parser
+ */
+typedef struct jerry_json_stream_t jerry_json_stream_t;
+
 /**
  * Function type applied for each data property of an object
  */
@@ -210,6 +279,17 @@ double jerry_get_number_value (const jerry_value_t);
 jerry_size_t jerry_get_string_size (const jerry_value_t);
 jerry_length_t jerry_get_string_length (const jerry_value_t);
 jerry_size_t jerry_string_to_char_buffer (const jerry_value_t, jerry_char_t *, jerry_size_t);
+const jerry_char_t *jerry_get_string_buffer_view (const jerry_value_t, jerry_size_t *);
+
+/**
+ * JSON functions
+ */
+jerry_value_t jerry_json_parse (const jerry_char_t *, jerry_size_t);
+jerry_size_t jerry_json_stringify_to_buffer (const jerry_value_t, jerry_char_t *, jerry_size_t);
+jerry_value_t jerry_json_stringify_to_writer (const jerry_value_t, jerry_json_writer_t, void *);
+jerry_json_stream_t *jerry_json_stream_create (jerry_json_stream_callback_t, void *);
+jerry_value_t jerry_json_stream_feed (jerry_json_stream_t *, const jerry_char_t *, jerry_size_t);
+jerry_value_t jerry_json_stream_finish (jerry_json_stream_t *);
 
 /**
  * Functions for array object values
@@ -250,6 +330,7 @@ jerry_value_t jerry_create_null (void);
 jerry_value_t jerry_create_object (void);
 jerry_value_t jerry_create_string (const jerry_char_t *);
 jerry_value_t jerry_create_string_sz (const jerry_char_t *, jerry_size_t);
+jerry_value_t jerry_create_external_string (const jerry_char_t *, jerry_size_t, jerry_external_string_free_callback_t);
 jerry_value_t jerry_create_undefined (void);
 
 /**
@@ -289,7 +370,13 @@ bool jerry_foreach_object_property (const jerry_value_t, jerry_object_property_f
  * Snapshot functions
  */
 size_t jerry_parse_and_save_snapshot (const jerry_char_t *, size_t, bool, bool, uint8_t *, size_t);
+size_t jerry_parse_and_save_snapshot_units (const jerry_snapshot_unit_t *, size_t, uint8_t *, size_t);
 jerry_value_t jerry_exec_snapshot (const void *, size_t, bool);
+jerry_value_t jerry_exec_snapshot_at (const void *, size_t, size_t, bool);
+jerry_value_t jerry_exec_snapshot_by_name (const void *, size_t, const jerry_char_t *, size_t, bool);
+size_t jerry_get_snapshot_func_count (const void *, size_t);
+size_t jerry_save_heap_image (uint8_t *, size_t);
+bool jerry_init_from_heap_image (const void *, size_t);
 
 /**
  * @}
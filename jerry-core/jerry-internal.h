@@ -33,4 +33,10 @@ jerry_dispatch_external_function (ecma_object_t *,
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t, ecma_external_pointer_t);
 
+extern void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t, const lit_utf8_byte_t *, lit_utf8_size_t);
+
+extern ecma_json_stream_action_t
+jerry_dispatch_json_stream_callback (ecma_external_pointer_t, ecma_json_stream_event_t, ecma_value_t, void *);
+
 #endif /* !JERRY_INTERNAL_H */
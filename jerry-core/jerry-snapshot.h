@@ -29,14 +29,84 @@ typedef struct
   uint32_t version; /**< version number */
   uint32_t lit_table_offset; /**< offset of the literal table */
   uint32_t lit_table_size; /**< size of literal table */
-  uint32_t is_run_global; /**< flag, indicating whether the snapshot
-                            *   was saved as 'Global scope'-mode code (true)
-                            *   or as eval-mode code (false) */
+  uint32_t func_count; /**< number of entries in the function table */
 } jerry_snapshot_header_t;
 
+/**
+ * Entry of the snapshot function table
+ *
+ * The function table follows the snapshot header. It is followed by the
+ * names of the entries and the byte code of all entries, which share the
+ * literal table of the snapshot.
+ */
+typedef struct
+{
+  uint32_t code_offset; /**< offset of the byte code of the entry */
+  uint32_t name_offset; /**< offset of the name of the entry */
+  uint16_t name_size; /**< size of the name (zero for unnamed entries) */
+  uint16_t is_run_global; /**< flag, indicating whether the entry
+                           *   was saved as 'Global scope'-mode code (true)
+                           *   or as eval-mode code (false) */
+} jerry_snapshot_func_entry_t;
+
 /**
  * Jerry snapshot format version
  */
-#define JERRY_SNAPSHOT_VERSION (6u)
+#define JERRY_SNAPSHOT_VERSION (11u)
+
+/**
+ * Heap image header
+ *
+ * The header is followed by a copy of the engine context and
+ * the used part of the heap, both aligned to JMEM_ALIGNMENT.
+ */
+typedef struct
+{
+  uint32_t version; /**< version number */
+  uint32_t build_flags; /**< jerry_heap_image_build_flags_t bits of the engine, which saved the image */
+  uint32_t snapshot_version; /**< snapshot format version of the engine, which saved the image */
+  uint32_t value_size; /**< size of ecma values */
+  uint32_t context_size; /**< size of the engine context */
+  uint32_t heap_size; /**< size of the saved part of the heap */
+  uint32_t heap_area_size; /**< size of the heap area */
+  uint32_t code_span; /**< distance between two functions of the engine, which saved the image */
+  uint64_t heap_address; /**< start address of the heap, which was saved */
+  uint64_t code_address; /**< code address of the engine, which saved the image */
+} jerry_heap_image_header_t;
+
+/**
+ * Build configuration of the engine, which saved a heap image
+ *
+ * An image can only be restored by an engine with the same configuration.
+ */
+typedef enum
+{
+  JERRY_HEAP_IMAGE_DEBUG = 1u << 0, /**< assertions are enabled */
+  JERRY_HEAP_IMAGE_CPOINTER_32_BIT = 1u << 1, /**< compressed pointers are 32 bit wide */
+  JERRY_HEAP_IMAGE_VALUE_NAN_BOXING = 1u << 2, /**< values are 64 bit NaN boxed */
+  JERRY_HEAP_IMAGE_NUMBER_FLOAT64 = 1u << 3, /**< numbers are 64 bit floats */
+  JERRY_HEAP_IMAGE_MEM_STATS = 1u << 4, /**< memory statistics are collected */
+  JERRY_HEAP_IMAGE_ERROR_MESSAGES = 1u << 5, /**< error messages are enabled */
+  JERRY_HEAP_IMAGE_LCACHE_DISABLE = 1u << 6, /**< LCache is disabled */
+  JERRY_HEAP_IMAGE_PROPERTY_HASHMAP_DISABLE = 1u << 7, /**< property hashmaps are disabled */
+  JERRY_HEAP_IMAGE_FOR_IN_CACHE_DISABLE = 1u << 8, /**< for-in cache is disabled */
+  JERRY_HEAP_IMAGE_GLOBAL_CELLS_DISABLE = 1u << 9, /**< global cells are disabled */
+  JERRY_HEAP_IMAGE_PARSER_CODE_CACHE_DISABLE = 1u << 10, /**< parser code cache is disabled */
+  JERRY_HEAP_IMAGE_ANNEXB_BUILTIN_DISABLE = 1u << 11, /**< Annex B built-ins are disabled */
+  JERRY_HEAP_IMAGE_ARRAY_BUILTIN_DISABLE = 1u << 12, /**< Array built-in is disabled */
+  JERRY_HEAP_IMAGE_BOOLEAN_BUILTIN_DISABLE = 1u << 13, /**< Boolean built-in is disabled */
+  JERRY_HEAP_IMAGE_DATE_BUILTIN_DISABLE = 1u << 14, /**< Date built-in is disabled */
+  JERRY_HEAP_IMAGE_ERROR_BUILTINS_DISABLE = 1u << 15, /**< Error built-ins are disabled */
+  JERRY_HEAP_IMAGE_JSON_BUILTIN_DISABLE = 1u << 16, /**< JSON built-in is disabled */
+  JERRY_HEAP_IMAGE_MATH_BUILTIN_DISABLE = 1u << 17, /**< Math built-in is disabled */
+  JERRY_HEAP_IMAGE_NUMBER_BUILTIN_DISABLE = 1u << 18, /**< Number built-in is disabled */
+  JERRY_HEAP_IMAGE_REGEXP_BUILTIN_DISABLE = 1u << 19, /**< RegExp built-in is disabled */
+  JERRY_HEAP_IMAGE_STRING_BUILTIN_DISABLE = 1u << 20 /**< String built-in is disabled */
+} jerry_heap_image_build_flags_t;
+
+/**
+ * Jerry heap image format version
+ */
+#define JERRY_HEAP_IMAGE_VERSION (2u)
 
 #endif /* !JERRY_SNAPSHOT_H */
@@ -24,8 +24,10 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-global-cells.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
 #include "ecma-objects.h"
@@ -51,6 +53,19 @@ JERRY_STATIC_ASSERT ((int) ECMA_ERROR_COMMON == (int) JERRY_ERROR_COMMON
                      && (int) ECMA_ERROR_URI == (int) JERRY_ERROR_URI,
                      ecma_standard_error_t_must_be_equal_to_jerry_error_t);
 
+JERRY_STATIC_ASSERT ((int) ECMA_JSON_STREAM_OBJECT_START == (int) JERRY_JSON_EVENT_OBJECT_START
+                     && (int) ECMA_JSON_STREAM_OBJECT_END == (int) JERRY_JSON_EVENT_OBJECT_END
+                     && (int) ECMA_JSON_STREAM_ARRAY_START == (int) JERRY_JSON_EVENT_ARRAY_START
+                     && (int) ECMA_JSON_STREAM_ARRAY_END == (int) JERRY_JSON_EVENT_ARRAY_END
+                     && (int) ECMA_JSON_STREAM_KEY == (int) JERRY_JSON_EVENT_KEY
+                     && (int) ECMA_JSON_STREAM_VALUE == (int) JERRY_JSON_EVENT_VALUE,
+                     ecma_json_stream_event_t_must_be_equal_to_jerry_json_event_t);
+
+JERRY_STATIC_ASSERT ((int) ECMA_JSON_STREAM_CONTINUE == (int) JERRY_JSON_ACTION_CONTINUE
+                     && (int) ECMA_JSON_STREAM_SKIP == (int) JERRY_JSON_ACTION_SKIP
+                     && (int) ECMA_JSON_STREAM_STOP == (int) JERRY_JSON_ACTION_STOP,
+                     ecma_json_stream_action_t_must_be_equal_to_jerry_json_action_t);
+
 #ifdef JERRY_ENABLE_ERROR_MESSAGES
 
 /**
@@ -187,6 +202,13 @@ jerry_cleanup (void)
 {
   jerry_assert_api_available ();
 
+#if defined (JMEM_STATS) && !defined (CONFIG_DISABLE_REGEXP_BUILTIN)
+  if (JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_MEM_STATS)
+  {
+    re_cache_stats_print ();
+  }
+#endif /* JMEM_STATS && !CONFIG_DISABLE_REGEXP_BUILTIN */
+
   ecma_finalize ();
   jmem_finalize ();
   jerry_make_api_unavailable ();
@@ -227,6 +249,10 @@ jerry_gc (void)
   jerry_assert_api_available ();
 
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_gc_run ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 } /* jerry_gc */
 
 /**
@@ -541,7 +567,10 @@ jerry_value_clear_error_flag (jerry_value_t *value_p)
 {
   jerry_assert_api_available ();
 
-  *value_p = (*value_p) & ~ECMA_VALUE_ERROR_FLAG;
+  if (ECMA_IS_VALUE_ERROR (*value_p))
+  {
+    *value_p = ecma_get_value_from_error_value (*value_p);
+  }
 } /* jerry_value_clear_error_flag */
 
 /**
@@ -552,7 +581,10 @@ jerry_value_set_error_flag (jerry_value_t *value_p)
 {
   jerry_assert_api_available ();
 
-  *value_p = (*value_p) | ECMA_VALUE_ERROR_FLAG;
+  if (!ECMA_IS_VALUE_ERROR (*value_p))
+  {
+    *value_p = ecma_make_error_value (*value_p);
+  }
 } /* jerry_value_set_error_flag */
 
 /**
@@ -946,6 +978,36 @@ jerry_create_string_sz (const jerry_char_t *str_p, /**< pointer to string */
   return ecma_make_string_value (ecma_str_p);
 } /* jerry_create_string_sz */
 
+/**
+ * Create string which refers to a valid CESU8 string owned by the application
+ *
+ * The characters are not copied: they must not change and must remain available
+ * until the free callback is called. The callback is called when the string is
+ * freed by the engine, or before this function returns when the string has a
+ * representation without character data (e.g. short numbers and magic strings).
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value when it is no longer needed.
+ *
+ * @return value of the created string
+ */
+jerry_value_t
+jerry_create_external_string (const jerry_char_t *str_p, /**< pointer to string */
+                              jerry_size_t str_size, /**< string size */
+                              jerry_external_string_free_callback_t free_cb) /**< callback which releases the
+                                                                              *   characters (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  /* The characters are outside of the heap. */
+  JERRY_CONTEXT (jerry_has_host_references) = true;
+
+  ecma_string_t *ecma_str_p = ecma_new_ecma_external_string_from_utf8 ((lit_utf8_byte_t *) str_p,
+                                                                       (lit_utf8_size_t) str_size,
+                                                                       (ecma_external_pointer_t) free_cb);
+  return ecma_make_string_value (ecma_str_p);
+} /* jerry_create_external_string */
+
 /**
  * Creates a jerry_value_t representing an undefined value.
  *
@@ -1066,6 +1128,246 @@ jerry_string_to_char_buffer (const jerry_value_t value, /**< input string value
                                           buffer_size);
 } /* jerry_string_to_char_buffer */
 
+/**
+ * Get the characters of a string without copying them
+ *
+ * Note:
+ *      The returned buffer is not zero terminated and it is valid
+ *      until the string value is released. Returns NULL, if the
+ *      value parameter is not a string or the characters of the
+ *      string are not stored in a buffer (e.g. short numbers), in
+ *      which case jerry_string_to_char_buffer can be used.
+ *
+ * @return pointer to the characters of the string
+ */
+const jerry_char_t *
+jerry_get_string_buffer_view (const jerry_value_t value, /**< input string value */
+                              jerry_size_t *size_p) /**< [out] size of the string */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (value))
+  {
+    *size_p = 0;
+    return NULL;
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (ecma_get_string_from_value (value), &size, &is_ascii);
+
+  *size_p = (chars_p != NULL) ? (jerry_size_t) size : 0;
+  return (const jerry_char_t *) chars_p;
+} /* jerry_get_string_buffer_view */
+
+/**
+ * Parse a UTF-8 encoded JSON text stored in a character buffer
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return parsed value - if the buffer contains a valid UTF-8 encoded JSON text
+ *         thrown SyntaxError - otherwise
+ */
+jerry_value_t
+jerry_json_parse (const jerry_char_t *buffer_p, /**< JSON text */
+                  jerry_size_t buffer_size) /**< size of the JSON text */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  return ecma_builtin_json_parse_utf8_buffer ((const lit_utf8_byte_t *) buffer_p, (lit_utf8_size_t) buffer_size);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_parse */
+
+/**
+ * Serialize a value into JSON text and copy the text into a specified buffer
+ *
+ * Note:
+ *      The text is not zero terminated. Returns 0, if the value has no
+ *      JSON representation (e.g. undefined or a function), an error is
+ *      thrown during serialization (e.g. cyclic structure) or the buffer
+ *      is not large enough for the whole text.
+ *
+ * @return number of bytes, actually copied to the buffer.
+ */
+jerry_size_t
+jerry_json_stringify_to_buffer (const jerry_value_t value, /**< value to serialize */
+                                jerry_char_t *buffer_p, /**< [out] output characters buffer */
+                                jerry_size_t buffer_size) /**< size of output buffer */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  if (buffer_p == NULL)
+  {
+    return 0;
+  }
+
+  ecma_value_t result = ecma_builtin_json_string_from_value (value);
+
+  if (!ecma_is_value_string (result))
+  {
+    ecma_free_value (result);
+    return 0;
+  }
+
+  jerry_size_t size = jerry_string_to_char_buffer (result, buffer_p, buffer_size);
+  ecma_free_value (result);
+  return size;
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return 0;
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stringify_to_buffer */
+
+/**
+ * Serialize a value into JSON text and pass the text to a writer callback
+ *
+ * Note:
+ *      The writer receives the text without copying it whenever it is
+ *      stored in a character buffer, and the pointer passed to the writer
+ *      is only valid during the call. The writer is not called, if the
+ *      value has no JSON representation or serialization fails.
+ *      Returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return true - if the text was passed to the writer
+ *         false - if the value has no JSON representation
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_json_stringify_to_writer (const jerry_value_t value, /**< value to serialize */
+                                jerry_json_writer_t writer_cb, /**< writer callback */
+                                void *user_data_p) /**< pointer passed to the writer */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  ecma_value_t result = ecma_builtin_json_string_from_value (value);
+
+  if (ECMA_IS_VALUE_ERROR (result))
+  {
+    return result;
+  }
+
+  if (!ecma_is_value_string (result))
+  {
+    ecma_free_value (result);
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
+  }
+
+  ecma_string_t *str_p = ecma_get_string_from_value (result);
+
+  ECMA_STRING_TO_UTF8_STRING (str_p, chars_p, chars_size);
+
+  writer_cb ((const jerry_char_t *) chars_p, (jerry_size_t) chars_size, user_data_p);
+
+  ECMA_FINALIZE_UTF8_STRING (chars_p, chars_size);
+
+  ecma_deref_ecma_string (str_p);
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (writer_cb);
+  JERRY_UNUSED (user_data_p);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stringify_to_writer */
+
+/**
+ * Create a streaming JSON parser
+ *
+ * Note:
+ *      The parser reports the structure of a JSON text, which is fed in chunks,
+ *      to the callback instead of building the resulting value, so its memory
+ *      usage depends only on the nesting depth and on the longest string or
+ *      number of the text. The parser must be released by jerry_json_stream_finish.
+ *
+ * @return new streaming parser - if JSON support is enabled
+ *         NULL - otherwise
+ */
+jerry_json_stream_t *
+jerry_json_stream_create (jerry_json_stream_callback_t callback_p, /**< event callback */
+                          void *user_data_p) /**< pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  return (jerry_json_stream_t *) ecma_builtin_json_stream_create ((ecma_external_pointer_t) callback_p, user_data_p);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (callback_p);
+  JERRY_UNUSED (user_data_p);
+
+  return NULL;
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stream_create */
+
+/**
+ * Feed the next chunk of a JSON text to a streaming JSON parser
+ *
+ * Note:
+ *      Strings and numbers can be split between chunks. The events of the
+ *      chunk are reported before the function returns. Nothing is done after
+ *      parsing is stopped by the callback or an error is detected.
+ *      Returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return true - if the chunk is processed
+ *         false - if parsing was stopped by the callback
+ *         thrown SyntaxError - if the text is invalid
+ */
+jerry_value_t
+jerry_json_stream_feed (jerry_json_stream_t *stream_p, /**< streaming parser */
+                        const jerry_char_t *buffer_p, /**< next chunk of the JSON text */
+                        jerry_size_t buffer_size) /**< size of the chunk */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  return ecma_builtin_json_stream_feed ((ecma_json_stream_t *) stream_p,
+                                        (const lit_utf8_byte_t *) buffer_p,
+                                        (lit_utf8_size_t) buffer_size);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (stream_p);
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stream_feed */
+
+/**
+ * Signal the end of the JSON text to a streaming JSON parser and release the parser
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return true - if the text is a complete JSON text
+ *         false - if parsing was stopped by the callback
+ *         thrown SyntaxError - if the text is invalid or incomplete
+ */
+jerry_value_t
+jerry_json_stream_finish (jerry_json_stream_t *stream_p) /**< streaming parser */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_JSON_BUILTIN
+  return ecma_builtin_json_stream_finish ((ecma_json_stream_t *) stream_p);
+#else /* CONFIG_DISABLE_JSON_BUILTIN */
+  JERRY_UNUSED (stream_p);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG ("JSON support is disabled."));
+#endif /* !CONFIG_DISABLE_JSON_BUILTIN */
+} /* jerry_json_stream_finish */
+
 /**
  * Checks whether the object or it's prototype objects have the given property.
  *
@@ -1708,6 +2010,8 @@ jerry_set_object_native_handle (const jerry_value_t obj_val, /**< object to set
   ecma_create_external_pointer_property (object_p,
                                          ECMA_INTERNAL_PROPERTY_FREE_CALLBACK,
                                          (uintptr_t) freecb_p);
+
+  JERRY_CONTEXT (jerry_has_host_references) = true;
 } /* jerry_set_object_native_handle */
 
 /**
@@ -1726,19 +2030,16 @@ jerry_foreach_object_property (const jerry_value_t obj_val, /**< object value */
 {
   jerry_assert_api_available ();
 
-  ecma_collection_iterator_t names_iter;
   ecma_object_t *object_p = ecma_get_object_from_value (obj_val);
   ecma_collection_header_t *names_p = ecma_op_object_get_property_names (object_p, false, true, true);
-  ecma_collection_iterator_init (&names_iter, names_p);
 
   ecma_value_t property_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   bool continuous = true;
 
-  while (continuous
-         && ecma_collection_iterator_next (&names_iter))
+  for (ecma_length_t i = 0; continuous && i < names_p->unit_number; i++)
   {
-    ecma_string_t *property_name_p = ecma_get_string_from_value (*names_iter.current_value_p);
+    ecma_string_t *property_name_p = ecma_get_string_from_value (names_p->buffer_p[i]);
     property_value = ecma_op_object_get (object_p, property_name_p);
 
     if (ECMA_IS_VALUE_ERROR (property_value))
@@ -1746,7 +2047,7 @@ jerry_foreach_object_property (const jerry_value_t obj_val, /**< object value */
       break;
     }
 
-    continuous = foreach_p (*names_iter.current_value_p, property_value, user_data_p);
+    continuous = foreach_p (names_p->buffer_p[i], property_value, user_data_p);
     ecma_free_value (property_value);
   }
 
@@ -2050,37 +2351,120 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
                                uint8_t *buffer_p, /**< buffer to save snapshot to */
                                size_t buffer_size) /**< the buffer's size */
 {
-#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
-  snapshot_globals_t globals;
-  ecma_value_t parse_status;
-  ecma_compiled_code_t *bytecode_data_p;
+  jerry_snapshot_unit_t unit;
 
-  globals.snapshot_buffer_write_offset = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t),
-                                                        JMEM_ALIGNMENT);
-  globals.snapshot_error_occured = false;
+  unit.name_p = NULL;
+  unit.name_size = 0;
+  unit.source_p = source_p;
+  unit.source_size = source_size;
+  unit.is_for_global = is_for_global;
+  unit.is_strict = is_strict;
 
-  parse_status = parser_parse_script (source_p,
-                                      source_size,
-                                      is_strict,
-                                      &bytecode_data_p);
+  return jerry_parse_and_save_snapshot_units (&unit, 1, buffer_p, buffer_size);
+} /* jerry_parse_and_save_snapshot */
 
-  if (ECMA_IS_VALUE_ERROR (parse_status))
+/**
+ * Generate a snapshot, which contains multiple compilation units
+ *
+ * Note:
+ *      the units share a single literal table, and each of them can be
+ *      executed separately by its index or name. The units are parsed
+ *      one by one, so only the byte code of the current unit is kept in
+ *      the memory of the engine.
+ *
+ * @return size of snapshot, if it was generated succesfully
+ *          (i.e. there are no syntax errors in the sources, buffer size is sufficient,
+ *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT_SAVE),
+ *         0 - otherwise.
+ */
+size_t
+jerry_parse_and_save_snapshot_units (const jerry_snapshot_unit_t *units_p, /**< compilation units */
+                                     size_t units_count, /**< number of units */
+                                     uint8_t *buffer_p, /**< buffer to save snapshot to */
+                                     size_t buffer_size) /**< the buffer's size */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  if (units_count == 0 || units_count > UINT16_MAX)
   {
-    ecma_free_value (parse_status);
     return 0;
   }
 
-  snapshot_add_compiled_code (bytecode_data_p, buffer_p, buffer_size, &globals);
+  size_t name_offset = sizeof (jerry_snapshot_header_t) + units_count * sizeof (jerry_snapshot_func_entry_t);
+  size_t code_offset = name_offset;
 
-  if (globals.snapshot_error_occured)
+  for (size_t i = 0; i < units_count; i++)
+  {
+    if (units_p[i].name_size > UINT16_MAX)
+    {
+      return 0;
+    }
+
+    code_offset += units_p[i].name_size;
+  }
+
+  code_offset = JERRY_ALIGNUP (code_offset, JMEM_ALIGNMENT);
+
+  if (code_offset > buffer_size)
   {
     return 0;
   }
 
+  snapshot_globals_t globals;
+
+  globals.snapshot_buffer_write_offset = code_offset;
+  globals.snapshot_error_occured = false;
+
+  for (size_t i = 0; i < units_count; i++)
+  {
+    const jerry_snapshot_unit_t *unit_p = units_p + i;
+    ecma_compiled_code_t *bytecode_data_p;
+    ecma_value_t parse_status;
+
+    parse_status = parser_parse_script (unit_p->source_p,
+                                        unit_p->source_size,
+                                        unit_p->is_strict,
+                                        &bytecode_data_p);
+
+    if (ECMA_IS_VALUE_ERROR (parse_status))
+    {
+      ecma_free_value (parse_status);
+      return 0;
+    }
+
+    jerry_snapshot_func_entry_t entry;
+    entry.code_offset = (uint32_t) globals.snapshot_buffer_write_offset;
+    entry.name_offset = (uint32_t) name_offset;
+    entry.name_size = (uint16_t) unit_p->name_size;
+    entry.is_run_global = unit_p->is_for_global;
+
+    /* The literals of the byte code are kept alive by the literal
+     * storage, so the byte code can be released after it is copied. */
+    snapshot_add_compiled_code (bytecode_data_p, buffer_p, buffer_size, &globals);
+    ecma_bytecode_deref (bytecode_data_p);
+
+    if (globals.snapshot_error_occured)
+    {
+      return 0;
+    }
+
+    memcpy (buffer_p + sizeof (jerry_snapshot_header_t) + i * sizeof (jerry_snapshot_func_entry_t),
+            &entry,
+            sizeof (jerry_snapshot_func_entry_t));
+
+    if (unit_p->name_size > 0)
+    {
+      memcpy (buffer_p + name_offset, unit_p->name_p, unit_p->name_size);
+      name_offset += unit_p->name_size;
+    }
+  }
+
+  /* Clear the padding between the names and the byte code. */
+  memset (buffer_p + name_offset, 0, code_offset - name_offset);
+
   jerry_snapshot_header_t header;
   header.version = JERRY_SNAPSHOT_VERSION;
   header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
-  header.is_run_global = is_for_global;
+  header.func_count = (uint32_t) units_count;
 
   lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
   uint32_t literals_num;
@@ -2096,8 +2480,8 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
     return 0;
   }
 
-  jerry_snapshot_set_offsets (buffer_p + JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t), JMEM_ALIGNMENT),
-                              (uint32_t) (header.lit_table_offset - sizeof (jerry_snapshot_header_t)),
+  jerry_snapshot_set_offsets (buffer_p + code_offset,
+                              (uint32_t) (header.lit_table_offset - code_offset),
                               lit_map_p);
 
   size_t header_offset = 0;
@@ -2113,20 +2497,16 @@ jerry_parse_and_save_snapshot (const jerry_char_t *source_p, /**< script source
     jmem_heap_free_block (lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
   }
 
-  ecma_bytecode_deref (bytecode_data_p);
-
   return globals.snapshot_buffer_write_offset;
 #else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
-  JERRY_UNUSED (source_p);
-  JERRY_UNUSED (source_size);
-  JERRY_UNUSED (is_for_global);
-  JERRY_UNUSED (is_strict);
+  JERRY_UNUSED (units_p);
+  JERRY_UNUSED (units_count);
   JERRY_UNUSED (buffer_p);
   JERRY_UNUSED (buffer_size);
 
   return 0;
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
-} /* jerry_parse_and_save_snapshot */
+} /* jerry_parse_and_save_snapshot_units */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
@@ -2227,16 +2607,12 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
 
   for (uint32_t i = 0; i < const_literal_end; i++)
   {
-    lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
     if (literal_start_p[i] != 0)
     {
-      while (current_p->literal_offset != literal_start_p[i])
-      {
-        current_p++;
-      }
+      /* Literals are stored as one based indices of the literal table. */
+      JERRY_ASSERT (lit_map_p[literal_start_p[i] - 1].literal_offset == literal_start_p[i]);
 
-      literal_start_p[i] = current_p->literal_id;
+      literal_start_p[i] = lit_map_p[literal_start_p[i] - 1].literal_id;
     }
   }
 
@@ -2268,10 +2644,60 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
 
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+
+/**
+ * Check the header and the function table of a snapshot
+ *
+ * @return pointer to the header - if the snapshot is valid,
+ *         NULL - otherwise
+ */
+static const jerry_snapshot_header_t *
+snapshot_check_header (const uint8_t *snapshot_data_p, /**< snapshot data */
+                       size_t snapshot_size) /**< size of snapshot */
+{
+  if (snapshot_size <= sizeof (jerry_snapshot_header_t))
+  {
+    return NULL;
+  }
+
+  const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) snapshot_data_p;
+
+  if (header_p->version != JERRY_SNAPSHOT_VERSION
+      || header_p->lit_table_offset >= snapshot_size
+      || header_p->func_count == 0
+      || header_p->func_count > UINT16_MAX
+      || (sizeof (jerry_snapshot_header_t)
+          + header_p->func_count * sizeof (jerry_snapshot_func_entry_t)) > header_p->lit_table_offset)
+  {
+    return NULL;
+  }
+
+  return header_p;
+} /* snapshot_check_header */
+
+/**
+ * Get an entry of the snapshot function table
+ */
+static inline void __attr_always_inline___
+snapshot_get_func_entry (const uint8_t *snapshot_data_p, /**< snapshot data */
+                         size_t func_index, /**< index of the entry */
+                         jerry_snapshot_func_entry_t *entry_p) /**< [out] entry */
+{
+  memcpy (entry_p,
+          snapshot_data_p + sizeof (jerry_snapshot_header_t) + func_index * sizeof (jerry_snapshot_func_entry_t),
+          sizeof (jerry_snapshot_func_entry_t));
+} /* snapshot_get_func_entry */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
 /**
  * Execute snapshot from specified buffer
  *
  * Note:
+ *      the first unit of the snapshot is executed
+ *
+ * Note:
  *      returned value must be freed with jerry_release_value, when it is no longer needed.
  *
  * @return result of bytecode - if run was successful
@@ -2288,11 +2714,34 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
                                           *   Otherwise (if the flag is not set) - the buffer could only be
                                           *   freed after the engine stops (i.e. after call to jerry_cleanup). */
 {
+  return jerry_exec_snapshot_at (snapshot_p, snapshot_size, 0, copy_bytecode);
+} /* jerry_exec_snapshot */
+
+/**
+ * Execute the specified unit of a snapshot
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return result of bytecode - if run was successful
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_exec_snapshot_at (const void *snapshot_p, /**< snapshot */
+                        size_t snapshot_size, /**< size of snapshot */
+                        size_t func_index, /**< index of the unit in the function table */
+                        bool copy_bytecode) /**< flag, indicating whether the passed snapshot
+                                             *   buffer should be copied to the engine's memory
+                                             *   (see also: jerry_exec_snapshot) */
+{
+  jerry_assert_api_available ();
+
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
   JERRY_ASSERT (snapshot_p != NULL);
 
   static const char * const invalid_version_error_p = "Invalid snapshot version";
   static const char * const invalid_format_error_p = "Invalid snapshot format";
+  static const char * const invalid_index_error_p = "Invalid snapshot function index";
   const uint8_t *snapshot_data_p = (uint8_t *) snapshot_p;
 
   if (snapshot_size <= sizeof (jerry_snapshot_header_t))
@@ -2300,33 +2749,53 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
     return ecma_raise_type_error (invalid_format_error_p);
   }
 
-  const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) snapshot_data_p;
-
-  if (header_p->version != JERRY_SNAPSHOT_VERSION)
+  if (((const jerry_snapshot_header_t *) snapshot_data_p)->version != JERRY_SNAPSHOT_VERSION)
   {
     return ecma_raise_type_error (invalid_version_error_p);
   }
 
-  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
-  uint32_t literals_num;
+  const jerry_snapshot_header_t *header_p = snapshot_check_header (snapshot_data_p, snapshot_size);
 
-  if (header_p->lit_table_offset >= snapshot_size)
+  if (header_p == NULL)
   {
-    return ecma_raise_type_error (invalid_version_error_p);
+    return ecma_raise_type_error (invalid_format_error_p);
+  }
+
+  if (func_index >= header_p->func_count)
+  {
+    return ecma_raise_range_error (invalid_index_error_p);
+  }
+
+  jerry_snapshot_func_entry_t entry;
+  snapshot_get_func_entry (snapshot_data_p, func_index, &entry);
+
+  if (entry.code_offset >= header_p->lit_table_offset
+      || (entry.code_offset & (JMEM_ALIGNMENT - 1)) != 0)
+  {
+    return ecma_raise_type_error (invalid_format_error_p);
   }
 
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  uint32_t literals_num;
+
   if (!ecma_load_literals_from_snapshot (snapshot_data_p + header_p->lit_table_offset,
                                          header_p->lit_table_size,
                                          &lit_map_p,
-                                         &literals_num))
+                                         &literals_num,
+                                         copy_bytecode))
   {
     JERRY_ASSERT (lit_map_p == NULL);
     return ecma_raise_type_error (invalid_format_error_p);
   }
 
+  if (!copy_bytecode)
+  {
+    JERRY_CONTEXT (jerry_has_host_references) = true;
+  }
+
   ecma_compiled_code_t *bytecode_p;
   bytecode_p = snapshot_load_compiled_code (snapshot_data_p,
-                                            sizeof (jerry_snapshot_header_t),
+                                            entry.code_offset,
                                             lit_map_p,
                                             copy_bytecode);
 
@@ -2342,7 +2811,7 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
 
   ecma_value_t ret_val;
 
-  if (header_p->is_run_global)
+  if (entry.is_run_global)
   {
     ret_val = vm_run_global (bytecode_p);
     ecma_bytecode_deref (bytecode_p);
@@ -2356,11 +2825,403 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
 #else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
   JERRY_UNUSED (snapshot_p);
   JERRY_UNUSED (snapshot_size);
+  JERRY_UNUSED (func_index);
   JERRY_UNUSED (copy_bytecode);
 
   return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
-} /* jerry_exec_snapshot */
+} /* jerry_exec_snapshot_at */
+
+/**
+ * Execute the unit of a snapshot, which has the specified name
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return result of bytecode - if run was successful
+ *         thrown error - otherwise (including the case when no unit has the specified name)
+ */
+jerry_value_t
+jerry_exec_snapshot_by_name (const void *snapshot_p, /**< snapshot */
+                             size_t snapshot_size, /**< size of snapshot */
+                             const jerry_char_t *name_p, /**< name of the unit */
+                             size_t name_size, /**< size of the name */
+                             bool copy_bytecode) /**< flag, indicating whether the passed snapshot
+                                                  *   buffer should be copied to the engine's memory
+                                                  *   (see also: jerry_exec_snapshot) */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  JERRY_ASSERT (snapshot_p != NULL);
+
+  const uint8_t *snapshot_data_p = (uint8_t *) snapshot_p;
+  const jerry_snapshot_header_t *header_p = snapshot_check_header (snapshot_data_p, snapshot_size);
+
+  if (header_p == NULL)
+  {
+    /* Report the error of the header. */
+    return jerry_exec_snapshot_at (snapshot_p, snapshot_size, 0, copy_bytecode);
+  }
+
+  for (size_t i = 0; i < header_p->func_count; i++)
+  {
+    jerry_snapshot_func_entry_t entry;
+    snapshot_get_func_entry (snapshot_data_p, i, &entry);
+
+    if (entry.name_size == name_size
+        && entry.name_offset + name_size <= header_p->lit_table_offset
+        && memcmp (snapshot_data_p + entry.name_offset, name_p, name_size) == 0)
+    {
+      return jerry_exec_snapshot_at (snapshot_p, snapshot_size, i, copy_bytecode);
+    }
+  }
+
+  return ecma_raise_range_error ("Snapshot function not found");
+#else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+  JERRY_UNUSED (snapshot_p);
+  JERRY_UNUSED (snapshot_size);
+  JERRY_UNUSED (name_p);
+  JERRY_UNUSED (name_size);
+  JERRY_UNUSED (copy_bytecode);
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_exec_snapshot_by_name */
+
+/**
+ * Get the number of units in a snapshot
+ *
+ * @return number of units - if the snapshot is valid,
+ *         0 - otherwise
+ */
+size_t
+jerry_get_snapshot_func_count (const void *snapshot_p, /**< snapshot */
+                               size_t snapshot_size) /**< size of snapshot */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  JERRY_ASSERT (snapshot_p != NULL);
+
+  const jerry_snapshot_header_t *header_p = snapshot_check_header ((const uint8_t *) snapshot_p, snapshot_size);
+
+  return (header_p != NULL) ? header_p->func_count : 0;
+#else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+  JERRY_UNUSED (snapshot_p);
+  JERRY_UNUSED (snapshot_size);
+
+  return 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_get_snapshot_func_count */
+
+#if defined (JERRY_ENABLE_SNAPSHOT_SAVE) || defined (JERRY_ENABLE_SNAPSHOT_EXEC)
+
+/**
+ * Fill the fields of a heap image header, which identify the build of the engine
+ *
+ * Note:
+ *      the distance of two functions from different modules changes when the
+ *      engine is rebuilt from different sources, even if its configuration
+ *      and the sizes of its data structures are the same
+ */
+static void
+jerry_heap_image_set_build_info (jerry_heap_image_header_t *header_p) /**< [out] heap image header */
+{
+  uint32_t build_flags = 0;
+
+#ifndef JERRY_NDEBUG
+  build_flags |= JERRY_HEAP_IMAGE_DEBUG;
+#endif /* !JERRY_NDEBUG */
+#ifdef JERRY_CPOINTER_32_BIT
+  build_flags |= JERRY_HEAP_IMAGE_CPOINTER_32_BIT;
+#endif /* JERRY_CPOINTER_32_BIT */
+#ifdef JERRY_VALUE_NAN_BOXING
+  build_flags |= JERRY_HEAP_IMAGE_VALUE_NAN_BOXING;
+#endif /* JERRY_VALUE_NAN_BOXING */
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  build_flags |= JERRY_HEAP_IMAGE_NUMBER_FLOAT64;
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+#ifdef JMEM_STATS
+  build_flags |= JERRY_HEAP_IMAGE_MEM_STATS;
+#endif /* JMEM_STATS */
+#ifdef JERRY_ENABLE_ERROR_MESSAGES
+  build_flags |= JERRY_HEAP_IMAGE_ERROR_MESSAGES;
+#endif /* JERRY_ENABLE_ERROR_MESSAGES */
+#ifdef CONFIG_ECMA_LCACHE_DISABLE
+  build_flags |= JERRY_HEAP_IMAGE_LCACHE_DISABLE;
+#endif /* CONFIG_ECMA_LCACHE_DISABLE */
+#ifdef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  build_flags |= JERRY_HEAP_IMAGE_PROPERTY_HASHMAP_DISABLE;
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+#ifdef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  build_flags |= JERRY_HEAP_IMAGE_FOR_IN_CACHE_DISABLE;
+#endif /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+#ifdef CONFIG_ECMA_GLOBAL_CELLS_DISABLE
+  build_flags |= JERRY_HEAP_IMAGE_GLOBAL_CELLS_DISABLE;
+#endif /* CONFIG_ECMA_GLOBAL_CELLS_DISABLE */
+#ifdef CONFIG_PARSER_CODE_CACHE_DISABLE
+  build_flags |= JERRY_HEAP_IMAGE_PARSER_CODE_CACHE_DISABLE;
+#endif /* CONFIG_PARSER_CODE_CACHE_DISABLE */
+#ifdef CONFIG_DISABLE_ANNEXB_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_ANNEXB_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_ANNEXB_BUILTIN */
+#ifdef CONFIG_DISABLE_ARRAY_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_ARRAY_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_ARRAY_BUILTIN */
+#ifdef CONFIG_DISABLE_BOOLEAN_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_BOOLEAN_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_BOOLEAN_BUILTIN */
+#ifdef CONFIG_DISABLE_DATE_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_DATE_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_DATE_BUILTIN */
+#ifdef CONFIG_DISABLE_ERROR_BUILTINS
+  build_flags |= JERRY_HEAP_IMAGE_ERROR_BUILTINS_DISABLE;
+#endif /* CONFIG_DISABLE_ERROR_BUILTINS */
+#ifdef CONFIG_DISABLE_JSON_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_JSON_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_JSON_BUILTIN */
+#ifdef CONFIG_DISABLE_MATH_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_MATH_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_MATH_BUILTIN */
+#ifdef CONFIG_DISABLE_NUMBER_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_NUMBER_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_NUMBER_BUILTIN */
+#ifdef CONFIG_DISABLE_REGEXP_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_REGEXP_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_REGEXP_BUILTIN */
+#ifdef CONFIG_DISABLE_STRING_BUILTIN
+  build_flags |= JERRY_HEAP_IMAGE_STRING_BUILTIN_DISABLE;
+#endif /* CONFIG_DISABLE_STRING_BUILTIN */
+
+  header_p->version = JERRY_HEAP_IMAGE_VERSION;
+  header_p->build_flags = build_flags;
+  header_p->snapshot_version = JERRY_SNAPSHOT_VERSION;
+  header_p->value_size = (uint32_t) sizeof (ecma_value_t);
+  header_p->context_size = (uint32_t) sizeof (jerry_context_t);
+  header_p->heap_area_size = JMEM_HEAP_AREA_SIZE;
+  header_p->code_span = (uint32_t) ((uintptr_t) ecma_gc_run - (uintptr_t) jerry_init);
+} /* jerry_heap_image_set_build_info */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE || JERRY_ENABLE_SNAPSHOT_EXEC */
+
+/**
+ * Save the current state of the engine into a heap image
+ *
+ * Note:
+ *      the image contains the global object, the literal storage and all
+ *      other live objects, so jerry_init_from_heap_image can later restore
+ *      the engine without executing the initialization scripts again.
+ *      The image can only be restored by the same build of the engine.
+ *
+ * Note:
+ *      the image cannot be saved while code is running, or when the heap
+ *      refers to memory owned by the application (native handles, external
+ *      magic strings or snapshots executed without copying their byte code)
+ *
+ * @return size of the image, if it is saved successfully (i.e. there are no free
+ *         memory blocks in the heap which could not be released, etc.)
+ *         0 - otherwise.
+ */
+size_t
+jerry_save_heap_image (uint8_t *buffer_p, /**< buffer to save the image to */
+                       size_t buffer_size) /**< the buffer's size */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  if (JERRY_CONTEXT (vm_top_context_p) != NULL
+      || JERRY_CONTEXT (lit_magic_string_ex_count) != 0
+      || JERRY_CONTEXT (jerry_has_host_references))
+  {
+    return 0;
+  }
+
+  /* Caches refer to heap objects by raw pointers, and some
+   * of them mark the cached properties, so they are cleared. */
+  ecma_global_cells_invalidate_all ();
+  ecma_lcache_invalidate_all ();
+
+  ecma_free_unused_memory (JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH);
+  jmem_pools_collect_empty ();
+
+  size_t context_size = JERRY_ALIGNUP (sizeof (jerry_context_t), JMEM_ALIGNMENT);
+  size_t heap_size = jmem_heap_get_used_size ();
+  size_t header_size = JERRY_ALIGNUP (sizeof (jerry_heap_image_header_t), JMEM_ALIGNMENT);
+  size_t image_size = header_size + context_size + heap_size;
+
+  if (image_size > buffer_size)
+  {
+    return 0;
+  }
+
+  /* The buffer is not required to be aligned, so the header is copied. */
+  jerry_heap_image_header_t header;
+
+  jerry_heap_image_set_build_info (&header);
+  header.heap_size = (uint32_t) heap_size;
+  header.heap_address = (uintptr_t) &jerry_global_heap;
+  header.code_address = (uintptr_t) jerry_init;
+
+  memset (buffer_p, 0, header_size + context_size);
+  memcpy (buffer_p, &header, sizeof (jerry_heap_image_header_t));
+  memcpy (buffer_p + header_size, &jerry_global_context, sizeof (jerry_context_t));
+  memcpy (buffer_p + header_size + context_size, &jerry_global_heap, heap_size);
+
+  return image_size;
+#else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+} /* jerry_save_heap_image */
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+
+/**
+ * Move a pointer, which refers to the heap, by the specified delta
+ *
+ * @return moved pointer
+ */
+static inline void * __attr_always_inline___
+jerry_heap_image_relocate_pointer (const void *pointer_p, /**< pointer or NULL */
+                                   uintptr_t delta) /**< difference between the new and old heap addresses */
+{
+  if (pointer_p == NULL)
+  {
+    return NULL;
+  }
+
+  return (void *) ((uintptr_t) pointer_p + delta);
+} /* jerry_heap_image_relocate_pointer */
+
+/**
+ * Move the pointers of the engine context, which refer to the heap, by the specified delta
+ */
+static void
+jerry_heap_image_relocate_context (uintptr_t delta) /**< difference between the new and old heap addresses */
+{
+  ecma_object_t **builtin_objects_p = JERRY_CONTEXT (ecma_builtin_objects);
+
+  for (uint32_t i = 0; i < ECMA_BUILTIN_ID__COUNT; i++)
+  {
+    builtin_objects_p[i] = jerry_heap_image_relocate_pointer (builtin_objects_p[i], delta);
+  }
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+  {
+    JERRY_CONTEXT (re_cache)[i] = jerry_heap_image_relocate_pointer (JERRY_CONTEXT (re_cache)[i], delta);
+  }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+
+  ecma_object_t **gc_objects_lists_p = JERRY_CONTEXT (ecma_gc_objects_lists);
+
+  for (uint32_t i = 0; i < ECMA_GC_COLOR__COUNT; i++)
+  {
+    gc_objects_lists_p[i] = jerry_heap_image_relocate_pointer (gc_objects_lists_p[i], delta);
+  }
+
+  JERRY_CONTEXT (string_list_first_p) = jerry_heap_image_relocate_pointer (JERRY_CONTEXT (string_list_first_p), delta);
+  JERRY_CONTEXT (number_list_first_p) = jerry_heap_image_relocate_pointer (JERRY_CONTEXT (number_list_first_p), delta);
+  JERRY_CONTEXT (ecma_global_lex_env_p) = jerry_heap_image_relocate_pointer (JERRY_CONTEXT (ecma_global_lex_env_p),
+                                                                             delta);
+} /* jerry_heap_image_relocate_context */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+/**
+ * Initialize the engine from a heap image created by jerry_save_heap_image
+ *
+ * Note:
+ *      this function can be used instead of jerry_init. The engine is initialized
+ *      with the flags which were in effect when the image was saved. The image
+ *      buffer is not referenced after the function returns.
+ *
+ * @return true - if the engine is initialized from the image,
+ *         false - if the image is invalid (the engine is not initialized in this case).
+ */
+bool
+jerry_init_from_heap_image (const void *image_p, /**< heap image */
+                            size_t image_size) /**< size of the image */
+{
+  if (unlikely (JERRY_CONTEXT (jerry_api_available)))
+  {
+    /* The engine must not be initialized. */
+    JERRY_UNREACHABLE ();
+  }
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  JERRY_ASSERT (image_p != NULL);
+
+  const uint8_t *image_data_p = (const uint8_t *) image_p;
+  size_t context_size = JERRY_ALIGNUP (sizeof (jerry_context_t), JMEM_ALIGNMENT);
+  size_t header_size = JERRY_ALIGNUP (sizeof (jerry_heap_image_header_t), JMEM_ALIGNMENT);
+
+  if (image_size < header_size + context_size)
+  {
+    return false;
+  }
+
+  jerry_heap_image_header_t header;
+  memcpy (&header, image_data_p, sizeof (jerry_heap_image_header_t));
+
+  /* The image must be saved by the same build of the engine. */
+  jerry_heap_image_header_t build_info;
+  jerry_heap_image_set_build_info (&build_info);
+
+  if (header.version != build_info.version
+      || header.build_flags != build_info.build_flags
+      || header.snapshot_version != build_info.snapshot_version
+      || header.value_size != build_info.value_size
+      || header.context_size != build_info.context_size
+      || header.heap_area_size != build_info.heap_area_size
+      || header.code_span != build_info.code_span
+      || header.heap_size > sizeof (jmem_heap_t)
+      || header.heap_size != image_size - header_size - context_size)
+  {
+    return false;
+  }
+
+  uintptr_t heap_delta = (uintptr_t) &jerry_global_heap - (uintptr_t) header.heap_address;
+
+#if defined (JERRY_CPOINTER_32_BIT) || defined (ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY)
+  /* Compressed pointers or the pointers stored in ecma values
+   * are absolute addresses, so the heap cannot be moved. */
+  if (heap_delta != 0)
+  {
+    return false;
+  }
+#endif /* JERRY_CPOINTER_32_BIT || ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+
+  memcpy (&jerry_global_context, image_data_p + header_size, sizeof (jerry_context_t));
+  memcpy (&jerry_global_heap, image_data_p + header_size + context_size, header.heap_size);
+
+  if (heap_delta != 0)
+  {
+    jerry_heap_image_relocate_context (heap_delta);
+  }
+
+  jmem_heap_relocate ((uintptr_t) header.heap_address);
+
+  uintptr_t code_delta = (uintptr_t) jerry_init - (uintptr_t) header.code_address;
+
+  if (code_delta != 0)
+  {
+    ecma_gc_relocate_external_functions (code_delta);
+  }
+
+  JERRY_CONTEXT (jmem_free_unused_memory_callback) = ecma_free_unused_memory;
+  ecma_lcache_init ();
+
+  jerry_make_api_available ();
+  return true;
+#else /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+  JERRY_UNUSED (image_p);
+  JERRY_UNUSED (image_size);
+
+  return false;
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_init_from_heap_image */
 
 /**
  * @}
@@ -2413,3 +3274,40 @@ jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p, /**< poin
 
   jerry_make_api_available ();
 } /* jerry_dispatch_object_free_callback */
+
+/**
+ * Dispatch call to the free callback of an external string
+ *
+ * Note:
+ *       the callback is called during the string's destruction,
+ *       so it should not perform any requests to engine.
+ */
+void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t freecb_p, /**< pointer to free callback */
+                                              const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                              lit_utf8_size_t size) /**< size of the string */
+{
+  jerry_make_api_unavailable ();
+
+  ((jerry_external_string_free_callback_t) freecb_p) ((const jerry_char_t *) chars_p, (jerry_size_t) size);
+
+  jerry_make_api_available ();
+} /* jerry_dispatch_external_string_free_callback */
+
+/**
+ * Dispatch call to the callback of a streaming JSON parser
+ *
+ * @return action requested by the callback
+ */
+ecma_json_stream_action_t
+jerry_dispatch_json_stream_callback (ecma_external_pointer_t callback_p, /**< pointer to the callback */
+                                     ecma_json_stream_event_t event, /**< event */
+                                     ecma_value_t value, /**< value of the event */
+                                     void *user_data_p) /**< pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  return (ecma_json_stream_action_t) ((jerry_json_stream_callback_t) callback_p) ((jerry_json_event_t) event,
+                                                                                   value,
+                                                                                   user_data_p);
+} /* jerry_dispatch_json_stream_callback */
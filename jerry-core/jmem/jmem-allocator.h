@@ -57,6 +57,15 @@ typedef uint32_t jmem_cpointer_t;
 typedef uint16_t jmem_cpointer_t;
 #endif /* JERRY_CPOINTER_32_BIT */
 
+#if defined (JERRY_CPOINTER_32_BIT) || defined (JERRY_VALUE_NAN_BOXING)
+
+/**
+ * Sixteen byte pool chunks are needed by the wider data structures
+ */
+#define JMEM_POOLS_16_BYTE_CHUNKS
+
+#endif /* JERRY_CPOINTER_32_BIT || JERRY_VALUE_NAN_BOXING */
+
 /**
  * Width of compressed memory pointer
  */
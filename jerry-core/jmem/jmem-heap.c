@@ -523,6 +523,109 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
   JMEM_HEAP_STAT_FREE (size);
 } /* jmem_heap_free_block */
 
+/**
+ * Shrink a memory block by releasing its tail.
+ *
+ * Note:
+ *      the block keeps its address, so it must be freed with the new size afterwards
+ */
+void
+jmem_heap_shrink_block (void *ptr, /**< pointer to beginning of data space of the block */
+                        const size_t old_size, /**< current size of the block */
+                        const size_t new_size) /**< new size of the block */
+{
+  JERRY_ASSERT (new_size > 0 && new_size <= old_size);
+
+  const size_t old_aligned_size = (old_size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
+  const size_t new_aligned_size = (new_size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
+
+  if (new_aligned_size < old_aligned_size)
+  {
+    jmem_heap_free_block ((uint8_t *) ptr + new_aligned_size, old_aligned_size - new_aligned_size);
+  }
+
+#ifdef JMEM_STATS
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->waste_bytes -= old_aligned_size - old_size;
+  heap_stats->waste_bytes += new_aligned_size - new_size;
+
+  if (heap_stats->waste_bytes > heap_stats->peak_waste_bytes)
+  {
+    heap_stats->peak_waste_bytes = heap_stats->waste_bytes;
+  }
+  if (heap_stats->waste_bytes > heap_stats->global_peak_waste_bytes)
+  {
+    heap_stats->global_peak_waste_bytes = heap_stats->waste_bytes;
+  }
+#endif /* JMEM_STATS */
+} /* jmem_heap_shrink_block */
+
+/**
+ * Get the size of the heap prefix which contains all allocated blocks
+ *
+ * Note:
+ *      the free region which ends at the end of the heap area is
+ *      included only up to its header, since the rest is unused
+ *
+ * @return number of bytes from the start of the heap (including
+ *         the first free list node) which must be preserved
+ */
+size_t
+jmem_heap_get_used_size (void)
+{
+  size_t used_size = sizeof (jmem_heap_t);
+
+  VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+
+  uint32_t next_offset = JERRY_HEAP_CONTEXT (first).next_offset;
+
+  while (next_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+
+    VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+    if ((uint8_t *) jmem_heap_get_region_end (region_p) == JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_AREA_SIZE)
+    {
+      used_size = (size_t) ((uint8_t *) region_p - (uint8_t *) &JERRY_HEAP_CONTEXT (first));
+      used_size += sizeof (jmem_heap_free_t);
+    }
+
+    next_offset = region_p->next_offset;
+
+    VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+  }
+
+  VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+
+  return used_size;
+} /* jmem_heap_get_used_size */
+
+/**
+ * Update the heap after its content was copied from a heap, which
+ * started at a different address
+ */
+void
+jmem_heap_relocate (uintptr_t old_heap_address) /**< start address of the original heap */
+{
+#if UINTPTR_MAX > UINT32_MAX
+  /* Free regions are linked by offsets, which are position independent. */
+  JERRY_UNUSED (old_heap_address);
+#else /* UINTPTR_MAX <= UINT32_MAX */
+  uintptr_t delta = (uintptr_t) &JERRY_HEAP_CONTEXT (first) - old_heap_address;
+  jmem_heap_free_t *region_p = &JERRY_HEAP_CONTEXT (first);
+
+  while (region_p->next_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    region_p->next_offset = (uint32_t) (region_p->next_offset + delta);
+    region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (region_p->next_offset);
+  }
+#endif /* UINTPTR_MAX > UINT32_MAX */
+
+  JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
+} /* jmem_heap_relocate */
+
 #ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
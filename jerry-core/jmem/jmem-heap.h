@@ -34,7 +34,10 @@ extern void jmem_heap_finalize (void);
 extern void *jmem_heap_alloc_block (const size_t);
 extern void *jmem_heap_alloc_block_null_on_error (const size_t);
 extern void jmem_heap_free_block (void *, const size_t);
+extern void jmem_heap_shrink_block (void *, const size_t, const size_t);
 extern bool jmem_is_heap_pointer (const void *);
+extern size_t jmem_heap_get_used_size (void);
+extern void jmem_heap_relocate (uintptr_t);
 
 #ifdef JMEM_STATS
 /**
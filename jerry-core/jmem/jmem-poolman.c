@@ -86,9 +86,9 @@ jmem_pools_finalize (void)
   jmem_pools_collect_empty ();
 
   JERRY_ASSERT (JERRY_CONTEXT (jmem_free_8_byte_chunk_p) == NULL);
-#ifdef JERRY_CPOINTER_32_BIT
+#ifdef JMEM_POOLS_16_BYTE_CHUNKS
   JERRY_ASSERT (JERRY_CONTEXT (jmem_free_16_byte_chunk_p) == NULL);
-#endif /* JERRY_CPOINTER_32_BIT */
+#endif /* JMEM_POOLS_16_BYTE_CHUNKS */
 } /* jmem_pools_finalize */
 
 /**
@@ -127,7 +127,7 @@ jmem_pools_alloc (size_t size) /**< size of the chunk */
     }
   }
 
-#ifdef JERRY_CPOINTER_32_BIT
+#ifdef JMEM_POOLS_16_BYTE_CHUNKS
   JERRY_ASSERT (size <= 16);
 
   if (JERRY_CONTEXT (jmem_free_16_byte_chunk_p) != NULL)
@@ -149,10 +149,10 @@ jmem_pools_alloc (size_t size) /**< size of the chunk */
     JMEM_POOLS_STAT_NEW_ALLOC ();
     return (void *) jmem_heap_alloc_block (16);
   }
-#else /* !JERRY_CPOINTER_32_BIT */
+#else /* !JMEM_POOLS_16_BYTE_CHUNKS */
   JERRY_UNREACHABLE ();
   return NULL;
-#endif
+#endif /* JMEM_POOLS_16_BYTE_CHUNKS */
 } /* jmem_pools_alloc */
 
 /**
@@ -175,14 +175,14 @@ jmem_pools_free (void *chunk_p, /**< pointer to the chunk */
   }
   else
   {
-#ifdef JERRY_CPOINTER_32_BIT
+#ifdef JMEM_POOLS_16_BYTE_CHUNKS
     JERRY_ASSERT (size <= 16);
 
     chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
     JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = chunk_to_free_p;
-#else /* !JERRY_CPOINTER_32_BIT */
+#else /* !JMEM_POOLS_16_BYTE_CHUNKS */
     JERRY_UNREACHABLE ();
-#endif /* JERRY_CPOINTER_32_BIT */
+#endif /* JMEM_POOLS_16_BYTE_CHUNKS */
   }
 
   VALGRIND_NOACCESS_SPACE (chunk_to_free_p, size);
@@ -210,7 +210,7 @@ jmem_pools_collect_empty ()
     chunk_p = next_p;
   }
 
-#ifdef JERRY_CPOINTER_32_BIT
+#ifdef JMEM_POOLS_16_BYTE_CHUNKS
   chunk_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
   JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = NULL;
 
@@ -224,7 +224,7 @@ jmem_pools_collect_empty ()
     JMEM_POOLS_STAT_DEALLOC ();
     chunk_p = next_p;
   }
-#endif /* JERRY_CPOINTER_32_BIT */
+#endif /* JMEM_POOLS_16_BYTE_CHUNKS */
 } /* jmem_pools_collect_empty */
 
 #ifdef JMEM_STATS
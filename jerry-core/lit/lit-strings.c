@@ -19,18 +19,15 @@
 #include "jrt-libc-includes.h"
 
 /**
- * Validate utf-8 string
- *
- * NOTE:
- *   Isolated surrogates are allowed.
- *   Correct pair of surrogates is not allowed, it should be represented as 4-byte utf-8 character.
+ * Validate utf-8 string, optionally allowing cesu-8 encoded surrogate pairs
  *
  * @return true if utf-8 string is well-formed
  *         false otherwise
  */
-bool
-lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
-                          lit_utf8_size_t buf_size) /**< string size */
+static bool
+lit_validate_utf8_string (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                          lit_utf8_size_t buf_size, /**< string size */
+                          bool allow_surrogate_pairs) /**< allow pairs of 3-byte surrogates */
 {
   lit_utf8_size_t idx = 0;
 
@@ -103,7 +100,8 @@ lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string *
     }
     else if (code_point >= LIT_UTF16_LOW_SURROGATE_MIN
              && code_point <= LIT_UTF16_LOW_SURROGATE_MAX
-             && is_prev_code_point_high_surrogate)
+             && is_prev_code_point_high_surrogate
+             && !allow_surrogate_pairs)
     {
       /* sequence of high and low surrogate is not allowed */
       return false;
@@ -117,8 +115,42 @@ lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string *
   }
 
   return true;
+} /* lit_validate_utf8_string */
+
+/**
+ * Validate utf-8 string
+ *
+ * NOTE:
+ *   Isolated surrogates are allowed.
+ *   Correct pair of surrogates is not allowed, it should be represented as 4-byte utf-8 character.
+ *
+ * @return true if utf-8 string is well-formed
+ *         false otherwise
+ */
+bool
+lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                          lit_utf8_size_t buf_size) /**< string size */
+{
+  return lit_validate_utf8_string (utf8_buf_p, buf_size, false);
 } /* lit_is_utf8_string_valid */
 
+/**
+ * Validate a string, whose characters are encoded either in utf-8 or in cesu-8
+ *
+ * NOTE:
+ *   Characters outside of the basic multilingual plane can be represented
+ *   both as 4-byte utf-8 characters and as pairs of surrogates.
+ *
+ * @return true if the string is well-formed
+ *         false otherwise
+ */
+bool
+lit_is_utf8_or_cesu8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 or cesu-8 string */
+                                   lit_utf8_size_t buf_size) /**< string size */
+{
+  return lit_validate_utf8_string (utf8_buf_p, buf_size, true);
+} /* lit_is_utf8_or_cesu8_string_valid */
+
 /**
  * Validate cesu-8 string
  *
@@ -739,6 +771,65 @@ lit_convert_surrogate_pair_to_code_point (ecma_char_t high_surrogate, /**< high
   return code_point;
 } /* lit_convert_surrogate_pair_to_code_point */
 
+/**
+ * Calculate the size of a valid utf-8 string after it is converted to cesu-8
+ *
+ * Note:
+ *      each 4 byte sequence is converted to a surrogate pair of two 3 byte sequences
+ *
+ * @return size of the cesu-8 representation
+ */
+lit_utf8_size_t
+lit_get_utf8_string_cesu8_size (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                                lit_utf8_size_t buf_size) /**< string size */
+{
+  lit_utf8_size_t cesu8_size = buf_size;
+
+  for (lit_utf8_size_t i = 0; i < buf_size; i++)
+  {
+    if ((utf8_buf_p[i] & LIT_UTF8_4_BYTE_MASK) == LIT_UTF8_4_BYTE_MARKER)
+    {
+      cesu8_size += LIT_UTF8_CESU8_SURROGATE_SIZE_DIF;
+    }
+  }
+
+  return cesu8_size;
+} /* lit_get_utf8_string_cesu8_size */
+
+/**
+ * Convert a valid utf-8 string to cesu-8
+ *
+ * Note:
+ *      the output buffer must be able to hold lit_get_utf8_string_cesu8_size bytes
+ *
+ * @return size of the cesu-8 representation
+ */
+lit_utf8_size_t
+lit_convert_utf8_string_to_cesu8 (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                                  lit_utf8_size_t buf_size, /**< string size */
+                                  lit_utf8_byte_t *cesu8_buf_p) /**< [out] buffer for the cesu-8 string */
+{
+  const lit_utf8_byte_t *utf8_end_p = utf8_buf_p + buf_size;
+  lit_utf8_byte_t *cesu8_start_p = cesu8_buf_p;
+
+  while (utf8_buf_p < utf8_end_p)
+  {
+    if ((*utf8_buf_p & LIT_UTF8_4_BYTE_MASK) != LIT_UTF8_4_BYTE_MARKER)
+    {
+      *cesu8_buf_p++ = *utf8_buf_p++;
+      continue;
+    }
+
+    lit_code_point_t code_point;
+    utf8_buf_p += lit_read_code_point_from_utf8 (utf8_buf_p,
+                                                 (lit_utf8_size_t) (utf8_end_p - utf8_buf_p),
+                                                 &code_point);
+    cesu8_buf_p += lit_code_point_to_cesu8 (code_point, cesu8_buf_p);
+  }
+
+  return (lit_utf8_size_t) (cesu8_buf_p - cesu8_start_p);
+} /* lit_convert_utf8_string_to_cesu8 */
+
 /**
  * Compare cesu-8 string to cesu-8 string
  *
@@ -797,3 +888,140 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**<
 
   return (string1_pos >= string1_end_p && string2_pos < string2_end_p);
 } /* lit_compare_utf8_strings_relational */
+
+/**
+ * Patterns shorter than this size are searched by looking for their first byte with memchr,
+ * longer ones with the Boyer-Moore-Horspool algorithm
+ */
+#define LIT_UTF8_HORSPOOL_MIN_PATTERN_SIZE 4
+
+/**
+ * Find the first occurrence of a cesu-8 pattern in a cesu-8 string
+ *
+ * Note:
+ *      The search compares bytes. Since the first byte of a code unit can
+ *      never be a continuation byte, a match always starts and ends at
+ *      code unit boundaries of the string.
+ *
+ * @return pointer to the first matching byte - if the pattern occurs in the string
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_find_substring (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                         lit_utf8_size_t string_size, /**< string size */
+                         const lit_utf8_byte_t *pattern_p, /**< cesu-8 pattern */
+                         lit_utf8_size_t pattern_size) /**< pattern size */
+{
+  if (pattern_size == 0)
+  {
+    return string_p;
+  }
+
+  if (pattern_size > string_size)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *last_start_p = string_p + (string_size - pattern_size);
+
+  if (pattern_size < LIT_UTF8_HORSPOOL_MIN_PATTERN_SIZE)
+  {
+    const lit_utf8_byte_t first_byte = pattern_p[0];
+
+    while (string_p <= last_start_p)
+    {
+      string_p = (const lit_utf8_byte_t *) memchr (string_p, first_byte, (size_t) (last_start_p - string_p) + 1);
+
+      if (string_p == NULL)
+      {
+        return NULL;
+      }
+
+      if (memcmp (string_p + 1, pattern_p + 1, pattern_size - 1) == 0)
+      {
+        return string_p;
+      }
+
+      string_p++;
+    }
+
+    return NULL;
+  }
+
+  /* Shift distances of the last byte of the current window, limited to
+   * 255, so the table fits into 256 bytes. Smaller shifts are still safe. */
+  uint8_t shift_table[256];
+  const lit_utf8_size_t last_index = pattern_size - 1;
+  const uint8_t max_shift = (uint8_t) JERRY_MIN (pattern_size, 255);
+
+  memset (shift_table, max_shift, sizeof (shift_table));
+
+  for (lit_utf8_size_t i = 0; i < last_index; i++)
+  {
+    shift_table[pattern_p[i]] = (uint8_t) JERRY_MIN (last_index - i, 255);
+  }
+
+  const lit_utf8_byte_t last_byte = pattern_p[last_index];
+
+  while (string_p <= last_start_p)
+  {
+    const lit_utf8_byte_t current_byte = string_p[last_index];
+
+    if (current_byte == last_byte
+        && memcmp (string_p, pattern_p, last_index) == 0)
+    {
+      return string_p;
+    }
+
+    string_p += shift_table[current_byte];
+  }
+
+  return NULL;
+} /* lit_utf8_find_substring */
+
+/**
+ * Find the last occurrence of a cesu-8 pattern in a cesu-8 string
+ *
+ * Note:
+ *      the last byte of the pattern is looked up first in each position,
+ *      see also lit_utf8_find_substring
+ *
+ * @return pointer to the first matching byte of the last occurrence - if the pattern occurs in the string
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_find_last_substring (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                              lit_utf8_size_t string_size, /**< string size */
+                              const lit_utf8_byte_t *pattern_p, /**< cesu-8 pattern */
+                              lit_utf8_size_t pattern_size) /**< pattern size */
+{
+  if (pattern_size > string_size)
+  {
+    return NULL;
+  }
+
+  if (pattern_size == 0)
+  {
+    return string_p + string_size;
+  }
+
+  const lit_utf8_size_t last_index = pattern_size - 1;
+  const lit_utf8_byte_t last_byte = pattern_p[last_index];
+  const lit_utf8_byte_t *current_p = string_p + (string_size - pattern_size);
+
+  while (true)
+  {
+    if (current_p[last_index] == last_byte
+        && memcmp (current_p, pattern_p, last_index) == 0)
+    {
+      return current_p;
+    }
+
+    if (current_p == string_p)
+    {
+      return NULL;
+    }
+
+    current_p--;
+  }
+} /* lit_utf8_find_last_substring */
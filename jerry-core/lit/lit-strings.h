@@ -88,6 +88,7 @@
 /* validation */
 bool lit_is_utf8_string_valid (const lit_utf8_byte_t *, lit_utf8_size_t);
 bool lit_is_cesu8_string_valid (const lit_utf8_byte_t *, lit_utf8_size_t);
+bool lit_is_utf8_or_cesu8_string_valid (const lit_utf8_byte_t *, lit_utf8_size_t);
 
 /* checks */
 bool lit_is_code_point_utf16_low_surrogate (lit_code_point_t);
@@ -112,6 +113,8 @@ lit_utf8_size_t lit_code_unit_to_utf8 (ecma_char_t, lit_utf8_byte_t *);
 lit_utf8_size_t lit_code_point_to_utf8 (lit_code_point_t, lit_utf8_byte_t *);
 lit_utf8_size_t lit_code_point_to_cesu8 (lit_code_point_t, lit_utf8_byte_t *);
 lit_code_point_t lit_convert_surrogate_pair_to_code_point (ecma_char_t, ecma_char_t);
+lit_utf8_size_t lit_get_utf8_string_cesu8_size (const lit_utf8_byte_t *, lit_utf8_size_t);
+lit_utf8_size_t lit_convert_utf8_string_to_cesu8 (const lit_utf8_byte_t *, lit_utf8_size_t, lit_utf8_byte_t *);
 
 bool lit_compare_utf8_strings (const lit_utf8_byte_t *, lit_utf8_size_t,
                                const lit_utf8_byte_t *, lit_utf8_size_t);
@@ -119,6 +122,12 @@ bool lit_compare_utf8_strings (const lit_utf8_byte_t *, lit_utf8_size_t,
 bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, lit_utf8_size_t,
                                           const lit_utf8_byte_t *string2_p, lit_utf8_size_t);
 
+/* search */
+const lit_utf8_byte_t *lit_utf8_find_substring (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                                const lit_utf8_byte_t *, lit_utf8_size_t);
+const lit_utf8_byte_t *lit_utf8_find_last_substring (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                                     const lit_utf8_byte_t *, lit_utf8_size_t);
+
 /* read code point from buffer */
 lit_utf8_size_t lit_read_code_point_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t, lit_code_point_t *);
 
@@ -196,6 +196,11 @@
 #define CBC_BRANCH_IS_FORWARD(flags) \
   ((flags) & CBC_FORWARD_BRANCH_ARG)
 
+/* Switch table entries are never shortened, since
+ * the switch dispatchers index them directly. */
+#define CBC_EXT_IS_BRANCH_TABLE_ENTRY(ext_opcode) \
+  ((ext_opcode) >= CBC_EXT_BRANCH_TABLE_ENTRY && (ext_opcode) <= CBC_EXT_BRANCH_TABLE_ENTRY_3)
+
 /* Stack consumption of opcodes with context. */
 
 /* PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION must be <= 4 */
@@ -530,11 +535,31 @@
               VM_OC_PUSH_UNDEFINED_BASE | VM_OC_PUT_STACK) \
   CBC_FORWARD_BRANCH (CBC_EXT_FINALLY, 0, \
                       VM_OC_FINALLY) \
+  CBC_OPCODE (CBC_EXT_BRANCH_SWITCH_TABLE, CBC_HAS_BYTE_ARG, -1, \
+              VM_OC_BRANCH_SWITCH_TABLE | VM_OC_GET_STACK) \
+  CBC_FORWARD_BRANCH (CBC_EXT_BRANCH_TABLE_ENTRY, 0, \
+                      VM_OC_JUMP) \
+  CBC_OPCODE (CBC_EXT_BRANCH_SWITCH_HASH, CBC_HAS_BYTE_ARG, 0, \
+              VM_OC_BRANCH_SWITCH_HASH) \
+  CBC_OPCODE (CBC_EXT_SET_PROPERTIES, CBC_HAS_POP_STACK_BYTE_ARG, 0, \
+              VM_OC_SET_PROPERTIES) \
+  CBC_OPCODE (CBC_EXT_PROPERTY_NAME, CBC_HAS_LITERAL_ARG, 0, \
+              VM_OC_NONE) \
   \
   /* Basic opcodes. */ \
   CBC_OPCODE (CBC_EXT_DEBUGGER, CBC_NO_FLAG, 0, \
               VM_OC_NONE) \
   \
+  /* Lazy arguments object access opcodes. */ \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_OBJECT, CBC_HAS_LITERAL_ARG, 1, \
+              VM_OC_PUSH_ARGUMENTS_OBJECT | VM_OC_PUT_STACK) \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_LENGTH, CBC_HAS_LITERAL_ARG, 1, \
+              VM_OC_PUSH_ARGUMENTS_LENGTH | VM_OC_PUT_STACK) \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT, CBC_NO_FLAG, -1, \
+              VM_OC_PUSH_ARGUMENTS_ELEMENT | VM_OC_GET_STACK_STACK | VM_OC_PUT_STACK) \
+  CBC_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT_LITERAL, CBC_HAS_LITERAL_ARG, 0, \
+              VM_OC_PUSH_ARGUMENTS_ELEMENT | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_STACK) \
+  \
   /* Binary compound assignment opcodes with pushing the result. */ \
   CBC_EXT_BINARY_LVALUE_OPERATION (CBC_EXT_ASSIGN_ADD, \
                                    ADD) \
@@ -642,6 +667,7 @@ typedef struct
 #define CBC_CODE_FLAGS_STRICT_MODE 0x08
 #define CBC_CODE_FLAGS_ARGUMENTS_NEEDED 0x10
 #define CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED 0x20
+#define CBC_CODE_FLAGS_LAZY_ARGUMENTS 0x40
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
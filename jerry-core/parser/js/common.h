@@ -72,6 +72,8 @@ typedef enum
 #define LEXER_FLAG_SOURCE_PTR 0x20
 /* Initialize this variable after the byte code is freed. */
 #define LEXER_FLAG_LATE_INIT 0x40
+/* This identifier is only referenced by inner functions. */
+#define LEXER_FLAG_INNER_REFERENCE_ONLY 0x80
 
 /**
  * Literal data.
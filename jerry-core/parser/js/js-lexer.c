@@ -1180,6 +1180,7 @@ lexer_process_char_literal (parser_context_t *context_p, /**< context */
         && literal_p->prop.length == length
         && memcmp (literal_p->u.char_p, char_p, length) == 0)
     {
+      literal_p->status_flags = (uint8_t) (literal_p->status_flags & ~LEXER_FLAG_INNER_REFERENCE_ONLY);
       context_p->lit_object.literal_p = literal_p;
       context_p->lit_object.index = (uint16_t) literal_index;
       return;
@@ -1491,8 +1492,9 @@ lexer_construct_literal_object (parser_context_t *context_p, /**< context */
       context_p->lit_object.type = LEXER_LITERAL_OBJECT_ARGUMENTS;
       if (!(context_p->status_flags & PARSER_ARGUMENTS_NOT_NEEDED))
       {
-        context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED;
+        context_p->status_flags |= PARSER_ARGUMENTS_NEEDED;
         context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
+        context_p->arguments_ref_count++;
       }
     }
   }
@@ -1615,6 +1617,7 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
 {
   ecma_compiled_code_t *compiled_code_p;
   lexer_literal_t *literal_p;
+  uint16_t literal_index;
 
   if (context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
@@ -1626,20 +1629,24 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
     extra_status_flags |= PARSER_RESOLVE_THIS_FOR_CALLS;
   }
 
-  context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
-
   literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
   literal_p->type = LEXER_UNUSED_LITERAL;
   literal_p->status_flags = 0;
 
+  literal_index = context_p->literal_count;
   context_p->literal_count++;
 
+  /* The parser_parse_function may append further
+   * literals which are referenced by the function. */
   compiled_code_p = parser_parse_function (context_p, extra_status_flags);
 
   literal_p->u.bytecode_p = compiled_code_p;
 
   literal_p->type = LEXER_FUNCTION_LITERAL;
-  context_p->status_flags |= PARSER_NO_REG_STORE;
+
+  context_p->lit_object.literal_p = literal_p;
+  context_p->lit_object.index = literal_index;
+  context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
 } /* lexer_construct_function_object */
 
 /**
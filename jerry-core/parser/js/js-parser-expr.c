@@ -78,6 +78,81 @@ parser_push_result (parser_context_t *context_p) /**< context */
   }
 } /* parser_push_result */
 
+/**
+ * Prepare the last pushed arguments identifier for a lazy
+ * arguments access, which does not need the arguments object.
+ *
+ * When the identifier is combined with other literals,
+ * it is separated from them.
+ *
+ * @return true - if the last pushed literal is a lazy arguments identifier
+ *         false - otherwise
+ */
+static bool
+parser_prepare_lazy_arguments_access (parser_context_t *context_p) /**< context */
+{
+  if (!PARSER_IS_PUSH_LITERAL (context_p->last_cbc_opcode)
+      || context_p->last_cbc.literal_object_type != LEXER_LITERAL_OBJECT_ARGUMENTS
+      || (context_p->status_flags & (PARSER_INSIDE_WITH | PARSER_ARGUMENTS_NOT_NEEDED | PARSER_NO_REG_STORE)))
+  {
+    return false;
+  }
+
+  JERRY_ASSERT (context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL);
+
+  if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+    parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, context_p->last_cbc.value);
+  }
+  else if (context_p->last_cbc_opcode == CBC_PUSH_THREE_LITERALS)
+  {
+    context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+    parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, context_p->last_cbc.third_literal_index);
+  }
+
+  context_p->last_cbc.literal_type = LEXER_IDENT_LITERAL;
+  context_p->last_cbc.literal_object_type = LEXER_LITERAL_OBJECT_ARGUMENTS;
+  return true;
+} /* parser_prepare_lazy_arguments_access */
+
+/**
+ * Convert a lazy arguments access back to a property access,
+ * since reference operations need the arguments object.
+ */
+void
+parser_revert_lazy_arguments_access (parser_context_t *context_p) /**< context */
+{
+  uint16_t opcode;
+
+  switch (context_p->last_cbc_opcode)
+  {
+    case PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_LENGTH):
+    {
+      /* The value still contains the index of the length literal. */
+      opcode = CBC_PUSH_PROP_LITERAL_LITERAL;
+      break;
+    }
+    case PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT):
+    {
+      opcode = CBC_PUSH_PROP;
+      break;
+    }
+    case PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT_LITERAL):
+    {
+      opcode = CBC_PUSH_PROP_LITERAL;
+      break;
+    }
+    default:
+    {
+      return;
+    }
+  }
+
+  context_p->last_cbc_opcode = opcode;
+  context_p->arguments_ref_count++;
+} /* parser_revert_lazy_arguments_access */
+
 /**
  * Generate byte code for operators with lvalue.
  */
@@ -85,6 +160,8 @@ static void
 parser_emit_unary_lvalue_opcode (parser_context_t *context_p, /**< context */
                                  cbc_opcode_t opcode) /**< opcode */
 {
+  parser_revert_lazy_arguments_access (context_p);
+
   if (PARSER_IS_PUSH_LITERAL (context_p->last_cbc_opcode)
       && context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL)
   {
@@ -266,9 +343,17 @@ typedef enum
 } parser_object_literal_item_types_t;
 
 /**
- * Parse object literal.
+ * Maximum number of object literal properties set by one CBC_EXT_SET_PROPERTIES.
  */
-static void
+#define PARSER_OBJECT_LITERAL_MAX_BATCH 64
+
+/**
+ * Record an object literal item and check its redefinition.
+ *
+ * @return true - if the item name is not used by a previous item
+ *         false - otherwise
+ */
+static bool
 parser_append_object_literal_item (parser_context_t *context_p, /**< context */
                                    uint16_t item_index, /**< index of the item name */
                                    parser_object_literal_item_types_t item_type) /**< type of the item */
@@ -287,7 +372,7 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
     {
       parser_stack_push_uint16 (context_p, item_index);
       parser_stack_push_uint8 (context_p, (uint8_t) item_type);
-      return;
+      return true;
     }
 
     iterator.current_position--;
@@ -321,7 +406,7 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
           && *current_item_type_p == PARSER_OBJECT_PROPERTY_VALUE
           && !(context_p->status_flags & PARSER_IS_STRICT))
       {
-        return;
+        return false;
       }
 
       if (item_type == PARSER_OBJECT_PROPERTY_GETTER
@@ -348,14 +433,57 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
   {
     context_p->stack_top_uint8 = PARSER_OBJECT_PROPERTY_BOTH_ACCESSORS;
   }
+  return false;
 } /* parser_append_object_literal_item */
 
+/**
+ * Emit a CBC_EXT_SET_PROPERTIES byte code, which sets the values of the
+ * last property_count items of an object literal in one step. The names
+ * of the properties follow the byte code as CBC_EXT_PROPERTY_NAME entries.
+ */
+static void
+parser_emit_object_literal_properties (parser_context_t *context_p, /**< context */
+                                       uint32_t property_count) /**< number of properties */
+{
+  uint16_t literal_indices[PARSER_OBJECT_LITERAL_MAX_BATCH];
+  parser_stack_iterator_t iterator;
+
+  JERRY_ASSERT (property_count > 0 && property_count <= PARSER_OBJECT_LITERAL_MAX_BATCH);
+
+  iterator.current_p = context_p->stack.first_p;
+  iterator.current_position = context_p->stack.last_position;
+
+  /* The items are stored as a name index followed by the item type. */
+  for (uint32_t i = property_count; i > 0; i--)
+  {
+    uint8_t item[3];
+
+    parser_stack_iterator_read (&iterator, item, 3);
+    parser_stack_iterator_skip (&iterator, 3);
+
+    JERRY_ASSERT (item[2] == PARSER_OBJECT_PROPERTY_VALUE);
+    literal_indices[i - 1] = (uint16_t) ((item[0] << 8) | item[1]);
+  }
+
+  parser_emit_cbc_ext_call (context_p, CBC_EXT_SET_PROPERTIES, property_count);
+
+  for (uint32_t i = 0; i < property_count; i++)
+  {
+    parser_emit_cbc_ext_literal (context_p, CBC_EXT_PROPERTY_NAME, literal_indices[i]);
+  }
+} /* parser_emit_object_literal_properties */
+
 /**
  * Parse object literal.
  */
 static void
 parser_parse_object_literal (parser_context_t *context_p) /**< context */
 {
+  /* The values of the leading properties with distinct string names are
+   * pushed onto the stack and set together by CBC_EXT_SET_PROPERTIES. */
+  uint32_t pushed_properties = 0;
+  bool is_batched = true;
+
   JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE);
 
   parser_emit_cbc (context_p, CBC_CREATE_OBJECT);
@@ -374,6 +502,13 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
     if (context_p->token.type == LEXER_PROPERTY_GETTER
         || context_p->token.type == LEXER_PROPERTY_SETTER)
     {
+      if (pushed_properties > 0)
+      {
+        parser_emit_object_literal_properties (context_p, pushed_properties);
+        pushed_properties = 0;
+      }
+      is_batched = false;
+
       uint32_t status_flags;
       cbc_ext_opcode_t opcode;
       uint16_t literal_index;
@@ -411,7 +546,7 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
 
       JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL);
       context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (opcode);
-      context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+      context_p->last_cbc.value = context_p->lit_object.index;
 
       lexer_next_token (context_p);
     }
@@ -419,9 +554,33 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
     {
       uint16_t literal_index = context_p->lit_object.index;
 
-      parser_append_object_literal_item (context_p,
-                                         literal_index,
-                                         PARSER_OBJECT_PROPERTY_VALUE);
+      /* Number names may be equal to string names after conversion,
+       * so the properties are set one by one from that point. The
+       * pending items must be on the top of the stack when emitted. */
+      if (is_batched && context_p->token.lit_location.type == LEXER_NUMBER_LITERAL)
+      {
+        if (pushed_properties > 0)
+        {
+          parser_emit_object_literal_properties (context_p, pushed_properties);
+          pushed_properties = 0;
+        }
+        is_batched = false;
+      }
+
+      bool is_new_name = parser_append_object_literal_item (context_p,
+                                                            literal_index,
+                                                            PARSER_OBJECT_PROPERTY_VALUE);
+
+      /* Redefined value items are not pushed onto the stack. */
+      if (is_batched && !is_new_name)
+      {
+        if (pushed_properties > 0)
+        {
+          parser_emit_object_literal_properties (context_p, pushed_properties);
+          pushed_properties = 0;
+        }
+        is_batched = false;
+      }
 
       lexer_next_token (context_p);
       if (context_p->token.type != LEXER_COLON)
@@ -432,7 +591,20 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
       lexer_next_token (context_p);
       parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
 
-      parser_emit_cbc_literal (context_p, CBC_SET_PROPERTY, literal_index);
+      if (is_batched)
+      {
+        pushed_properties++;
+
+        if (pushed_properties >= PARSER_OBJECT_LITERAL_MAX_BATCH)
+        {
+          parser_emit_object_literal_properties (context_p, pushed_properties);
+          pushed_properties = 0;
+        }
+      }
+      else
+      {
+        parser_emit_cbc_literal (context_p, CBC_SET_PROPERTY, literal_index);
+      }
     }
 
     if (context_p->token.type == LEXER_RIGHT_BRACE)
@@ -445,6 +617,11 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
     }
   }
 
+  if (pushed_properties > 0)
+  {
+    parser_emit_object_literal_properties (context_p, pushed_properties);
+  }
+
   while (context_p->stack_top_uint8 != PARSER_OBJECT_PROPERTY_START)
   {
     parser_stack_pop (context_p, NULL, 3);
@@ -609,20 +786,20 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
       {
         context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
         context_p->last_cbc.literal_index = literal1;
-        context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.value = context_p->lit_object.index;
       }
       else if (literals == 2)
       {
         context_p->last_cbc_opcode = CBC_PUSH_THREE_LITERALS;
         context_p->last_cbc.literal_index = literal1;
         context_p->last_cbc.value = literal2;
-        context_p->last_cbc.third_literal_index = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.third_literal_index = context_p->lit_object.index;
       }
       else
       {
         parser_emit_cbc_literal (context_p,
                                  CBC_PUSH_LITERAL,
-                                 (uint16_t) (context_p->literal_count - 1));
+                                 context_p->lit_object.index);
       }
 
       context_p->last_cbc.literal_type = LEXER_FUNCTION_LITERAL;
@@ -717,7 +894,18 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
         JERRY_ASSERT (context_p->token.type == LEXER_LITERAL
                       && context_p->token.lit_location.type == LEXER_STRING_LITERAL);
 
-        if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+        lexer_literal_t *literal_p = context_p->lit_object.literal_p;
+
+        if (literal_p->prop.length == 6
+            && memcmp (literal_p->u.char_p, "length", 6) == 0
+            && parser_prepare_lazy_arguments_access (context_p))
+        {
+          /* The value is kept for parser_revert_lazy_arguments_access. */
+          context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_LENGTH);
+          context_p->last_cbc.value = context_p->lit_object.index;
+          context_p->arguments_ref_count--;
+        }
+        else if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
         {
           JERRY_ASSERT (CBC_ARGS_EQ (CBC_PUSH_PROP_LITERAL_LITERAL,
                                      CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2));
@@ -741,6 +929,14 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
       {
         parser_push_result (context_p);
 
+        bool is_arguments = parser_prepare_lazy_arguments_access (context_p);
+
+        if (is_arguments)
+        {
+          JERRY_ASSERT (PARSER_ARGS_EQ (PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_OBJECT), CBC_HAS_LITERAL_ARG));
+          context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_OBJECT);
+        }
+
         lexer_next_token (context_p);
         parser_parse_expression (context_p, PARSE_EXPR);
         if (context_p->token.type != LEXER_RIGHT_SQUARE)
@@ -749,7 +945,19 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
         }
         lexer_next_token (context_p);
 
-        if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+        if (is_arguments)
+        {
+          if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+          {
+            context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_ARGUMENTS_ELEMENT_LITERAL);
+          }
+          else
+          {
+            parser_emit_cbc_ext (context_p, CBC_EXT_PUSH_ARGUMENTS_ELEMENT);
+          }
+          context_p->arguments_ref_count--;
+        }
+        else if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
         {
           context_p->last_cbc_opcode = CBC_PUSH_PROP_LITERAL;
         }
@@ -791,6 +999,8 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
             is_eval = true;
           }
 
+          parser_revert_lazy_arguments_access (context_p);
+
           if (context_p->last_cbc_opcode == CBC_PUSH_PROP)
           {
             context_p->last_cbc_opcode = CBC_PUSH_PROP_REFERENCE;
@@ -1044,6 +1254,11 @@ parser_append_binary_token (parser_context_t *context_p) /**< context */
 
   parser_push_result (context_p);
 
+  if (LEXER_IS_BINARY_LVALUE_TOKEN (context_p->token.type))
+  {
+    parser_revert_lazy_arguments_access (context_p);
+  }
+
   if (context_p->token.type == LEXER_ASSIGN)
   {
     /* Unlike other tokens, the whole byte code is saved for binary
@@ -52,6 +52,7 @@
 #define PARSER_ARGUMENTS_NOT_NEEDED           0x04000u
 #define PARSER_LEXICAL_ENV_NEEDED             0x08000u
 #define PARSER_HAS_LATE_LIT_INIT              0x10000u
+#define PARSER_LAZY_ARGUMENTS                 0x20000u
 
 /* Expression parsing flags. */
 #define PARSE_EXPR                            0x00
@@ -208,6 +209,8 @@ typedef struct parser_saved_context_t
   uint16_t argument_count;                    /**< number of function arguments */
   uint16_t register_count;                    /**< number of registers */
   uint16_t literal_count;                     /**< number of literals */
+  uint32_t arguments_ref_count;               /**< number of arguments references
+                                               *   which need the arguments object */
 
   /* Memory storage members. */
   parser_mem_data_t byte_code;                /**< byte code buffer */
@@ -253,6 +256,8 @@ typedef struct
   uint16_t argument_count;                    /**< number of function arguments */
   uint16_t register_count;                    /**< number of registers */
   uint16_t literal_count;                     /**< number of literals */
+  uint32_t arguments_ref_count;               /**< number of arguments references
+                                               *   which need the arguments object */
 
   /* Memory storage members. */
   parser_mem_data_t byte_code;                /**< byte code buffer */
@@ -394,6 +399,7 @@ bool lexer_compare_identifier_to_current (parser_context_t *, const lexer_lit_lo
 /* Parser functions. */
 
 void parser_parse_expression (parser_context_t *, int);
+void parser_revert_lazy_arguments_access (parser_context_t *);
 
 /**
  * @}
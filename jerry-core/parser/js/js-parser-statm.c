@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "ecma-helpers.h"
 #include "js-parser-internal.h"
 
 /** \addtogroup parser Parser
@@ -98,6 +99,7 @@ typedef struct
 {
   parser_branch_t default_branch;         /**< branch to the default case */
   parser_branch_node_t *branch_list_p;    /**< branches of case statements */
+  parser_branch_node_t *table_list_p;     /**< unresolved entries of the branch table */
 } parser_switch_statement_t;
 
 /**
@@ -358,7 +360,6 @@ parser_parse_function_statement (parser_context_t *context_p) /**< context */
   }
 
   name_p = context_p->lit_object.literal_p;
-  context_p->status_flags |= PARSER_NO_REG_STORE;
 
   status_flags = PARSER_IS_FUNCTION | PARSER_IS_CLOSURE;
   if (context_p->lit_object.type != LEXER_LITERAL_OBJECT_ANY)
@@ -769,6 +770,7 @@ parser_parse_for_statement_start (parser_context_t *context_p) /**< context */
       uint16_t opcode;
 
       parser_parse_expression (context_p, PARSE_EXPR);
+      parser_revert_lazy_arguments_access (context_p);
 
       opcode = context_p->last_cbc_opcode;
 
@@ -950,6 +952,408 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
   context_p->token = current_token;
 } /* parser_parse_for_statement_end */
 
+/**
+ * Minimum number of cases which are compiled to a branch table.
+ */
+#define PARSER_SWITCH_TABLE_MINIMUM_CASES 4
+
+/**
+ * Maximum number of buckets of a hashed branch table.
+ */
+#define PARSER_SWITCH_TABLE_MAXIMUM_BUCKETS 128
+
+/**
+ * Size of the branch table entry bitmaps in uint32_t units.
+ */
+#define PARSER_SWITCH_BITMAP_SIZE ((CBC_MAXIMUM_BYTE_VALUE + 1) / 32)
+
+/**
+ * Checks whether a bit is set in a branch table entry bitmap.
+ */
+#define PARSER_SWITCH_BITMAP_HAS(bitmap_p, index) \
+  (((bitmap_p)[(index) >> 5] & (1u << ((index) & 0x1f))) != 0)
+
+/**
+ * Sets a bit in a branch table entry bitmap.
+ */
+#define PARSER_SWITCH_BITMAP_SET(bitmap_p, index) \
+  ((bitmap_p)[(index) >> 5] |= (1u << ((index) & 0x1f)))
+
+/**
+ * Clears a bit in a branch table entry bitmap.
+ */
+#define PARSER_SWITCH_BITMAP_CLEAR(bitmap_p, index) \
+  ((bitmap_p)[(index) >> 5] &= ~(1u << ((index) & 0x1f)))
+
+/**
+ * Compilation modes of switch statements.
+ */
+typedef enum
+{
+  PARSER_SWITCH_LINEAR,                   /**< the cases are compared one after the other */
+  PARSER_SWITCH_DENSE_TABLE,              /**< branch table indexed by the case values */
+  PARSER_SWITCH_HASH_TABLE,               /**< branch table indexed by the hash of the case values */
+} parser_switch_mode_t;
+
+/**
+ * Types of constant case values.
+ */
+typedef enum
+{
+  PARSER_SWITCH_CASE_SMALL_NUMBER,        /**< number pushed by a push number instruction */
+  PARSER_SWITCH_CASE_NUMBER,              /**< number literal */
+  PARSER_SWITCH_CASE_STRING,              /**< string literal */
+} parser_switch_case_type_t;
+
+/**
+ * Constant case value.
+ */
+typedef struct
+{
+  lexer_literal_t *literal_p;             /**< literal of the value (unused for small numbers) */
+  ecma_number_t number;                   /**< value of number cases */
+  uint16_t literal_index;                 /**< literal index or the absolute value of small numbers */
+  uint8_t type;                           /**< value type */
+} parser_switch_case_t;
+
+/**
+ * Parse the value of a case statement if it is an optionally
+ * signed number literal or a string literal followed by a colon.
+ *
+ * @return true - if the case value is constant
+ *         false - otherwise
+ */
+static bool
+parser_parse_switch_case_value (parser_context_t *context_p, /**< context */
+                                parser_switch_case_t *case_p) /**< [out] case value */
+{
+  bool is_negative_number = false;
+
+  JERRY_ASSERT (context_p->token.type == LEXER_KEYW_CASE);
+
+  lexer_next_token (context_p);
+
+  if (context_p->token.type == LEXER_ADD
+      || context_p->token.type == LEXER_SUBTRACT)
+  {
+    is_negative_number = (context_p->token.type == LEXER_SUBTRACT);
+    lexer_next_token (context_p);
+
+    if (context_p->token.type != LEXER_LITERAL
+        || context_p->token.lit_location.type != LEXER_NUMBER_LITERAL)
+    {
+      return false;
+    }
+  }
+
+  if (context_p->token.type != LEXER_LITERAL)
+  {
+    return false;
+  }
+
+  if (context_p->token.lit_location.type == LEXER_NUMBER_LITERAL)
+  {
+    if (lexer_construct_number_object (context_p, true, is_negative_number))
+    {
+      case_p->type = PARSER_SWITCH_CASE_SMALL_NUMBER;
+      case_p->number = (ecma_number_t) context_p->lit_object.index;
+
+      if (is_negative_number)
+      {
+        case_p->number = -case_p->number;
+      }
+    }
+    else
+    {
+      ecma_string_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
+                                                              context_p->lit_object.literal_p->u.value);
+
+      case_p->type = PARSER_SWITCH_CASE_NUMBER;
+      case_p->number = ecma_get_number_from_value (number_p->u.lit_number);
+    }
+  }
+  else if (context_p->token.lit_location.type == LEXER_STRING_LITERAL)
+  {
+    lexer_construct_literal_object (context_p,
+                                    &context_p->token.lit_location,
+                                    LEXER_STRING_LITERAL);
+
+    case_p->type = PARSER_SWITCH_CASE_STRING;
+    case_p->number = 0;
+  }
+  else
+  {
+    return false;
+  }
+
+  case_p->literal_p = context_p->lit_object.literal_p;
+  case_p->literal_index = context_p->lit_object.index;
+
+  lexer_next_token (context_p);
+  return context_p->token.type == LEXER_COLON;
+} /* parser_parse_switch_case_value */
+
+/**
+ * Compute the hash of a case value. The result must be the same
+ * as the hash computed by the VM_OC_BRANCH_SWITCH_HASH opcode.
+ *
+ * @return hash of the case value
+ */
+static uint32_t
+parser_switch_case_hash (const parser_switch_case_t *case_p) /**< case value */
+{
+  if (case_p->type != PARSER_SWITCH_CASE_STRING)
+  {
+    return ecma_number_to_uint32 (case_p->number);
+  }
+
+  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (case_p->literal_p->u.char_p,
+                                                            case_p->literal_p->prop.length);
+  uint32_t hash = ecma_string_hash (string_p);
+  ecma_deref_ecma_string (string_p);
+  return hash;
+} /* parser_switch_case_hash */
+
+/**
+ * Push a constant case value onto the stack.
+ */
+static void
+parser_emit_switch_case_value (parser_context_t *context_p, /**< context */
+                               const parser_switch_case_t *case_p) /**< case value */
+{
+  if (case_p->type != PARSER_SWITCH_CASE_SMALL_NUMBER)
+  {
+    parser_emit_cbc_literal (context_p, CBC_PUSH_LITERAL, case_p->literal_index);
+    return;
+  }
+
+  if (case_p->literal_index == 0)
+  {
+    parser_emit_cbc (context_p, CBC_PUSH_NUMBER_0);
+    return;
+  }
+
+  context_p->lit_object.index = case_p->literal_index;
+  parser_emit_cbc_push_number (context_p, case_p->number < 0);
+} /* parser_emit_switch_case_value */
+
+/**
+ * Select the compilation mode of a switch statement. Branch tables
+ * are only used when all case values are constants. Dense tables
+ * are indexed by small non-negative integers, and all other
+ * constant values are dispatched through a hashed table.
+ *
+ * @return compilation mode
+ */
+static parser_switch_mode_t
+parser_switch_select_mode (parser_context_t *context_p, /**< context */
+                           uint32_t *case_count_p, /**< [out] number of cases */
+                           uint32_t *table_arg_p, /**< [out] byte argument of the dispatcher */
+                           uint32_t *case_bitmap_p) /**< [out] bitmap of case values (dense tables only) */
+{
+  lexer_range_t unused_range;
+  uint32_t case_count = 0;
+  uint32_t max_value = 0;
+  uint32_t bucket_count;
+  bool is_dense = true;
+  bool default_case_was_found = false;
+
+  memset (case_bitmap_p, 0, PARSER_SWITCH_BITMAP_SIZE * sizeof (uint32_t));
+
+  while (true)
+  {
+    parser_scan_until (context_p, &unused_range, LEXER_KEYW_CASE);
+
+    if (context_p->token.type == LEXER_KEYW_CASE)
+    {
+      parser_switch_case_t switch_case;
+
+      if (!parser_parse_switch_case_value (context_p, &switch_case))
+      {
+        return PARSER_SWITCH_LINEAR;
+      }
+
+      case_count++;
+
+      if (is_dense)
+      {
+        uint32_t value = (uint32_t) switch_case.literal_index;
+
+        /* Duplicated values are only supported by hashed tables. */
+        if (switch_case.type != PARSER_SWITCH_CASE_SMALL_NUMBER
+            || switch_case.number < 0
+            || value > CBC_MAXIMUM_BYTE_VALUE
+            || PARSER_SWITCH_BITMAP_HAS (case_bitmap_p, value))
+        {
+          is_dense = false;
+        }
+        else
+        {
+          PARSER_SWITCH_BITMAP_SET (case_bitmap_p, value);
+
+          if (value > max_value)
+          {
+            max_value = value;
+          }
+        }
+      }
+    }
+    else if (context_p->token.type == LEXER_KEYW_DEFAULT)
+    {
+      /* Errors are reported by the main loop of the switch statement. */
+      lexer_next_token (context_p);
+
+      if (default_case_was_found || context_p->token.type != LEXER_COLON)
+      {
+        return PARSER_SWITCH_LINEAR;
+      }
+
+      default_case_was_found = true;
+    }
+    else
+    {
+      break;
+    }
+
+    lexer_next_token (context_p);
+  }
+
+  *case_count_p = case_count;
+
+  if (case_count < PARSER_SWITCH_TABLE_MINIMUM_CASES)
+  {
+    return PARSER_SWITCH_LINEAR;
+  }
+
+  /* Dense tables must be at least half filled. */
+  if (is_dense && max_value < 2 * case_count)
+  {
+    *table_arg_p = max_value;
+    return PARSER_SWITCH_DENSE_TABLE;
+  }
+
+  bucket_count = 4;
+  while (bucket_count < 2 * case_count && bucket_count < PARSER_SWITCH_TABLE_MAXIMUM_BUCKETS)
+  {
+    bucket_count <<= 1;
+  }
+
+  *table_arg_p = bucket_count - 1;
+  return PARSER_SWITCH_HASH_TABLE;
+} /* parser_switch_select_mode */
+
+/**
+ * Emit the dispatcher of a switch statement followed by its branch table.
+ *
+ * The entries of dense tables jump to the case statements directly,
+ * while the entries of hashed tables jump to the first comparison of
+ * the case values which belong to the same bucket. The unresolved
+ * entries are stored in the table list of the switch statement.
+ */
+static void
+parser_switch_emit_table (parser_context_t *context_p, /**< context */
+                          parser_switch_statement_t *switch_statement_p, /**< switch statement */
+                          parser_stack_iterator_t *iterator_p, /**< iterator of the switch statement */
+                          parser_switch_mode_t mode, /**< compilation mode */
+                          uint32_t table_arg, /**< byte argument of the dispatcher */
+                          uint32_t *entry_bitmap_p) /**< [in/out] bitmap of the table entries */
+{
+  parser_branch_node_t *last_entry_p = NULL;
+  uint32_t entry_count;
+  uint32_t i;
+
+  if (mode == PARSER_SWITCH_DENSE_TABLE)
+  {
+    parser_emit_cbc_ext_call (context_p, CBC_EXT_BRANCH_SWITCH_TABLE, table_arg);
+    entry_count = table_arg + 1;
+  }
+  else
+  {
+    parser_emit_cbc_ext_call (context_p, CBC_EXT_BRANCH_SWITCH_HASH, table_arg);
+
+    /* The extra entry is used by non-hashable values. */
+    entry_count = table_arg + 2;
+
+    for (i = 0; i < entry_count; i++)
+    {
+      PARSER_SWITCH_BITMAP_SET (entry_bitmap_p, i);
+    }
+  }
+
+  for (i = 0; i < entry_count; i++)
+  {
+    parser_branch_node_t *entry_p;
+
+    entry_p = parser_emit_cbc_forward_branch_item (context_p,
+                                                   PARSER_TO_EXT_OPCODE (CBC_EXT_BRANCH_TABLE_ENTRY),
+                                                   NULL);
+
+    if (last_entry_p == NULL)
+    {
+      switch_statement_p->table_list_p = entry_p;
+      parser_stack_iterator_write (iterator_p, switch_statement_p, sizeof (parser_switch_statement_t));
+    }
+    else
+    {
+      last_entry_p->next_p = entry_p;
+    }
+    last_entry_p = entry_p;
+  }
+
+  if (mode == PARSER_SWITCH_DENSE_TABLE)
+  {
+    parser_branch_node_t **entry_p = &switch_statement_p->table_list_p;
+
+    /* Missing values and values out of range jump to the default case. */
+    for (i = 0; i < entry_count; i++)
+    {
+      if (PARSER_SWITCH_BITMAP_HAS (entry_bitmap_p, i))
+      {
+        entry_p = &(*entry_p)->next_p;
+        continue;
+      }
+
+      parser_branch_node_t *hole_p = *entry_p;
+      *entry_p = hole_p->next_p;
+
+      parser_set_branch_to_current_position (context_p, &hole_p->branch);
+      parser_free (hole_p, sizeof (parser_branch_node_t));
+    }
+
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement_p->default_branch);
+    parser_stack_iterator_write (iterator_p, switch_statement_p, sizeof (parser_switch_statement_t));
+  }
+} /* parser_switch_emit_table */
+
+/**
+ * Remove an entry from the unresolved entries of a branch table.
+ *
+ * @return the removed entry
+ */
+static parser_branch_node_t *
+parser_switch_remove_table_entry (parser_switch_statement_t *switch_statement_p, /**< switch statement */
+                                  uint32_t *entry_bitmap_p, /**< [in/out] bitmap of the unresolved entries */
+                                  uint32_t index) /**< index of the entry */
+{
+  parser_branch_node_t **entry_p = &switch_statement_p->table_list_p;
+  parser_branch_node_t *result_p;
+
+  JERRY_ASSERT (PARSER_SWITCH_BITMAP_HAS (entry_bitmap_p, index));
+
+  for (uint32_t i = 0; i < index; i++)
+  {
+    if (PARSER_SWITCH_BITMAP_HAS (entry_bitmap_p, i))
+    {
+      entry_p = &(*entry_p)->next_p;
+    }
+  }
+
+  result_p = *entry_p;
+  *entry_p = result_p->next_p;
+  PARSER_SWITCH_BITMAP_CLEAR (entry_bitmap_p, index);
+  return result_p;
+} /* parser_switch_remove_table_entry */
+
 /**
  * Parse switch statement (starting part).
  */
@@ -964,6 +1368,11 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
   bool switch_case_was_found;
   bool default_case_was_found;
   parser_branch_node_t *cases_p = NULL;
+  parser_switch_mode_t mode;
+  uint32_t case_count = 0;
+  uint32_t case_index = 0;
+  uint32_t table_arg = 0;
+  uint32_t entry_bitmap[PARSER_SWITCH_BITMAP_SIZE];
 
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_SWITCH);
 
@@ -1001,6 +1410,7 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
    * are done using the iterator. */
 
   switch_statement.branch_list_p = NULL;
+  switch_statement.table_list_p = NULL;
   loop.branch_list_p = NULL;
 
   parser_stack_push (context_p, &switch_statement, sizeof (parser_switch_statement_t));
@@ -1009,6 +1419,16 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
   parser_stack_push_uint8 (context_p, PARSER_STATEMENT_SWITCH);
   parser_stack_iterator_init (context_p, &context_p->last_statement);
 
+  mode = parser_switch_select_mode (context_p, &case_count, &table_arg, entry_bitmap);
+
+  parser_set_range (context_p, &switch_body_start);
+  lexer_next_token (context_p);
+
+  if (mode != PARSER_SWITCH_LINEAR)
+  {
+    parser_switch_emit_table (context_p, &switch_statement, &iterator, mode, table_arg, entry_bitmap);
+  }
+
   switch_case_was_found = false;
   default_case_was_found = false;
 
@@ -1034,7 +1454,7 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
     else if (context_p->token.type == LEXER_KEYW_CASE
              || context_p->token.type == LEXER_RIGHT_BRACE)
     {
-      if (switch_case_was_found)
+      if (switch_case_was_found && mode != PARSER_SWITCH_DENSE_TABLE)
       {
         parser_branch_node_t *new_case_p;
         uint16_t opcode = CBC_BRANCH_IF_STRICT_EQUAL;
@@ -1064,13 +1484,73 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
         break;
       }
 
-      lexer_next_token (context_p);
+      if (mode == PARSER_SWITCH_LINEAR)
+      {
+        lexer_next_token (context_p);
 
-      parser_parse_expression (context_p, PARSE_EXPR);
+        parser_parse_expression (context_p, PARSE_EXPR);
 
-      if (context_p->token.type != LEXER_COLON)
+        if (context_p->token.type != LEXER_COLON)
+        {
+          parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
+        }
+      }
+      else
       {
-        parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
+        parser_switch_case_t switch_case;
+        bool is_constant = parser_parse_switch_case_value (context_p, &switch_case);
+
+        JERRY_ASSERT (is_constant);
+        JERRY_UNUSED (is_constant);
+
+        if (mode == PARSER_SWITCH_DENSE_TABLE)
+        {
+          /* The branches of the case statements must be in source order. */
+          parser_branch_node_t *new_case_p;
+
+          new_case_p = parser_switch_remove_table_entry (&switch_statement,
+                                                         entry_bitmap,
+                                                         (uint32_t) switch_case.literal_index);
+          new_case_p->next_p = NULL;
+
+          if (cases_p == NULL)
+          {
+            switch_statement.branch_list_p = new_case_p;
+          }
+          else
+          {
+            cases_p->next_p = new_case_p;
+          }
+          cases_p = new_case_p;
+        }
+        else if (case_index + 1 < case_count)
+        {
+          uint32_t index = parser_switch_case_hash (&switch_case) & table_arg;
+
+          if (PARSER_SWITCH_BITMAP_HAS (entry_bitmap, index))
+          {
+            parser_branch_node_t *entry_p = parser_switch_remove_table_entry (&switch_statement,
+                                                                              entry_bitmap,
+                                                                              index);
+
+            parser_set_branch_to_current_position (context_p, &entry_p->branch);
+            parser_free (entry_p, sizeof (parser_branch_node_t));
+          }
+        }
+        else
+        {
+          /* Empty buckets and non-hashable values jump to the last comparison. */
+          parser_set_breaks_to_current_position (context_p, switch_statement.table_list_p);
+          switch_statement.table_list_p = NULL;
+        }
+
+        parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+
+        if (mode == PARSER_SWITCH_HASH_TABLE)
+        {
+          parser_emit_switch_case_value (context_p, &switch_case);
+        }
+        case_index++;
       }
       switch_case_was_found = true;
     }
@@ -1079,6 +1559,7 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
   }
 
   JERRY_ASSERT (switch_case_was_found || default_case_was_found);
+  JERRY_ASSERT (switch_statement.table_list_p == NULL);
 
   if (!switch_case_was_found)
   {
@@ -1087,8 +1568,11 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
     parser_emit_cbc (context_p, CBC_POP);
   }
 
-  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement.default_branch);
-  parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+  if (mode != PARSER_SWITCH_DENSE_TABLE)
+  {
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement.default_branch);
+    parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+  }
 
   if (!default_case_was_found)
   {
@@ -2105,6 +2589,13 @@ parser_free_jumps (parser_stack_iterator_t iterator) /**< iterator position */
           parser_free (branch_list_p, sizeof (parser_branch_node_t));
           branch_list_p = next_p;
         }
+        branch_list_p = switch_statement.table_list_p;
+        while (branch_list_p != NULL)
+        {
+          parser_branch_node_t *next_p = branch_list_p->next_p;
+          parser_free (branch_list_p, sizeof (parser_branch_node_t));
+          branch_list_p = next_p;
+        }
         branch_list_p = loop.branch_list_p;
         break;
       }
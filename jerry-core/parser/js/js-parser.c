@@ -72,6 +72,20 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
   parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
   while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
   {
+    if (literal_p->type == LEXER_IDENT_LITERAL
+        && (literal_p->status_flags & LEXER_FLAG_INNER_REFERENCE_ONLY))
+    {
+      /* This identifier was only propagated to the enclosing
+       * function, it is not referenced by the byte code. */
+      JERRY_ASSERT (!(literal_p->status_flags & LEXER_FLAG_VAR));
+
+      util_free_literal (literal_p);
+      literal_p->type = LEXER_UNUSED_LITERAL;
+      literal_p->status_flags = 0;
+      context_p->literal_count--;
+      continue;
+    }
+
 #ifndef PARSER_DUMP_BYTE_CODE
     if (literal_p->type == LEXER_IDENT_LITERAL
         || literal_p->type == LEXER_STRING_LITERAL)
@@ -347,7 +361,8 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
     }
 
     /* A CBC_INITIALIZE_VAR instruction or part of a CBC_INITIALIZE_VARS instruction. */
-    if (!(status_flags & PARSER_HAS_INITIALIZED_VARS))
+    if (!(status_flags & PARSER_HAS_INITIALIZED_VARS)
+        || !(literal_p->status_flags & LEXER_FLAG_NO_REG_STORE))
     {
       length += 2;
       if (literal_p->prop.index > literal_one_byte_limit)
@@ -553,8 +568,6 @@ parser_generate_initializers (parser_context_t *context_p, /**< context */
 
       JERRY_ASSERT (literal_p->type == LEXER_IDENT_LITERAL);
 
-      context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
-
       if (literal_p->status_flags & LEXER_FLAG_FUNCTION_NAME)
       {
         init_index = const_literal_end;
@@ -1072,6 +1085,11 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     JERRY_DEBUG_MSG (",no_lexical_env");
   }
 
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_LAZY_ARGUMENTS)
+  {
+    JERRY_DEBUG_MSG (",lazy_arguments");
+  }
+
   JERRY_DEBUG_MSG ("]\n");
 
   JERRY_DEBUG_MSG ("  Argument range end: %d\n", (int) argument_end);
@@ -1235,6 +1253,58 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     } \
   } while (0)
 
+/**
+ * Check whether the arguments object of a function can be omitted.
+ *
+ * When all references to arguments are lazy arguments accesses
+ * (arguments.length or arguments[...] reads), the values are
+ * read directly from the call frame.
+ */
+static void
+parser_check_lazy_arguments (parser_context_t *context_p) /**< context */
+{
+  if ((context_p->status_flags & (PARSER_ARGUMENTS_NEEDED
+                                  | PARSER_ARGUMENTS_NOT_NEEDED
+                                  | PARSER_NO_REG_STORE)) != PARSER_ARGUMENTS_NEEDED
+      || context_p->arguments_ref_count != 0)
+  {
+    return;
+  }
+
+  if (!(context_p->status_flags & PARSER_IS_STRICT))
+  {
+    parser_list_iterator_t literal_iterator;
+    lexer_literal_t *literal_p;
+
+    /* The mapped arguments are read from the registers,
+     * so all formal parameters must be stored in registers. */
+    parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+    while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
+    {
+      if (literal_p->type != LEXER_IDENT_LITERAL)
+      {
+        continue;
+      }
+
+      if ((literal_p->status_flags & LEXER_FLAG_FUNCTION_ARGUMENT)
+          && (literal_p->status_flags & LEXER_FLAG_NO_REG_STORE))
+      {
+        return;
+      }
+
+      /* Named function expressions store their variables in the lexical environment. */
+      if ((literal_p->status_flags & (LEXER_FLAG_VAR | LEXER_FLAG_INITIALIZED | LEXER_FLAG_FUNCTION_NAME))
+          == (LEXER_FLAG_VAR | LEXER_FLAG_INITIALIZED | LEXER_FLAG_FUNCTION_NAME))
+      {
+        return;
+      }
+    }
+  }
+
+  context_p->status_flags &= ~PARSER_ARGUMENTS_NEEDED;
+  context_p->status_flags |= PARSER_LAZY_ARGUMENTS;
+} /* parser_check_lazy_arguments */
+
 /**
  * Post processing main function.
  *
@@ -1270,6 +1340,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
   JERRY_ASSERT (context_p->literal_count <= PARSER_MAXIMUM_NUMBER_OF_LITERALS);
 
+  parser_check_lazy_arguments (context_p);
+
   initializers_length = parser_compute_indicies (context_p,
                                                  &ident_end,
                                                  &uninitialized_var_end,
@@ -1277,6 +1349,12 @@ parser_post_processing (parser_context_t *context_p) /**< context */
                                                  &const_literal_end);
   length = initializers_length;
 
+  if (initialized_var_end > context_p->register_count)
+  {
+    /* Some variables are stored in the lexical environment. */
+    context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+  }
+
   if (context_p->literal_count <= CBC_MAXIMUM_SMALL_VALUE)
   {
     literal_one_byte_limit = CBC_MAXIMUM_BYTE_VALUE - 1;
@@ -1300,6 +1378,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     uint8_t *opcode_p;
     uint8_t flags;
     size_t branch_offset_length;
+    bool is_table_entry = false;
 
     opcode_p = page_p->bytes + offset;
     last_opcode = (cbc_opcode_t) (*opcode_p);
@@ -1315,6 +1394,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       ext_opcode = (cbc_ext_opcode_t) page_p->bytes[offset];
       branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
       flags = cbc_ext_flags[ext_opcode];
+      is_table_entry = CBC_EXT_IS_BRANCH_TABLE_ENTRY (ext_opcode);
       PARSER_NEXT_BYTE (page_p, offset);
       length++;
     }
@@ -1390,7 +1470,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
     if (flags & CBC_HAS_BRANCH_ARG)
     {
-      bool prefix_zero = true;
+      bool prefix_zero = !is_table_entry;
 #if PARSER_MAXIMUM_CODE_SIZE <= 65535
       cbc_opcode_t jump_forward = CBC_JUMP_FORWARD_2;
 #else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
@@ -1518,6 +1598,11 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED;
   }
 
+  if (context_p->status_flags & PARSER_LAZY_ARGUMENTS)
+  {
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_LAZY_ARGUMENTS;
+  }
+
   literal_pool_p = (jmem_cpointer_t *) byte_code_p;
   byte_code_p += context_p->literal_count * sizeof (jmem_cpointer_t);
 
@@ -1542,6 +1627,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     uint8_t *branch_mark_p;
     cbc_opcode_t opcode;
     size_t branch_offset_length;
+    bool is_table_entry = false;
 
     opcode_p = dst_p;
     branch_mark_p = page_p->bytes + offset;
@@ -1579,6 +1665,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       ext_opcode = (cbc_ext_opcode_t) page_p->bytes[offset];
       flags = cbc_ext_flags[ext_opcode];
       branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (ext_opcode);
+      is_table_entry = CBC_EXT_IS_BRANCH_TABLE_ENTRY (ext_opcode);
 
       /* Storing the extended opcode */
       *dst_p++ = ext_opcode;
@@ -1638,9 +1725,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
     if (flags & CBC_HAS_BRANCH_ARG)
     {
-      bool prefix_zero = true;
+      bool prefix_zero = !is_table_entry;
 
-      /* The leading zeroes are dropped from the stream. */
+      /* The leading zeroes are dropped from the stream
+       * except for switch table entries. */
       JERRY_ASSERT (branch_offset_length > 0 && branch_offset_length <= 3);
 
       while (--branch_offset_length > 0)
@@ -1775,6 +1863,97 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #undef PARSER_NEXT_BYTE
 #undef PARSER_NEXT_BYTE_UPDATE
 
+/**
+ * Mark those variables of the enclosing function which are referenced
+ * by the currently parsed function. Only these variables are moved into
+ * the lexical environment of the enclosing function, all others can be
+ * kept in registers.
+ *
+ * Identifiers which are not declared (yet) by the enclosing function
+ * are appended to its literal pool, so they are propagated further
+ * when the enclosing function is finished.
+ */
+static void
+parser_mark_captured_identifiers (parser_context_t *context_p, /**< context */
+                                  parser_saved_context_t *saved_context_p) /**< saved context
+                                                                            *   of the enclosing function */
+{
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  parser_list_t parent_literal_pool;
+
+  if (saved_context_p->status_flags & PARSER_NO_REG_STORE)
+  {
+    /* All variables of the enclosing function are stored in the lexical environment. */
+    return;
+  }
+
+  if (context_p->status_flags & PARSER_NO_REG_STORE)
+  {
+    /* A direct eval call can access any variable of the enclosing functions. */
+    saved_context_p->status_flags |= PARSER_NO_REG_STORE;
+    return;
+  }
+
+  parent_literal_pool = context_p->literal_pool;
+  parent_literal_pool.data = saved_context_p->literal_pool_data;
+
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    parser_list_iterator_t parent_literal_iterator;
+    lexer_literal_t *parent_literal_p;
+
+    if (literal_p->type != LEXER_IDENT_LITERAL
+        || (literal_p->status_flags & LEXER_FLAG_VAR))
+    {
+      continue;
+    }
+
+    parser_list_iterator_init (&parent_literal_pool, &parent_literal_iterator);
+    while ((parent_literal_p = (lexer_literal_t *) parser_list_iterator_next (&parent_literal_iterator)) != NULL)
+    {
+      if (parent_literal_p->type == LEXER_IDENT_LITERAL
+          && parent_literal_p->prop.length == literal_p->prop.length
+          && memcmp (parent_literal_p->u.char_p, literal_p->u.char_p, literal_p->prop.length) == 0)
+      {
+        break;
+      }
+    }
+
+    if (parent_literal_p != NULL)
+    {
+      parent_literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
+      continue;
+    }
+
+    if (saved_context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+    {
+      parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+    }
+
+    parent_literal_p = (lexer_literal_t *) parser_list_append (context_p, &parent_literal_pool);
+    saved_context_p->literal_pool_data = parent_literal_pool.data;
+    saved_context_p->literal_count++;
+
+    parent_literal_p->u.char_p = literal_p->u.char_p;
+    parent_literal_p->prop.length = literal_p->prop.length;
+    parent_literal_p->type = LEXER_IDENT_LITERAL;
+    parent_literal_p->status_flags = (LEXER_FLAG_NO_REG_STORE
+                                      | LEXER_FLAG_INNER_REFERENCE_ONLY
+                                      | LEXER_FLAG_SOURCE_PTR);
+
+    if (!(literal_p->status_flags & LEXER_FLAG_SOURCE_PTR))
+    {
+      uint8_t *char_p = (uint8_t *) jmem_heap_alloc_block (literal_p->prop.length);
+      memcpy (char_p, literal_p->u.char_p, literal_p->prop.length);
+
+      parent_literal_p->u.char_p = char_p;
+      parent_literal_p->status_flags &= (uint8_t) ~LEXER_FLAG_SOURCE_PTR;
+    }
+  }
+} /* parser_mark_captured_identifiers */
+
 /**
  * Free identifiers and literals.
  */
@@ -1838,6 +2017,7 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   context.argument_count = 0;
   context.register_count = 0;
   context.literal_count = 0;
+  context.arguments_ref_count = 0;
 
   parser_cbc_stream_init (&context.byte_code);
   context.byte_code_size = 0;
@@ -1958,6 +2138,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   saved_context.argument_count = context_p->argument_count;
   saved_context.register_count = context_p->register_count;
   saved_context.literal_count = context_p->literal_count;
+  saved_context.arguments_ref_count = context_p->arguments_ref_count;
 
   saved_context.byte_code = context_p->byte_code;
   saved_context.byte_code_size = context_p->byte_code_size;
@@ -1981,6 +2162,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   context_p->argument_count = 0;
   context_p->register_count = 0;
   context_p->literal_count = 0;
+  context_p->arguments_ref_count = 0;
 
   parser_cbc_stream_init (&context_p->byte_code);
   context_p->byte_code_size = 0;
@@ -2151,6 +2333,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   lexer_next_token (context_p);
   parser_parse_statements (context_p);
+  parser_mark_captured_identifiers (context_p, &saved_context);
   compiled_code_p = parser_post_processing (context_p);
 
 #ifdef PARSER_DUMP_BYTE_CODE
@@ -2175,6 +2358,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   context_p->argument_count = saved_context.argument_count;
   context_p->register_count = saved_context.register_count;
   context_p->literal_count = saved_context.literal_count;
+  context_p->arguments_ref_count = saved_context.arguments_ref_count;
 
   context_p->byte_code = saved_context.byte_code;
   context_p->byte_code_size = saved_context.byte_code_size;
@@ -2229,10 +2413,130 @@ parser_raise_error (parser_context_t *context_p, /**< context */
 #define PARSE_ERR_POS_END         "]"
 #define PARSE_ERR_POS_END_SIZE    ((uint32_t) sizeof (PARSE_ERR_POS_END))
 
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+
+/**
+ * Search for the byte code of a source in the code cache
+ *
+ * The entries are ordered from the most recently used to the least
+ * recently used one, so a found entry is moved to the front.
+ *
+ * @return pointer to the byte code - if found
+ *         NULL - otherwise
+ */
+static ecma_compiled_code_t *
+parser_code_cache_lookup (const uint8_t *source_p, /**< source code */
+                          size_t size, /**< size of the source code */
+                          bool is_strict, /**< strict mode */
+                          lit_string_hash_t hash) /**< hash of the source code */
+{
+  parser_code_cache_entry_t *cache_p = JERRY_CONTEXT (parser_code_cache);
+
+  for (uint32_t i = 0; i < PARSER_CODE_CACHE_SIZE && cache_p[i].bytecode_p != NULL; i++)
+  {
+    if (cache_p[i].hash == hash
+        && cache_p[i].source_size == size
+        && cache_p[i].is_strict == is_strict
+        && memcmp (cache_p[i].source_p, source_p, size) == 0)
+    {
+      parser_code_cache_entry_t entry = cache_p[i];
+
+      for (; i > 0; i--)
+      {
+        cache_p[i] = cache_p[i - 1];
+      }
+
+      cache_p[0] = entry;
+      return entry.bytecode_p;
+    }
+  }
+
+  return NULL;
+} /* parser_code_cache_lookup */
+
+/**
+ * Free the resources of a code cache entry
+ */
+static void
+parser_code_cache_free_entry (parser_code_cache_entry_t *entry_p) /**< entry */
+{
+  JERRY_ASSERT (entry_p->bytecode_p != NULL);
+
+  ecma_bytecode_deref (entry_p->bytecode_p);
+  jmem_heap_free_block (entry_p->source_p, entry_p->source_size);
+  entry_p->bytecode_p = NULL;
+} /* parser_code_cache_free_entry */
+
+/**
+ * Insert a byte code into the code cache
+ *
+ * The byte code becomes the most recently used entry. If the
+ * cache is full, the least recently used entry is removed.
+ */
+static void
+parser_code_cache_insert (const uint8_t *source_p, /**< source code */
+                          size_t size, /**< size of the source code */
+                          bool is_strict, /**< strict mode */
+                          lit_string_hash_t hash, /**< hash of the source code */
+                          ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  /* The allocation may flush the cache, so it is done before the entries are changed. */
+  uint8_t *source_copy_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (source_copy_p == NULL)
+  {
+    return;
+  }
+
+  memcpy (source_copy_p, source_p, size);
+
+  parser_code_cache_entry_t *cache_p = JERRY_CONTEXT (parser_code_cache);
+
+  if (cache_p[PARSER_CODE_CACHE_SIZE - 1].bytecode_p != NULL)
+  {
+    parser_code_cache_free_entry (cache_p + PARSER_CODE_CACHE_SIZE - 1);
+  }
+
+  for (uint32_t i = PARSER_CODE_CACHE_SIZE - 1; i > 0; i--)
+  {
+    cache_p[i] = cache_p[i - 1];
+  }
+
+  ecma_bytecode_ref (bytecode_p);
+
+  cache_p[0].bytecode_p = bytecode_p;
+  cache_p[0].source_p = source_copy_p;
+  cache_p[0].source_size = (uint32_t) size;
+  cache_p[0].hash = hash;
+  cache_p[0].is_strict = is_strict;
+} /* parser_code_cache_insert */
+
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
+
+/**
+ * Remove all entries of the code cache
+ */
+void
+parser_code_cache_flush (void)
+{
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+  parser_code_cache_entry_t *cache_p = JERRY_CONTEXT (parser_code_cache);
+
+  for (uint32_t i = 0; i < PARSER_CODE_CACHE_SIZE && cache_p[i].bytecode_p != NULL; i++)
+  {
+    parser_code_cache_free_entry (cache_p + i);
+  }
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
+} /* parser_code_cache_flush */
+
 /**
  * Parse EcamScript source code
  *
  * Note:
+ *      the byte code of short sources is kept in a cache, so parsing
+ *      the same source again only takes a new reference to it
+ *
+ * Note:
  *      returned value must be freed with ecma_free_value
  *
  * @return true - if success
@@ -2244,6 +2548,25 @@ parser_parse_script (const uint8_t *source_p, /**< source code */
                      bool is_strict, /**< strict mode */
                      ecma_compiled_code_t **bytecode_data_p) /**< [out] JS bytecode */
 {
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+  /* Byte code dumps are printed by the parser, so the cache is bypassed. */
+  bool is_cacheable = (size <= PARSER_CODE_CACHE_MAX_SOURCE_SIZE
+                       && !(JERRY_CONTEXT (jerry_init_flags) & JERRY_INIT_SHOW_OPCODES));
+  lit_string_hash_t hash = 0;
+
+  if (is_cacheable)
+  {
+    hash = lit_utf8_string_calc_hash (source_p, (lit_utf8_size_t) size);
+    *bytecode_data_p = parser_code_cache_lookup (source_p, size, is_strict, hash);
+
+    if (*bytecode_data_p != NULL)
+    {
+      ecma_bytecode_ref (*bytecode_data_p);
+      return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+    }
+  }
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
+
   parser_error_location_t parser_error;
   *bytecode_data_p = parser_parse_source (source_p, size, is_strict, &parser_error);
 
@@ -2307,6 +2630,13 @@ parser_parse_script (const uint8_t *source_p, /**< source code */
 #endif /* JERRY_ENABLE_ERROR_MESSAGES */
   }
 
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+  if (is_cacheable)
+  {
+    parser_code_cache_insert (source_p, size, is_strict, hash, *bytecode_data_p);
+  }
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
+
   return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
 } /* parser_parse_script */
 
@@ -128,8 +128,35 @@ typedef struct
   parser_line_counter_t column;                       /**< column where the error occured */
 } parser_error_location_t;
 
+#ifndef CONFIG_PARSER_CODE_CACHE_DISABLE
+
+/**
+ * Number of entries in the code cache
+ */
+#define PARSER_CODE_CACHE_SIZE 16
+
+/**
+ * Maximum size of sources, whose byte code is stored in the code cache
+ */
+#define PARSER_CODE_CACHE_MAX_SOURCE_SIZE 4096
+
+/**
+ * Entry of the code cache
+ */
+typedef struct
+{
+  ecma_compiled_code_t *bytecode_p; /**< byte code (the cache holds a reference to it) */
+  uint8_t *source_p; /**< copy of the source code */
+  uint32_t source_size; /**< size of the source code */
+  uint16_t hash; /**< hash of the source code */
+  uint16_t is_strict; /**< strict mode flag of the parsing */
+} parser_code_cache_entry_t;
+
+#endif /* !CONFIG_PARSER_CODE_CACHE_DISABLE */
+
 /* Note: source must be a valid UTF-8 string */
 extern ecma_value_t parser_parse_script (const uint8_t *, size_t, bool, ecma_compiled_code_t **);
+extern void parser_code_cache_flush (void);
 
 const char *parser_error_to_string (parser_error_t);
 
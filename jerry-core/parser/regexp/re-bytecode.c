@@ -242,7 +242,9 @@ re_dump_bytecode (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
   re_compiled_code_t *compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
   JERRY_DEBUG_MSG ("%d ", compiled_code_p->header.status_flags);
   JERRY_DEBUG_MSG ("%d ", compiled_code_p->num_of_captures);
-  JERRY_DEBUG_MSG ("%d | ", compiled_code_p->num_of_non_captures);
+  JERRY_DEBUG_MSG ("%d ", compiled_code_p->num_of_non_captures);
+  JERRY_DEBUG_MSG ("%d ", compiled_code_p->analysis_flags);
+  JERRY_DEBUG_MSG ("%d | ", compiled_code_p->prefix_size);
 
   uint8_t *bytecode_p = (uint8_t *) (compiled_code_p + 1);
 
@@ -414,6 +416,12 @@ re_dump_bytecode (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
       case RE_OP_CHAR_CLASS:
       {
         JERRY_DEBUG_MSG ("CHAR_CLASS ");
+        for (uint32_t i = 0; i < RE_CHAR_CLASS_BITMAP_SIZE; i++)
+        {
+          JERRY_DEBUG_MSG ("%02x", bytecode_p[i]);
+        }
+        JERRY_DEBUG_MSG (" ");
+        bytecode_p += RE_CHAR_CLASS_BITMAP_SIZE;
         uint32_t num_of_class = re_get_value (&bytecode_p);
         JERRY_DEBUG_MSG ("%d", num_of_class);
         while (num_of_class)
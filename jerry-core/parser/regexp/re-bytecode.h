@@ -32,15 +32,53 @@
  */
 
 /**
-  * Size of the RegExp bytecode cache
-  */
-#define RE_CACHE_SIZE 8u
+ * Size of the RegExp bytecode cache
+ */
+#define RE_CACHE_SIZE ((uint32_t) CONFIG_REGEXP_CACHE_SIZE)
+
+/**
+ * Number of entries in a row of the RegExp bytecode cache
+ */
+#define RE_CACHE_ROW_LENGTH 8u
+
+/**
+ * Number of rows in the RegExp bytecode cache
+ */
+#define RE_CACHE_ROWS_COUNT (RE_CACHE_SIZE / RE_CACHE_ROW_LENGTH)
 
 /**
   * RegExp flags mask (first 10 bits are for reference count and the rest for the actual RegExp flags)
   */
 #define RE_FLAGS_MASK 0x3F
 
+/**
+ * Size of the first character bitmap of the RegExp bytecode (one bit for each ASCII character)
+ */
+#define RE_FIRST_CHAR_BITMAP_SIZE (128 / JERRY_BITSINBYTE)
+
+/**
+ * Size of the ASCII bitmap of the character class opcodes (one bit for each ASCII character)
+ *
+ * The bitmap is followed by the number and the list of the (case folded) ranges which
+ * contain non-ASCII characters.
+ */
+#define RE_CHAR_CLASS_BITMAP_SIZE (128 / JERRY_BITSINBYTE)
+
+/**
+ * Maximum size of the literal prefix of the RegExp bytecode in bytes
+ */
+#define RE_LITERAL_PREFIX_MAX_SIZE 14
+
+/**
+ * Results of the RegExp bytecode analysis
+ */
+typedef enum
+{
+  RE_ANALYSIS_ANCHORED_START = (1u << 0),     /**< a match can only start at the beginning of the input */
+  RE_ANALYSIS_FIRST_CHARS = (1u << 1),        /**< first_char_bitmap contains the possible first characters */
+  RE_ANALYSIS_NON_ASCII_FIRST_CHAR = (1u << 2) /**< a match can start with a non-ASCII character */
+} re_analysis_flags_t;
+
 /**
  * RegExp opcodes
  */
@@ -89,8 +127,25 @@ typedef struct
   jmem_cpointer_t pattern_cp;        /**< original RegExp pattern */
   uint32_t num_of_captures;          /**< number of capturing brackets */
   uint32_t num_of_non_captures;      /**< number of non capturing brackets */
+  uint8_t analysis_flags;            /**< analysis results (see re_analysis_flags_t) */
+  uint8_t prefix_size;               /**< size of the literal prefix */
+  uint8_t prefix[RE_LITERAL_PREFIX_MAX_SIZE]; /**< literal prefix (CESU-8) which starts every match */
+  uint8_t first_char_bitmap[RE_FIRST_CHAR_BITMAP_SIZE]; /**< ASCII characters which can start a match */
 } re_compiled_code_t;
 
+#ifdef JMEM_STATS
+/**
+ * RegExp bytecode cache statistics
+ */
+typedef struct
+{
+  size_t hit_count; /**< number of patterns found in the cache */
+  size_t miss_count; /**< number of compiled patterns */
+  size_t eviction_count; /**< number of entries removed from a full row */
+  double compile_time; /**< time spent with compiling patterns (in milliseconds) */
+} re_cache_stats_t;
+#endif /* JMEM_STATS */
+
 /**
  * Context of RegExp bytecode container
  */
@@ -19,8 +19,10 @@
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "jerry-port.h"
 #include "jrt-libc-includes.h"
 #include "jmem-heap.h"
+#include "lit-char-helpers.h"
 #include "re-bytecode.h"
 #include "re-compiler.h"
 #include "re-parser.h"
@@ -39,6 +41,10 @@
 
 /**
  * Callback function of character class generation
+ *
+ * The ranges are case folded at compile time. The ASCII members are stored in the bitmap
+ * of the class, and only the ranges containing non-ASCII characters are appended to the
+ * bytecode, since the canonical form of a non-ASCII character is never ASCII.
  */
 static void
 re_append_char_class (void *re_ctx_p, /**< RegExp compiler context */
@@ -46,9 +52,30 @@ re_append_char_class (void *re_ctx_p, /**< RegExp compiler context */
                       ecma_char_t end) /**< character class range to */
 {
   re_compiler_ctx_t *ctx_p = (re_compiler_ctx_t *) re_ctx_p;
-  re_append_char (ctx_p->bytecode_ctx_p, start);
-  re_append_char (ctx_p->bytecode_ctx_p, end);
-  ctx_p->parser_ctx_p->num_of_classes++;
+  bool is_ignorecase = (ctx_p->flags & RE_FLAG_IGNORE_CASE) != 0;
+
+  start = re_canonicalize (start, is_ignorecase);
+  end = re_canonicalize (end, is_ignorecase);
+
+  if (start <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    for (ecma_char_t ch = 0; ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; ch++)
+    {
+      ecma_char_t canonical_ch = re_canonicalize (ch, is_ignorecase);
+
+      if (canonical_ch >= start && canonical_ch <= end)
+      {
+        ctx_p->char_class_bitmap[ch / JERRY_BITSINBYTE] |= (uint8_t) (1u << (ch % JERRY_BITSINBYTE));
+      }
+    }
+  }
+
+  if (end > LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    re_append_char (ctx_p->bytecode_ctx_p, start);
+    re_append_char (ctx_p->bytecode_ctx_p, end);
+    ctx_p->parser_ctx_p->num_of_classes++;
+  }
 } /* re_append_char_class */
 
 /**
@@ -387,6 +414,7 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
                                                        ? RE_OP_INV_CHAR_CLASS
                                                        : RE_OP_CHAR_CLASS);
         uint32_t offset = re_get_bytecode_length (re_ctx_p->bytecode_ctx_p);
+        memset (re_ctx_p->char_class_bitmap, 0, RE_CHAR_CLASS_BITMAP_SIZE);
 
         ECMA_TRY_CATCH (empty,
                         re_parse_char_class (re_ctx_p->parser_ctx_p,
@@ -395,6 +423,7 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
                                              &(re_ctx_p->current_token)),
                         ret_value);
         re_insert_u32 (bc_ctx_p, offset, re_ctx_p->parser_ctx_p->num_of_classes);
+        re_bytecode_list_insert (bc_ctx_p, offset, re_ctx_p->char_class_bitmap, RE_CHAR_CLASS_BITMAP_SIZE);
 
         if ((re_ctx_p->current_token.qmin != 1) || (re_ctx_p->current_token.qmax != 1))
         {
@@ -447,43 +476,370 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
 } /* re_parse_alternative */
 
 /**
- * Search for the given pattern in the RegExp cache
+ * Add a character to the first character set of the RegExp bytecode
+ */
+static void
+re_analysis_add_char (re_compiled_code_t *re_compiled_code_p, /**< RegExp bytecode header */
+                      ecma_char_t ch) /**< character */
+{
+  if (ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    re_compiled_code_p->first_char_bitmap[ch / JERRY_BITSINBYTE] |= (uint8_t) (1u << (ch % JERRY_BITSINBYTE));
+  }
+  else
+  {
+    re_compiled_code_p->analysis_flags |= RE_ANALYSIS_NON_ASCII_FIRST_CHAR;
+  }
+} /* re_analysis_add_char */
+
+/**
+ * Add the members of a character class to the first character set of the RegExp bytecode
+ */
+static void
+re_analysis_add_char_class (re_compiled_code_t *re_compiled_code_p, /**< RegExp bytecode header */
+                            uint8_t **bc_p, /**< [in, out] pointer to the bitmap of the class */
+                            bool is_inverted) /**< true - if the class is inverted */
+{
+  const uint8_t *bitmap_p = *bc_p;
+  *bc_p += RE_CHAR_CLASS_BITMAP_SIZE;
+
+  uint32_t num_of_ranges = re_get_value (bc_p);
+  *bc_p += num_of_ranges * 2 * sizeof (ecma_char_t);
+
+  for (uint32_t i = 0; i < RE_CHAR_CLASS_BITMAP_SIZE; i++)
+  {
+    re_compiled_code_p->first_char_bitmap[i] |= (uint8_t) (is_inverted ? ~bitmap_p[i] : bitmap_p[i]);
+  }
+
+  if (is_inverted || num_of_ranges > 0)
+  {
+    re_compiled_code_p->analysis_flags |= RE_ANALYSIS_NON_ASCII_FIRST_CHAR;
+  }
+} /* re_analysis_add_char_class */
+
+/**
+ * Collect the characters which can start a match of a bytecode sequence.
+ *
+ * The sequence ends at the first alternative, group end or match opcode.
  *
- * @return index of bytecode in cache - if found
- *         RE_CACHE_SIZE              - otherwise
+ * @return true  - if the sequence can match without consuming any character, or
+ *                 its first characters cannot be determined
+ *         false - otherwise
  */
-static uint8_t
-re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
-                           uint16_t flags) /**< flags */
+static bool
+re_analysis_first_chars (re_compiled_code_t *re_compiled_code_p, /**< RegExp bytecode header */
+                         uint8_t *bc_p) /**< start of the sequence */
 {
-  uint8_t free_idx = RE_CACHE_SIZE;
+  bool is_ignorecase = (re_compiled_code_p->header.status_flags & RE_FLAG_IGNORE_CASE) != 0;
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  while (true)
   {
-    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
+    re_opcode_t op = re_get_opcode (&bc_p);
 
-    if (cached_bytecode_p != NULL)
+    switch (op)
     {
-      ecma_string_t *cached_pattern_str_p;
-      cached_pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, cached_bytecode_p->pattern_cp);
+      case RE_OP_CHAR:
+      {
+        ecma_char_t ch = re_get_char (&bc_p);
+        re_analysis_add_char (re_compiled_code_p, ch);
 
-      if ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
-          && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+        if (is_ignorecase && ch >= LIT_CHAR_UPPERCASE_A && ch <= LIT_CHAR_UPPERCASE_Z)
+        {
+          re_analysis_add_char (re_compiled_code_p, (ecma_char_t) (ch + (LIT_CHAR_LOWERCASE_A - LIT_CHAR_UPPERCASE_A)));
+        }
+        return false;
+      }
+      case RE_OP_PERIOD:
+      {
+        for (ecma_char_t ch = 0; ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; ch++)
+        {
+          if (ch != LIT_CHAR_LF && ch != LIT_CHAR_CR)
+          {
+            re_analysis_add_char (re_compiled_code_p, ch);
+          }
+        }
+
+        re_compiled_code_p->analysis_flags |= RE_ANALYSIS_NON_ASCII_FIRST_CHAR;
+        return false;
+      }
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_INV_CHAR_CLASS:
       {
-        JERRY_TRACE_MSG ("RegExp is found in cache\n");
-        return idx;
+        re_analysis_add_char_class (re_compiled_code_p, &bc_p, op == RE_OP_INV_CHAR_CLASS);
+        return false;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_NON_GREEDY_ITERATOR:
+      {
+        uint32_t min = re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        uint32_t offset = re_get_value (&bc_p);
+
+        /* The atom of a simple iterator always consumes a character. */
+        re_analysis_first_chars (re_compiled_code_p, bc_p);
+
+        if (min > 0)
+        {
+          return false;
+        }
+
+        bc_p += offset;
+        break;
+      }
+      case RE_OP_ASSERT_START:
+      case RE_OP_ASSERT_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        break;
+      }
+      case RE_OP_LOOKAHEAD_POS:
+      case RE_OP_LOOKAHEAD_NEG:
+      {
+        /* Lookaheads are zero-width: skip the alternatives and the closing match opcode. */
+        do
+        {
+          uint32_t offset = re_get_value (&bc_p);
+          bc_p += offset;
+        }
+        while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
+        break;
+      }
+      case RE_OP_CAPTURE_GROUP_START:
+      case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_GROUP_START:
+      case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      {
+        bool is_nullable = (op != RE_OP_CAPTURE_GROUP_START && op != RE_OP_NON_CAPTURE_GROUP_START);
+
+        re_get_value (&bc_p);
+
+        if (is_nullable)
+        {
+          re_get_value (&bc_p);
+        }
+
+        do
+        {
+          uint32_t offset = re_get_value (&bc_p);
+
+          if (re_analysis_first_chars (re_compiled_code_p, bc_p))
+          {
+            is_nullable = true;
+          }
+
+          bc_p += offset;
+        }
+        while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
+
+        /* Skip the operands of the group end opcode: index, min, max and start offset. */
+        bc_p += 4 * sizeof (uint32_t);
+
+        if (!is_nullable)
+        {
+          return false;
+        }
+        break;
+      }
+      case RE_OP_BACKREFERENCE:
+      {
+        /* The first characters of a backreference are not known. */
+        re_compiled_code_p->analysis_flags &= (uint8_t) ~RE_ANALYSIS_FIRST_CHARS;
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (op == RE_OP_ALTERNATIVE
+                      || op == RE_OP_MATCH
+                      || op == RE_OP_SAVE_AND_MATCH
+                      || op == RE_OP_CAPTURE_GREEDY_GROUP_END
+                      || op == RE_OP_CAPTURE_NON_GREEDY_GROUP_END
+                      || op == RE_OP_NON_CAPTURE_GREEDY_GROUP_END
+                      || op == RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END);
+        return true;
       }
     }
-    else
+  }
+} /* re_analysis_first_chars */
+
+/**
+ * Analyse the RegExp bytecode to find the positions of the input where a match can start.
+ *
+ * The results are stored in the bytecode header:
+ *  - whether every match must start at the beginning of the input
+ *  - the literal prefix of every match (only for case sensitive patterns without alternatives)
+ *  - the set of the possible first characters of a match
+ */
+static void
+re_analyse_bytecode (re_compiled_code_t *re_compiled_code_p, /**< [out] RegExp bytecode header */
+                     uint8_t *bc_start_p) /**< start of the bytecode */
+{
+  uint16_t flags = re_compiled_code_p->header.status_flags;
+  uint8_t *bc_p = bc_start_p;
+
+  re_compiled_code_p->analysis_flags = RE_ANALYSIS_FIRST_CHARS;
+  re_compiled_code_p->prefix_size = 0;
+  memset (re_compiled_code_p->first_char_bitmap, 0, RE_FIRST_CHAR_BITMAP_SIZE);
+
+  re_opcode_t op = re_get_opcode (&bc_p);
+  JERRY_ASSERT (op == RE_OP_SAVE_AT_START);
+
+  bool is_anchored = !(flags & RE_FLAG_MULTILINE);
+  bool is_nullable = false;
+  uint32_t num_of_alternatives = 0;
+
+  do
+  {
+    uint32_t offset = re_get_value (&bc_p);
+
+    if (*bc_p != RE_OP_ASSERT_START)
+    {
+      is_anchored = false;
+    }
+
+    if (re_analysis_first_chars (re_compiled_code_p, bc_p))
+    {
+      is_nullable = true;
+    }
+
+    bc_p += offset;
+    num_of_alternatives++;
+  }
+  while (re_get_opcode (&bc_p) == RE_OP_ALTERNATIVE);
+
+  if (is_nullable)
+  {
+    re_compiled_code_p->analysis_flags = 0;
+  }
+
+  if (is_anchored)
+  {
+    re_compiled_code_p->analysis_flags |= RE_ANALYSIS_ANCHORED_START;
+    return;
+  }
+
+  if (num_of_alternatives > 1 || (flags & RE_FLAG_IGNORE_CASE))
+  {
+    return;
+  }
+
+  /* Collect the leading characters of the only alternative. */
+  bc_p = bc_start_p;
+  re_get_opcode (&bc_p);
+  re_get_value (&bc_p);
+
+  while (re_get_opcode (&bc_p) == RE_OP_CHAR)
+  {
+    lit_utf8_byte_t buffer[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+    lit_utf8_size_t size = lit_code_unit_to_utf8 (re_get_char (&bc_p), buffer);
+
+    if (re_compiled_code_p->prefix_size + size > RE_LITERAL_PREFIX_MAX_SIZE)
+    {
+      break;
+    }
+
+    memcpy (re_compiled_code_p->prefix + re_compiled_code_p->prefix_size, buffer, size);
+    re_compiled_code_p->prefix_size = (uint8_t) (re_compiled_code_p->prefix_size + size);
+  }
+} /* re_analyse_bytecode */
+
+JERRY_STATIC_ASSERT (RE_CACHE_ROWS_COUNT > 0 && (RE_CACHE_ROWS_COUNT & (RE_CACHE_ROWS_COUNT - 1)) == 0
+                     && RE_CACHE_ROWS_COUNT * RE_CACHE_ROW_LENGTH == RE_CACHE_SIZE,
+                     regexp_cache_size_must_be_a_power_of_two_multiple_of_the_row_length);
+
+/**
+ * Get the row of the RegExp cache which may contain the bytecode of the given pattern
+ *
+ * @return pointer to the first entry of the row
+ */
+static const re_compiled_code_t **
+re_cache_get_row (ecma_string_t *pattern_str_p, /**< pattern string */
+                  uint16_t flags) /**< flags */
+{
+  /* The low bits of the string hash depend mostly on the low bits of the characters,
+   * so the hash is scrambled by a multiplicative step and its upper bits are used. */
+  uint32_t hash = (uint32_t) (ecma_string_hash (pattern_str_p) ^ flags) * 0x9e3779b1u;
+  size_t row_index = (size_t) ((hash >> 16) & (RE_CACHE_ROWS_COUNT - 1));
+
+  return JERRY_CONTEXT (re_cache) + row_index * RE_CACHE_ROW_LENGTH;
+} /* re_cache_get_row */
+
+/**
+ * Search for the given pattern in the RegExp cache
+ *
+ * The entries of a row are ordered from the most recently used to the least
+ * recently used one, so a found entry is moved to the front of its row.
+ *
+ * @return pointer to the bytecode - if found
+ *         NULL                    - otherwise
+ */
+static const re_compiled_code_t *
+re_cache_lookup (ecma_string_t *pattern_str_p, /**< pattern string */
+                 uint16_t flags) /**< flags */
+{
+  const re_compiled_code_t **row_p = re_cache_get_row (pattern_str_p, flags);
+
+  for (uint32_t i = 0; i < RE_CACHE_ROW_LENGTH && row_p[i] != NULL; i++)
+  {
+    const re_compiled_code_t *cached_bytecode_p = row_p[i];
+    ecma_string_t *cached_pattern_str_p;
+    cached_pattern_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, cached_bytecode_p->pattern_cp);
+
+    if ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
+        && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
     {
-      /* mark as free, so it can be overridden if the cache is full */
-      free_idx = idx;
+      JERRY_TRACE_MSG ("RegExp is found in cache\n");
+
+      for (; i > 0; i--)
+      {
+        row_p[i] = row_p[i - 1];
+      }
+
+      row_p[0] = cached_bytecode_p;
+      return cached_bytecode_p;
     }
   }
 
   JERRY_TRACE_MSG ("RegExp is NOT found in cache\n");
-  return free_idx;
-} /* re_find_bytecode_in_cache */
+  return NULL;
+} /* re_cache_lookup */
+
+/**
+ * Insert a bytecode into the RegExp cache
+ *
+ * The bytecode becomes the most recently used entry of its row. If the row
+ * is full, the least recently used entry is removed.
+ */
+static void
+re_cache_insert (ecma_string_t *pattern_str_p, /**< pattern string */
+                 uint16_t flags, /**< flags */
+                 const re_compiled_code_t *bytecode_p) /**< bytecode */
+{
+  const re_compiled_code_t **row_p = re_cache_get_row (pattern_str_p, flags);
+  uint32_t last_index = RE_CACHE_ROW_LENGTH - 1;
+
+  /* The garbage collector might run during the byte code
+   * allocations, so the row is checked after the compilation. */
+  if (row_p[last_index] != NULL)
+  {
+    JERRY_TRACE_MSG ("RegExp cache row is full! Remove the least recently used element.\n");
+    ecma_bytecode_deref ((ecma_compiled_code_t *) row_p[last_index]);
+
+#ifdef JMEM_STATS
+    JERRY_CONTEXT (re_cache_stats).eviction_count++;
+#endif /* JMEM_STATS */
+  }
+
+  for (uint32_t i = last_index; i > 0; i--)
+  {
+    row_p[i] = row_p[i - 1];
+  }
+
+  ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+  row_p[0] = bytecode_p;
+} /* re_cache_insert */
 
 /**
  * Run gerbage collection in RegExp cache
@@ -491,20 +847,56 @@ re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
 void
 re_cache_gc_run ()
 {
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  for (uint32_t row = 0; row < RE_CACHE_ROWS_COUNT; row++)
   {
-    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[i];
+    const re_compiled_code_t **row_p = JERRY_CONTEXT (re_cache) + row * RE_CACHE_ROW_LENGTH;
+    uint32_t length = 0;
 
-    if (cached_bytecode_p != NULL
-        && cached_bytecode_p->header.refs == 1)
+    for (uint32_t i = 0; i < RE_CACHE_ROW_LENGTH && row_p[i] != NULL; i++)
     {
-      /* Only the cache has reference for the bytecode */
-      ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-      JERRY_CONTEXT (re_cache)[i] = NULL;
+      if (row_p[i]->header.refs == 1)
+      {
+        /* Only the cache has reference for the bytecode */
+        ecma_bytecode_deref ((ecma_compiled_code_t *) row_p[i]);
+      }
+      else
+      {
+        /* Keep the order of the remaining entries. */
+        row_p[length++] = row_p[i];
+      }
+    }
+
+    while (length < RE_CACHE_ROW_LENGTH)
+    {
+      row_p[length++] = NULL;
     }
   }
 } /* re_cache_gc_run */
 
+#ifdef JMEM_STATS
+/**
+ * Print the statistics of the RegExp cache
+ */
+void
+re_cache_stats_print (void)
+{
+  re_cache_stats_t *cache_stats_p = &JERRY_CONTEXT (re_cache_stats);
+
+  JERRY_DEBUG_MSG ("RegExp cache stats:\n"
+                   "  Cache size = %u entries\n"
+                   "  Hits = %zu\n"
+                   "  Misses = %zu\n"
+                   "  Evictions = %zu\n"
+                   "  Compile time = %zu us\n"
+                   "\n",
+                   (unsigned int) RE_CACHE_SIZE,
+                   cache_stats_p->hit_count,
+                   cache_stats_p->miss_count,
+                   cache_stats_p->eviction_count,
+                   (size_t) (cache_stats_p->compile_time * 1000.0));
+} /* re_cache_stats_print */
+#endif /* JMEM_STATS */
+
 /**
  * Compilation of RegExp bytecode
  *
@@ -519,19 +911,24 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
                      uint16_t flags) /**< flags */
 {
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  uint8_t cache_idx = re_find_bytecode_in_cache (pattern_str_p, flags);
+  const re_compiled_code_t *cached_bytecode_p = re_cache_lookup (pattern_str_p, flags);
 
-  if (cache_idx < RE_CACHE_SIZE)
+  if (cached_bytecode_p != NULL)
   {
-    *out_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
+#ifdef JMEM_STATS
+    JERRY_CONTEXT (re_cache_stats).hit_count++;
+#endif /* JMEM_STATS */
 
-    if (*out_bytecode_p != NULL)
-    {
-      ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-      return ret_value;
-    }
+    ecma_bytecode_ref ((ecma_compiled_code_t *) cached_bytecode_p);
+    *out_bytecode_p = cached_bytecode_p;
+    return ret_value;
   }
 
+#ifdef JMEM_STATS
+  JERRY_CONTEXT (re_cache_stats).miss_count++;
+  double compile_start_time = jerry_port_get_current_time ();
+#endif /* JMEM_STATS */
+
   /* not in the RegExp cache, so compile it */
   re_compiler_ctx_t re_ctx;
   re_ctx.flags = flags;
@@ -579,6 +976,7 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     ECMA_SET_NON_NULL_POINTER (re_compiled_code.pattern_cp, pattern_str_p);
     re_compiled_code.num_of_captures = re_ctx.num_of_captures * 2;
     re_compiled_code.num_of_non_captures = re_ctx.num_of_non_captures;
+    re_analyse_bytecode (&re_compiled_code, bc_ctx.block_start_p);
 
     re_bytecode_list_insert (&bc_ctx,
                              0,
@@ -614,30 +1012,13 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
 
     ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> JMEM_ALIGNMENT_LOG);
 
-    if (cache_idx == RE_CACHE_SIZE)
-    {
-      if (JERRY_CONTEXT (re_cache_idx) == RE_CACHE_SIZE)
-      {
-        JERRY_CONTEXT (re_cache_idx) = 0;
-      }
-
-      JERRY_TRACE_MSG ("RegExp cache is full! Remove the element on idx: %d\n", JERRY_CONTEXT (re_cache_idx));
-
-      cache_idx = JERRY_CONTEXT (re_cache_idx)++;
-
-      /* The garbage collector might run during the byte code
-       * allocations above and it may free this entry. */
-      if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-      {
-        ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-      }
-    }
-
-    JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", cache_idx);
-    ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-    JERRY_CONTEXT (re_cache)[cache_idx] = *out_bytecode_p;
+    re_cache_insert (pattern_str_p, flags, *out_bytecode_p);
   }
 
+#ifdef JMEM_STATS
+  JERRY_CONTEXT (re_cache_stats).compile_time += jerry_port_get_current_time () - compile_start_time;
+#endif /* JMEM_STATS */
+
   return ret_value;
 } /* re_compile_bytecode */
 
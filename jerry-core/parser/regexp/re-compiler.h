@@ -45,6 +45,7 @@ typedef struct
   re_bytecode_ctx_t *bytecode_ctx_p; /**< pointer of RegExp bytecode context */
   re_token_t current_token;          /**< current token */
   re_parser_ctx_t *parser_ctx_p;     /**< pointer of RegExp parser context */
+  uint8_t char_class_bitmap[RE_CHAR_CLASS_BITMAP_SIZE]; /**< ASCII members of the current character class */
 } re_compiler_ctx_t;
 
 ecma_value_t
@@ -52,6 +53,10 @@ re_compile_bytecode (const re_compiled_code_t **, ecma_string_t *, uint16_t);
 
 void re_cache_gc_run ();
 
+#ifdef JMEM_STATS
+void re_cache_stats_print (void);
+#endif /* JMEM_STATS */
+
 /**
  * @}
  * @}
@@ -65,7 +65,8 @@ do_number_bitwise_logic (number_bitwise_logic_op op, /**< number bitwise logic o
       }
       case NUMBER_BITWISE_LOGIC_XOR:
       {
-        return (left_value ^ right_value) & (ecma_value_t) (~((1 << ECMA_DIRECT_SHIFT) - 1));
+        return ecma_make_integer_value (ecma_get_integer_from_value (left_value)
+                                        ^ ecma_get_integer_from_value (right_value));
       }
       case NUMBER_BITWISE_SHIFT_LEFT:
       {
@@ -87,7 +88,7 @@ do_number_bitwise_logic (number_bitwise_logic_op op, /**< number bitwise logic o
       }
       case NUMBER_BITWISE_NOT:
       {
-        return (~right_value) & (ecma_value_t) (~((1 << ECMA_DIRECT_SHIFT) - 1));
+        return ecma_make_integer_value (~ecma_get_integer_from_value (right_value));
       }
     }
   }
@@ -18,6 +18,7 @@
 #include "ecma-builtins.h"
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -285,15 +286,16 @@ vm_op_delete_var (jmem_cpointer_t name_literal, /**< name literal */
  * See also:
  *          ECMA-262 v5, 12.6.4
  *
- * @return completion value
- *         Returned value must be freed with ecma_free_value
+ * @return iterator of the property names - if there are properties to enumerate,
+ *         NULL - otherwise
+ *         Returned iterator must be freed with ecma_op_for_in_free_iterator
  */
-ecma_collection_header_t *
+ecma_for_in_iterator_t *
 opfunc_for_in (ecma_value_t left_value, /**< left value */
                ecma_value_t *result_obj_p) /**< expression object */
 {
   ecma_value_t compl_val = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
-  ecma_collection_header_t *prop_names_p = NULL;
+  ecma_for_in_iterator_t *iterator_p = NULL;
 
   /* 3. */
   if (!ecma_is_value_undefined (left_value)
@@ -305,25 +307,20 @@ opfunc_for_in (ecma_value_t left_value, /**< left value */
                     compl_val);
 
     ecma_object_t *obj_p = ecma_get_object_from_value (obj_expr_value);
-    prop_names_p = ecma_op_object_get_property_names (obj_p, false, true, true);
+    iterator_p = ecma_op_for_in_create_iterator (obj_p);
 
-    if (prop_names_p->unit_number != 0)
+    if (iterator_p != NULL)
     {
       ecma_ref_object (obj_p);
       *result_obj_p = ecma_make_object_value (obj_p);
     }
-    else
-    {
-      ecma_dealloc_collection_header (prop_names_p);
-      prop_names_p = NULL;
-    }
 
     ECMA_FINALIZE (obj_expr_value);
   }
 
   JERRY_ASSERT (ecma_is_value_empty (compl_val));
 
-  return prop_names_p;
+  return iterator_p;
 } /* opfunc_for_in */
 
 /**
@@ -46,6 +46,10 @@ typedef struct
   uint8_t *byte_code_p;                               /**< current byte code pointer */
   uint8_t *byte_code_start_p;                         /**< byte code start pointer */
   ecma_value_t *registers_p;                          /**< register start pointer */
+  const ecma_value_t *arg_list_p;                     /**< arguments list passed to the function */
+  ecma_length_t arg_list_len;                         /**< length of arguments list */
+  ecma_object_t *func_obj_p;                          /**< currently executed function object
+                                                       *   (NULL for global and eval code) */
   ecma_value_t *stack_top_p;                          /**< stack top pointer */
   jmem_cpointer_t *literal_start_p;                   /**< literal list start pointer */
   ecma_object_t *lex_env_p;                           /**< current lexical environment */
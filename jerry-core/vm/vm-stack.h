@@ -51,7 +51,7 @@ typedef struct vm_stack_frame_t
 
 #define VM_CREATE_CONTEXT(type, end_offset) ((ecma_value_t) ((type) | (end_offset) << 4))
 #define VM_GET_CONTEXT_TYPE(value) ((vm_stack_context_type_t) ((value) & 0xf))
-#define VM_GET_CONTEXT_END(value) ((value) >> 4)
+#define VM_GET_CONTEXT_END(value) ((uint32_t) ((value) >> 4))
 
 /**
  * Context types for the vm stack.
@@ -22,12 +22,14 @@
 #include "ecma-comparison.h"
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
@@ -177,6 +179,100 @@ vm_op_set_value (ecma_value_t object, /**< base object */
   return completion_value;
 } /* vm_op_set_value */
 
+/**
+ * Get the value of arguments[property] when the arguments
+ * object of the function is not created (lazy arguments mode).
+ *
+ * Array index properties are read directly from the registers (mapped
+ * arguments) or from the arguments list. Other properties are looked up
+ * in a temporary arguments object.
+ *
+ * @return ecma value
+ */
+static ecma_value_t
+vm_get_lazy_arguments_element (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                               ecma_value_t property) /**< property name */
+{
+  const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
+  bool is_strict = (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
+  uint32_t index = ECMA_STRING_NOT_ARRAY_INDEX;
+  uint16_t argument_end;
+
+  JERRY_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_LAZY_ARGUMENTS);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    argument_end = ((cbc_uint16_arguments_t *) bytecode_header_p)->argument_end;
+  }
+  else
+  {
+    argument_end = ((cbc_uint8_arguments_t *) bytecode_header_p)->argument_end;
+  }
+
+  if (ecma_is_value_integer_number (property))
+  {
+    ecma_integer_value_t int_value = ecma_get_integer_from_value (property);
+
+    if (int_value >= 0)
+    {
+      index = (uint32_t) int_value;
+    }
+  }
+  else if (ecma_is_value_number (property))
+  {
+    ecma_number_t num = ecma_get_number_from_value (property);
+    uint32_t uint32_num = ecma_number_to_uint32 (num);
+
+    if ((ecma_number_t) uint32_num == num)
+    {
+      index = uint32_num;
+    }
+  }
+  else if (ecma_is_value_string (property))
+  {
+    index = ecma_string_get_array_index (ecma_get_string_from_value (property));
+  }
+
+  if (index < frame_ctx_p->arg_list_len)
+  {
+    /* The formal parameters of non-strict functions are
+     * mapped to the corresponding arguments. */
+    if (!is_strict && index < argument_end)
+    {
+      return ecma_fast_copy_value (frame_ctx_p->registers_p[index]);
+    }
+
+    return ecma_copy_value (frame_ctx_p->arg_list_p[index]);
+  }
+
+  ecma_length_t arg_list_len = frame_ctx_p->arg_list_len;
+  ecma_value_t result;
+
+  JMEM_DEFINE_LOCAL_ARRAY (arg_list_p, arg_list_len, ecma_value_t);
+
+  for (ecma_length_t i = 0; i < arg_list_len; i++)
+  {
+    if (!is_strict && i < argument_end)
+    {
+      arg_list_p[i] = frame_ctx_p->registers_p[i];
+    }
+    else
+    {
+      arg_list_p[i] = frame_ctx_p->arg_list_p[i];
+    }
+  }
+
+  ecma_object_t *arguments_p = ecma_op_create_unmapped_arguments_object (frame_ctx_p->func_obj_p,
+                                                                          arg_list_p,
+                                                                          arg_list_len,
+                                                                          is_strict);
+  result = vm_op_get_value (ecma_make_object_value (arguments_p), property);
+  ecma_deref_object (arguments_p);
+
+  JMEM_FINALIZE_LOCAL_ARRAY (arg_list_p);
+  return result;
+} /* vm_get_lazy_arguments_element */
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
 /**
@@ -208,6 +304,7 @@ vm_run_global (const ecma_compiled_code_t *bytecode_p) /**< pointer to bytecode
                                    ecma_get_global_environment (),
                                    false,
                                    NULL,
+                                   NULL,
                                    0);
 
   ecma_deref_object (glob_obj_p);
@@ -253,6 +350,7 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
                                           lex_env_p,
                                           true,
                                           NULL,
+                                          NULL,
                                           0);
 
   ecma_deref_object (lex_env_p);
@@ -452,6 +550,11 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   frame_ctx_p->stack_top_p = stack_top_p;
 } /* opfunc_construct */
 
+/**
+ * Maximum number of literal properties created together by the VM.
+ */
+#define VM_LITERAL_PROPERTY_BATCH_SIZE 8
+
 #define READ_LITERAL_INDEX(destination) \
   do \
   { \
@@ -599,8 +702,6 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           uint32_t value_index;
           ecma_value_t lit_value;
-          ecma_string_t *name_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                literal_start_p[literal_index]);
 
           READ_LITERAL_INDEX (value_index);
 
@@ -614,6 +715,21 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                                      literal_start_p[value_index]);
           }
 
+          if (literal_index < register_end)
+          {
+            /* Function declarations which are not referenced
+             * by inner functions are stored in registers. */
+            JERRY_ASSERT (type == CBC_INITIALIZE_VAR && value_index >= register_end);
+
+            ecma_fast_free_value (frame_ctx_p->registers_p[literal_index]);
+            frame_ctx_p->registers_p[literal_index] = lit_value;
+            literal_index++;
+            continue;
+          }
+
+          ecma_string_t *name_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                literal_start_p[literal_index]);
+
           if (self_reference == literal_start_p[value_index])
           {
             ecma_op_create_immutable_binding (frame_ctx_p->lex_env_p, name_p, lit_value);
@@ -803,7 +919,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           default:
           {
-            JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) == 2);
+            JERRY_ASSERT (CBC_BRANCH_OFFSET_LENGTH (opcode) >= 2);
 
             branch_offset <<= 8;
             branch_offset |= *(byte_code_p++);
@@ -970,6 +1086,41 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
+        case VM_OC_SET_PROPERTIES:
+        {
+          uint32_t property_count = *byte_code_p++;
+
+          stack_top_p -= property_count;
+
+          ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-1]);
+          ecma_value_t *values_p = stack_top_p;
+
+          while (property_count > 0)
+          {
+            ecma_string_t *names_p[VM_LITERAL_PROPERTY_BATCH_SIZE];
+            uint32_t count = JERRY_MIN (property_count, VM_LITERAL_PROPERTY_BATCH_SIZE);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+              uint16_t literal_index;
+
+              JERRY_ASSERT (byte_code_p[0] == CBC_EXT_OPCODE
+                            && byte_code_p[1] == CBC_EXT_PROPERTY_NAME);
+              byte_code_p += 2;
+
+              READ_LITERAL_INDEX (literal_index);
+              JERRY_ASSERT (literal_index >= register_end && literal_index < const_literal_end);
+
+              names_p[i] = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, literal_start_p[literal_index]);
+            }
+
+            ecma_create_named_data_properties (object_p, names_p, values_p, count);
+
+            values_p += count;
+            property_count -= count;
+          }
+          continue;
+        }
         case VM_OC_SET_GETTER:
         case VM_OC_SET_SETTER:
         {
@@ -1014,33 +1165,38 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = length_prop_value_p->value;
           length_num = ecma_get_uint32_from_value (left_value);
 
-          for (uint32_t i = 0; i < values_length; i++)
-          {
-            if (!ecma_is_value_array_hole (stack_top_p[i]))
-            {
-              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length_num);
+          uint32_t i = 0;
 
-              ecma_property_value_t *prop_value_p;
-              prop_value_p = ecma_create_named_data_property (array_obj_p,
-                                                              index_str_p,
-                                                              ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                              NULL);
-
-              JERRY_ASSERT (ecma_is_value_undefined (prop_value_p->value));
-              prop_value_p->value = stack_top_p[i];
+          while (i < values_length)
+          {
+            ecma_string_t *names_p[VM_LITERAL_PROPERTY_BATCH_SIZE];
+            ecma_value_t *values_p = stack_top_p + i;
+            uint32_t count = 0;
 
-              /* The reference is moved so no need to free stack_top_p[i] except for objects. */
-              if (ecma_is_value_object (stack_top_p[i]))
+            /* The holes are skipped, and the remaining values are moved
+             * to the start of the batch next to each other. */
+            while (i < values_length && count < VM_LITERAL_PROPERTY_BATCH_SIZE)
+            {
+              if (!ecma_is_value_array_hole (stack_top_p[i]))
               {
-                ecma_free_value (stack_top_p[i]);
+                names_p[count] = ecma_new_ecma_string_from_uint32 (length_num + i);
+                values_p[count] = stack_top_p[i];
+                count++;
               }
-
-              ecma_deref_ecma_string (index_str_p);
+              i++;
             }
 
-            length_num++;
+            /* The references of the values are moved to the properties. */
+            ecma_create_named_data_properties (array_obj_p, names_p, values_p, count);
+
+            for (uint32_t j = 0; j < count; j++)
+            {
+              ecma_deref_ecma_string (names_p[j]);
+            }
           }
 
+          length_num += values_length;
+
           ecma_value_assign_uint32 (&length_prop_value_p->value, length_num);
           continue;
         }
@@ -1051,6 +1207,63 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p++;
           continue;
         }
+        case VM_OC_PUSH_ARGUMENTS_OBJECT:
+        {
+          uint16_t literal_index;
+
+          READ_LITERAL_INDEX (literal_index);
+
+          if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_LAZY_ARGUMENTS)
+          {
+            /* The arguments object is not created: the
+             * following element access reads the frame. */
+            result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+            break;
+          }
+
+          READ_LITERAL (literal_index, result);
+          break;
+        }
+        case VM_OC_PUSH_ARGUMENTS_LENGTH:
+        {
+          uint16_t literal_index;
+
+          READ_LITERAL_INDEX (literal_index);
+
+          if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_LAZY_ARGUMENTS)
+          {
+            result = ecma_make_uint32_value (frame_ctx_p->arg_list_len);
+            break;
+          }
+
+          READ_LITERAL (literal_index, left_value);
+          right_value = ecma_make_string_value (ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH));
+
+          result = vm_op_get_value (left_value, right_value);
+
+          if (ECMA_IS_VALUE_ERROR (result))
+          {
+            goto error;
+          }
+          break;
+        }
+        case VM_OC_PUSH_ARGUMENTS_ELEMENT:
+        {
+          if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_LAZY_ARGUMENTS)
+          {
+            result = vm_get_lazy_arguments_element (frame_ctx_p, right_value);
+          }
+          else
+          {
+            result = vm_op_get_value (left_value, right_value);
+          }
+
+          if (ECMA_IS_VALUE_ERROR (result))
+          {
+            goto error;
+          }
+          break;
+        }
         case VM_OC_IDENT_REFERENCE:
         {
           uint16_t literal_index;
@@ -1222,7 +1435,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 }
               }
 
-              result = (ecma_value_t) (int_value + int_increase);
+              result = ecma_make_integer_value ((int_value + int_increase) >> ECMA_DIRECT_SHIFT);
               break;
             }
           }
@@ -1477,6 +1690,66 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
+        case VM_OC_BRANCH_SWITCH_TABLE:
+        {
+          uint32_t max_value = *byte_code_p++;
+          uint32_t index = max_value + 1;
+
+          if (ecma_is_value_integer_number (left_value))
+          {
+            ecma_integer_value_t int_value = ecma_get_integer_from_value (left_value);
+
+            if (int_value >= 0 && int_value <= (ecma_integer_value_t) max_value)
+            {
+              index = (uint32_t) int_value;
+            }
+          }
+          else if (ecma_is_value_float_number (left_value))
+          {
+            ecma_number_t number = ecma_get_float_from_value (left_value);
+
+            /* Negative zero selects the first entry as well. */
+            if (number >= 0
+                && number <= max_value
+                && number == (ecma_number_t) (uint32_t) number)
+            {
+              index = (uint32_t) number;
+            }
+          }
+
+          /* The entries are jump instructions with the same length. Out of
+           * range values select the jump to the default case after them. */
+          byte_code_p += index * (2 + CBC_BRANCH_OFFSET_LENGTH (byte_code_p[1]));
+          goto free_left_value;
+        }
+        case VM_OC_BRANCH_SWITCH_HASH:
+        {
+          ecma_value_t value = stack_top_p[-1];
+          uint32_t mask = *byte_code_p++;
+          uint32_t index = mask + 1;
+
+          JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
+
+          /* The selected entry jumps to the first case whose value has the same
+           * hash, and the strict equality checks of the cases are evaluated from
+           * there. Equal values always have equal hashes, so the skipped cases
+           * cannot match. Other values select the last case check. */
+          if (ecma_is_value_integer_number (value))
+          {
+            index = ((uint32_t) ecma_get_integer_from_value (value)) & mask;
+          }
+          else if (ecma_is_value_number (value))
+          {
+            index = ecma_number_to_uint32 (ecma_get_number_from_value (value)) & mask;
+          }
+          else if (ecma_is_value_string (value))
+          {
+            index = ((uint32_t) ecma_string_hash (ecma_get_string_from_value (value))) & mask;
+          }
+
+          byte_code_p += index * (2 + CBC_BRANCH_OFFSET_LENGTH (byte_code_p[1]));
+          continue;
+        }
         case VM_OC_BRANCH_IF_TRUE:
         case VM_OC_BRANCH_IF_FALSE:
         case VM_OC_BRANCH_IF_LOGICAL_TRUE:
@@ -1544,6 +1817,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_BIT_NOT:
         {
+          if (ecma_is_value_integer_number (left_value))
+          {
+            *stack_top_p++ = ecma_make_integer_value (~ecma_get_integer_from_value (left_value));
+            continue;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_NOT,
                                             left_value,
                                             left_value);
@@ -1720,15 +1999,26 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             if (-ECMA_INTEGER_MULTIPLY_MAX <= left_integer
                 && left_integer <= ECMA_INTEGER_MULTIPLY_MAX
                 && -ECMA_INTEGER_MULTIPLY_MAX <= right_integer
-                && right_integer <= ECMA_INTEGER_MULTIPLY_MAX)
+                && right_integer <= ECMA_INTEGER_MULTIPLY_MAX
+                && (left_integer | right_integer) >= 0)
             {
               result = ecma_make_integer_value (left_integer * right_integer);
               break;
             }
 
-            ecma_number_t multiply = ecma_number_multiply ((ecma_number_t) left_integer,
-                                                           (ecma_number_t) right_integer);
-            result = ecma_make_number_value (multiply);
+            /* The product of two integer values always fits into 64 bits. */
+            int64_t multiply = (int64_t) left_integer * (int64_t) right_integer;
+
+            /* Zero products with a negative factor must be negative zero. */
+            if (ECMA_IS_INTEGER_NUMBER (multiply)
+                && (multiply != 0 || (left_integer | right_integer) >= 0))
+            {
+              result = ecma_make_integer_value ((ecma_integer_value_t) multiply);
+              break;
+            }
+
+            result = ecma_make_number_value (ecma_number_multiply ((ecma_number_t) left_integer,
+                                                                   (ecma_number_t) right_integer));
             break;
           }
 
@@ -1769,6 +2059,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
 
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* Exact quotients are integers, except for negative zero. */
+            if (right_integer != 0
+                && left_integer % right_integer == 0
+                && (left_integer != 0 || right_integer > 0))
+            {
+              result = ecma_make_int32_value ((int32_t) (left_integer / right_integer));
+              break;
+            }
+          }
+
           result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                          left_value,
                                          right_value);
@@ -1813,6 +2118,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            *stack_top_p++ = ecma_make_boolean_value (left_value == right_value);
+            continue;
+          }
+
           result = opfunc_equal_value (left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1825,6 +2136,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_NOT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            *stack_top_p++ = ecma_make_boolean_value (left_value != right_value);
+            continue;
+          }
+
           result = opfunc_not_equal_value (left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1837,6 +2154,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_STRICT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            *stack_top_p++ = ecma_make_boolean_value (left_value == right_value);
+            continue;
+          }
+
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (is_equal);
@@ -1846,6 +2169,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_STRICT_NOT_EQUAL:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            *stack_top_p++ = ecma_make_boolean_value (left_value != right_value);
+            continue;
+          }
+
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (!is_equal);
@@ -1855,6 +2184,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_BIT_OR:
         {
+          JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
+                               ecma_direct_type_integer_value_must_be_zero);
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = left_value | right_value;
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
                                             left_value,
                                             right_value);
@@ -1867,6 +2205,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_BIT_XOR:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = ecma_make_integer_value (ecma_get_integer_from_value (left_value)
+                                              ^ ecma_get_integer_from_value (right_value));
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR,
                                             left_value,
                                             right_value);
@@ -1879,6 +2224,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_BIT_AND:
         {
+          JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
+                               ecma_direct_type_integer_value_must_be_zero);
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = left_value & right_value;
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND,
                                             left_value,
                                             right_value);
@@ -1891,6 +2245,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_LEFT_SHIFT:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+            result = ecma_make_int32_value ((int32_t) ((uint32_t) left_integer << (right_integer & 0x1f)));
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT,
                                             left_value,
                                             right_value);
@@ -1903,6 +2265,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_RIGHT_SHIFT:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+            result = ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT,
                                             left_value,
                                             right_value);
@@ -1915,6 +2285,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_UNS_RIGHT_SHIFT:
         {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+            result = ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f));
+            break;
+          }
+
           result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT,
                                             left_value,
                                             right_value);
@@ -2111,10 +2489,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
           ecma_value_t expr_obj_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
-          ecma_collection_header_t *header_p = opfunc_for_in (value, &expr_obj_value);
+          ecma_for_in_iterator_t *iterator_p = opfunc_for_in (value, &expr_obj_value);
           ecma_free_value (value);
 
-          if (header_p == NULL)
+          if (iterator_p == NULL)
           {
             byte_code_p = byte_code_start_p + branch_offset;
             continue;
@@ -2125,62 +2503,42 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_PLUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
           stack_top_p += PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_FOR_IN, branch_offset);
-          stack_top_p[-2] = header_p->first_chunk_cp;
-          stack_top_p[-3] = expr_obj_value;
+          jmem_cpointer_t iterator_cp;
+          ECMA_SET_NON_NULL_POINTER (iterator_cp, iterator_p);
 
-          ecma_dealloc_collection_header (header_p);
+          stack_top_p[-2] = iterator_cp;
+          stack_top_p[-3] = expr_obj_value;
           continue;
         }
         case VM_OC_FOR_IN_GET_NEXT:
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
-          ecma_collection_chunk_t *chunk_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, context_top_p[-2]);
+          ecma_for_in_iterator_t *iterator_p = ECMA_GET_NON_NULL_POINTER (ecma_for_in_iterator_t,
+                                                                           context_top_p[-2]);
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-          lit_utf8_byte_t *data_ptr = chunk_p->data;
-          result = *(ecma_value_t *) data_ptr;
-          context_top_p[-2] = chunk_p->next_chunk_cp;
-
-          ecma_dealloc_collection_chunk (chunk_p);
-
-          *stack_top_p++ = result;
+          *stack_top_p++ = ecma_op_for_in_iterator_get_next (iterator_p);
           continue;
         }
         case VM_OC_FOR_IN_HAS_NEXT:
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
-          while (true)
-          {
-            if (stack_top_p[-2] == JMEM_CP_NULL)
-            {
-              ecma_free_value (stack_top_p[-3]);
-
-              VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
-              stack_top_p -= PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
-              break;
-            }
+          ecma_for_in_iterator_t *iterator_p = ECMA_GET_NON_NULL_POINTER (ecma_for_in_iterator_t,
+                                                                           stack_top_p[-2]);
 
-            ecma_collection_chunk_t *chunk_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, stack_top_p[-2]);
-
-            lit_utf8_byte_t *data_ptr = chunk_p->data;
-            ecma_string_t *prop_name_p = ecma_get_string_from_value (*(ecma_value_t *) data_ptr);
-
-            if (!ecma_op_object_has_property (ecma_get_object_from_value (stack_top_p[-3]),
-                                              prop_name_p))
-            {
-              stack_top_p[-2] = chunk_p->next_chunk_cp;
-              ecma_deref_ecma_string (prop_name_p);
-              ecma_dealloc_collection_chunk (chunk_p);
-            }
-            else
-            {
-              byte_code_p = byte_code_start_p + branch_offset;
-              break;
-            }
+          if (ecma_op_for_in_iterator_has_next (iterator_p))
+          {
+            byte_code_p = byte_code_start_p + branch_offset;
+            continue;
           }
 
+          ecma_op_for_in_free_iterator (iterator_p);
+          ecma_free_value (stack_top_p[-3]);
+
+          VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
+          stack_top_p -= PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION;
           continue;
         }
         case VM_OC_TRY:
@@ -2232,7 +2590,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             case VM_CONTEXT_FINALLY_JUMP:
             {
-              uint32_t jump_target = stack_top_p[-2];
+              uint32_t jump_target = (uint32_t) stack_top_p[-2];
 
               VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth,
                                   PARSER_TRY_CONTEXT_STACK_ALLOCATION);
@@ -2620,6 +2978,7 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
         ecma_value_t this_binding_value, /**< value of 'ThisBinding' */
         ecma_object_t *lex_env_p, /**< lexical environment to use */
         bool is_eval_code, /**< is the code is eval code (ECMA-262 v5, 10.1) */
+        ecma_object_t *func_obj_p, /**< function object (NULL for global and eval code) */
         const ecma_value_t *arg_list_p, /**< arguments list */
         ecma_length_t arg_list_len) /**< length of arguments list */
 {
@@ -2656,6 +3015,9 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   frame_ctx.context_depth = 0;
   frame_ctx.is_eval_code = is_eval_code;
   frame_ctx.call_operation = VM_NO_EXEC_OP;
+  frame_ctx.arg_list_p = arg_list_p;
+  frame_ctx.arg_list_len = arg_list_len;
+  frame_ctx.func_obj_p = func_obj_p;
 
   ecma_value_t stack[call_stack_size];
   frame_ctx.registers_p = stack;
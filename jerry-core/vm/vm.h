@@ -119,9 +119,13 @@ typedef enum
   VM_OC_PUSH_NUMBER_NEG_BYTE,    /**< push number between -1 and -256 */
   VM_OC_PUSH_OBJECT,             /**< push object */
   VM_OC_SET_PROPERTY,            /**< set property */
+  VM_OC_SET_PROPERTIES,          /**< set the properties of an object literal */
   VM_OC_SET_GETTER,              /**< set getter */
   VM_OC_SET_SETTER,              /**< set setter */
   VM_OC_PUSH_UNDEFINED_BASE,     /**< push undefined base */
+  VM_OC_PUSH_ARGUMENTS_OBJECT,   /**< push arguments object */
+  VM_OC_PUSH_ARGUMENTS_LENGTH,   /**< push length of arguments */
+  VM_OC_PUSH_ARGUMENTS_ELEMENT,  /**< push an element of arguments */
   VM_OC_PUSH_ARRAY,              /**< push array */
   VM_OC_PUSH_ELISON,             /**< push elison */
   VM_OC_APPEND_ARRAY,            /**< append array */
@@ -156,6 +160,8 @@ typedef enum
 
   VM_OC_JUMP,                    /**< jump */
   VM_OC_BRANCH_IF_STRICT_EQUAL,  /**< branch if stric equal */
+  VM_OC_BRANCH_SWITCH_TABLE,     /**< branch through a dense switch table */
+  VM_OC_BRANCH_SWITCH_HASH,      /**< branch through a hashed switch table */
 
   /* These four opcodes must be in this order. */
   VM_OC_BRANCH_IF_TRUE,          /**< branch if true */
@@ -279,8 +285,8 @@ extern ecma_value_t vm_run_global (const ecma_compiled_code_t *);
 extern ecma_value_t vm_run_eval (ecma_compiled_code_t *, bool);
 
 extern ecma_value_t vm_run (const ecma_compiled_code_t *, ecma_value_t,
-                            ecma_object_t *, bool, const ecma_value_t *,
-                            ecma_length_t);
+                            ecma_object_t *, bool, ecma_object_t *,
+                            const ecma_value_t *, ecma_length_t);
 
 extern bool vm_is_strict_mode (void);
 extern bool vm_is_direct_eval_form_call (void);
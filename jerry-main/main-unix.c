@@ -41,9 +41,20 @@
 
 static uint8_t buffer[ JERRY_BUFFER_SIZE ];
 
+/**
+ * Buffer of the executed snapshots
+ *
+ * Note:
+ *      snapshots are executed without copying their byte code and string literals
+ *      into the engine's memory, so this buffer is kept until jerry_cleanup is called.
+ */
+static uint32_t snapshot_buffer[ JERRY_BUFFER_SIZE / sizeof (uint32_t) ];
+
 static const uint8_t *
-read_file (const char *file_name,
-           size_t *out_size_p)
+read_file_to_buffer (const char *file_name,
+                     uint8_t *buffer_p,
+                     size_t buffer_size,
+                     size_t *out_size_p)
 {
   FILE *file;
   if (!strcmp ("-", file_name))
@@ -60,7 +71,7 @@ read_file (const char *file_name,
     }
   }
 
-  size_t bytes_read = fread (buffer, 1u, sizeof (buffer), file);
+  size_t bytes_read = fread (buffer_p, 1u, buffer_size, file);
   if (!bytes_read)
   {
     jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to read file: %s\n", file_name);
@@ -71,7 +82,14 @@ read_file (const char *file_name,
   fclose (file);
 
   *out_size_p = bytes_read;
-  return (const uint8_t *) buffer;
+  return (const uint8_t *) buffer_p;
+} /* read_file_to_buffer */
+
+static const uint8_t *
+read_file (const char *file_name,
+           size_t *out_size_p)
+{
+  return read_file_to_buffer (file_name, buffer, sizeof (buffer), out_size_p);
 } /* read_file */
 
 /**
@@ -123,6 +141,8 @@ print_help (char *name)
                       "  --save-snapshot-for-global FILE\n"
                       "  --save-snapshot-for-eval FILE\n"
                       "  --exec-snapshot FILE\n"
+                      "  --save-heap-image FILE\n"
+                      "  --exec-heap-image FILE\n"
                       "  --log-level [0-3]\n"
                       "  --abort-on-fail\n"
                       "  --no-prompt\n"
@@ -355,6 +375,8 @@ main (int argc,
   bool is_save_snapshot_mode = false;
   bool is_save_snapshot_mode_for_global_or_eval = false;
   const char *save_snapshot_file_name_p = NULL;
+  const char *save_heap_image_file_name_p = NULL;
+  const char *exec_heap_image_file_name_p = NULL;
 
   bool is_repl_mode = false;
   bool no_prompt = false;
@@ -429,6 +451,25 @@ main (int argc,
       assert (exec_snapshots_count < JERRY_MAX_COMMAND_LINE_ARGS);
       exec_snapshot_file_names[exec_snapshots_count++] = argv[i];
     }
+    else if (!strcmp ("--save-heap-image", argv[i])
+             || !strcmp ("--exec-heap-image", argv[i]))
+    {
+      if (++i >= argc)
+      {
+        jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: no file specified for %s\n", argv[i - 1]);
+        print_usage (argv[0]);
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      if (!strcmp ("--save-heap-image", argv[i - 1]))
+      {
+        save_heap_image_file_name_p = argv[i];
+      }
+      else
+      {
+        exec_heap_image_file_name_p = argv[i];
+      }
+    }
     else if (!strcmp ("--log-level", argv[i]))
     {
       if (++i >= argc)
@@ -473,10 +514,10 @@ main (int argc,
 
   if (is_save_snapshot_mode)
   {
-    if (files_counter != 1)
+    if (files_counter == 0)
     {
       jerry_port_log (JERRY_LOG_LEVEL_ERROR,
-                      "Error: --save-snapshot argument works with exactly one script\n");
+                      "Error: --save-snapshot argument requires at least one script\n");
       return JERRY_STANDALONE_EXIT_CODE_FAIL;
     }
 
@@ -488,35 +529,73 @@ main (int argc,
     }
   }
 
+  if (save_heap_image_file_name_p != NULL && is_save_snapshot_mode)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR,
+                    "Error: --save-heap-image and --save-snapshot options can't be passed simultaneously\n");
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
   if (files_counter == 0
       && exec_snapshots_count == 0)
   {
+    if (save_heap_image_file_name_p != NULL)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: --save-heap-image requires a script or a snapshot\n");
+      return JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+
     is_repl_mode = true;
   }
 
-  jerry_init (flags);
+  if (exec_heap_image_file_name_p != NULL)
+  {
+    /* The image already contains the 'assert' method. */
+    size_t image_size;
+    const uint8_t *image_p = read_file (exec_heap_image_file_name_p, &image_size);
+
+    if (image_p == NULL)
+    {
+      return JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+
+    if (!jerry_init_from_heap_image (image_p, image_size))
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: invalid heap image: %s\n", exec_heap_image_file_name_p);
+      return JERRY_STANDALONE_EXIT_CODE_FAIL;
+    }
+  }
+  else
+  {
+    jerry_init (flags);
 
-  jerry_value_t global_obj_val = jerry_get_global_object ();
-  jerry_value_t assert_value = jerry_create_external_function (assert_handler);
+    jerry_value_t global_obj_val = jerry_get_global_object ();
+    jerry_value_t assert_value = jerry_create_external_function (assert_handler);
 
-  jerry_value_t assert_func_name_val = jerry_create_string ((jerry_char_t *) "assert");
-  bool is_assert_added = jerry_set_property (global_obj_val, assert_func_name_val, assert_value);
+    jerry_value_t assert_func_name_val = jerry_create_string ((jerry_char_t *) "assert");
+    bool is_assert_added = jerry_set_property (global_obj_val, assert_func_name_val, assert_value);
 
-  jerry_release_value (assert_func_name_val);
-  jerry_release_value (assert_value);
-  jerry_release_value (global_obj_val);
+    jerry_release_value (assert_func_name_val);
+    jerry_release_value (assert_value);
+    jerry_release_value (global_obj_val);
 
-  if (!is_assert_added)
-  {
-    jerry_port_log (JERRY_LOG_LEVEL_WARNING, "Warning: failed to register 'assert' method.");
+    if (!is_assert_added)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_WARNING, "Warning: failed to register 'assert' method.");
+    }
   }
 
   jerry_value_t ret_value = jerry_create_undefined ();
 
+  size_t snapshot_buffer_used = 0;
+
   for (int i = 0; i < exec_snapshots_count; i++)
   {
     size_t snapshot_size;
-    const uint8_t *snapshot_p = read_file (exec_snapshot_file_names[i], &snapshot_size);
+    const uint8_t *snapshot_p = read_file_to_buffer (exec_snapshot_file_names[i],
+                                                     ((uint8_t *) snapshot_buffer) + snapshot_buffer_used,
+                                                     sizeof (snapshot_buffer) - snapshot_buffer_used,
+                                                     &snapshot_size);
 
     if (snapshot_p == NULL)
     {
@@ -524,9 +603,31 @@ main (int argc,
     }
     else
     {
-      ret_value = jerry_exec_snapshot ((void *) snapshot_p,
-                                       snapshot_size,
-                                       true);
+      /* Keep the start of the next snapshot aligned. */
+      snapshot_buffer_used += (snapshot_size + sizeof (uint32_t) - 1) & ~(sizeof (uint32_t) - 1);
+
+      /* All units of the snapshot are executed in order. */
+      size_t func_count = jerry_get_snapshot_func_count (snapshot_p, snapshot_size);
+
+      if (func_count == 0)
+      {
+        /* Report the error of the snapshot. */
+        func_count = 1;
+      }
+
+      for (size_t func_index = 0; func_index < func_count; func_index++)
+      {
+        jerry_release_value (ret_value);
+        ret_value = jerry_exec_snapshot_at ((void *) snapshot_p,
+                                            snapshot_size,
+                                            func_index,
+                                            false);
+
+        if (jerry_value_has_error_flag (ret_value))
+        {
+          break;
+        }
+      }
     }
 
     if (jerry_value_has_error_flag (ret_value))
@@ -535,12 +636,20 @@ main (int argc,
     }
   }
 
-  if (!jerry_value_has_error_flag (ret_value))
+  if (is_save_snapshot_mode)
   {
+    /* Each script is saved as a separate unit named after its file. The sources are
+     * kept in the snapshot buffer, which is not used for executing snapshots here. */
+    static jerry_snapshot_unit_t units[JERRY_MAX_COMMAND_LINE_ARGS];
+    size_t sources_size = 0;
+
     for (int i = 0; i < files_counter; i++)
     {
       size_t source_size;
-      const jerry_char_t *source_p = read_file (file_names[i], &source_size);
+      const jerry_char_t *source_p = read_file_to_buffer (file_names[i],
+                                                          ((uint8_t *) snapshot_buffer) + sources_size,
+                                                          sizeof (snapshot_buffer) - sources_size,
+                                                          &source_size);
 
       if (source_p == NULL)
       {
@@ -548,37 +657,54 @@ main (int argc,
         break;
       }
 
-      if (is_save_snapshot_mode)
+      sources_size += source_size;
+
+      units[i].name_p = (const jerry_char_t *) file_names[i];
+      units[i].name_size = strlen (file_names[i]);
+      units[i].source_p = source_p;
+      units[i].source_size = source_size;
+      units[i].is_for_global = is_save_snapshot_mode_for_global_or_eval;
+      units[i].is_strict = false;
+    }
+
+    if (!jerry_value_has_error_flag (ret_value))
+    {
+      size_t snapshot_size = jerry_parse_and_save_snapshot_units (units,
+                                                                  (size_t) files_counter,
+                                                                  buffer,
+                                                                  JERRY_BUFFER_SIZE);
+      if (snapshot_size == 0)
       {
-        static uint8_t snapshot_save_buffer[ JERRY_BUFFER_SIZE ];
-
-        size_t snapshot_size = jerry_parse_and_save_snapshot ((jerry_char_t *) source_p,
-                                                              source_size,
-                                                              is_save_snapshot_mode_for_global_or_eval,
-                                                              false,
-                                                              snapshot_save_buffer,
-                                                              JERRY_BUFFER_SIZE);
-        if (snapshot_size == 0)
-        {
-          ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
-        }
-        else
-        {
-          FILE *snapshot_file_p = fopen (save_snapshot_file_name_p, "w");
-          fwrite (snapshot_save_buffer, sizeof (uint8_t), snapshot_size, snapshot_file_p);
-          fclose (snapshot_file_p);
-        }
+        ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
       }
       else
       {
-        ret_value = jerry_parse (source_p, source_size, false);
+        FILE *snapshot_file_p = fopen (save_snapshot_file_name_p, "w");
+        fwrite (buffer, sizeof (uint8_t), snapshot_size, snapshot_file_p);
+        fclose (snapshot_file_p);
+      }
+    }
+  }
+  else if (!jerry_value_has_error_flag (ret_value))
+  {
+    for (int i = 0; i < files_counter; i++)
+    {
+      size_t source_size;
+      const jerry_char_t *source_p = read_file (file_names[i], &source_size);
+
+      if (source_p == NULL)
+      {
+        ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
+        break;
+      }
 
-        if (!jerry_value_has_error_flag (ret_value) && !is_parse_only)
-        {
-          jerry_value_t func_val = ret_value;
-          ret_value = jerry_run (func_val);
-          jerry_release_value (func_val);
-        }
+      ret_value = jerry_parse (source_p, source_size, false);
+
+      if (!jerry_value_has_error_flag (ret_value) && !is_parse_only)
+      {
+        jerry_value_t func_val = ret_value;
+        ret_value = jerry_run (func_val);
+        jerry_release_value (func_val);
       }
 
       if (jerry_value_has_error_flag (ret_value))
@@ -588,6 +714,27 @@ main (int argc,
     }
   }
 
+  if (save_heap_image_file_name_p != NULL && !jerry_value_has_error_flag (ret_value))
+  {
+    /* The completion value must not be kept alive by the image. */
+    jerry_release_value (ret_value);
+    ret_value = jerry_create_undefined ();
+
+    size_t image_size = jerry_save_heap_image (buffer, JERRY_BUFFER_SIZE);
+
+    if (image_size == 0)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot save heap image\n");
+      ret_value = jerry_create_error (JERRY_ERROR_COMMON, (jerry_char_t *) "");
+    }
+    else
+    {
+      FILE *image_file_p = fopen (save_heap_image_file_name_p, "w");
+      fwrite (buffer, sizeof (uint8_t), image_size, image_file_p);
+      fclose (image_file_p);
+    }
+  }
+
   if (is_repl_mode)
   {
     const char *prompt = !no_prompt ? "jerry> " : "";
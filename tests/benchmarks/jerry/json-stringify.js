@@ -0,0 +1,39 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var items = [];
+for (var i = 0; i < 300; i++)
+{
+  items.push ({
+    id: i,
+    name: "item \"" + i + "\"\n",
+    price: i * 1.25,
+    available: (i % 3) !== 0,
+    tags: ["alpha", "beta", "gamma\t" + i],
+    owner: { first: "John", last: "Doe", address: null }
+  });
+}
+
+var data = { title: "JSON.stringify benchmark", count: items.length, items: items };
+var length = 0;
+
+for (var i = 0; i < 40; i++)
+{
+  length += JSON.stringify (data).length;
+  length += JSON.stringify (data, null, 2).length;
+}
+
+assert (length > 0);
+assert (JSON.parse (JSON.stringify (data)).items[299].name === "item \"299\"\n");
@@ -0,0 +1,47 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var text = "";
+for (var i = 0; i < 2000; i++)
+{
+  text += "ab_C-9.x";
+}
+
+var count = 0;
+
+for (var i = 0; i < 200; i++)
+{
+  if (/^[A-Za-z0-9_\-.]+$/.test (text))
+  {
+    count++;
+  }
+
+  if (/^[\w.-]+$/.test (text))
+  {
+    count++;
+  }
+
+  if (/^[^\s;]+$/.test (text))
+  {
+    count++;
+  }
+
+  if (/^[a-z0-9_.-]+$/i.test (text))
+  {
+    count++;
+  }
+}
+
+assert (count === 800);
@@ -0,0 +1,189 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function sum () {
+  var result = 0;
+  for (var i = 0; i < arguments.length; i++) {
+    result += arguments[i];
+  }
+  return result;
+}
+
+assert (sum () === 0);
+assert (sum (1, 2, 3) === 6);
+assert (sum (1, 2, 3, 4, 5, 6, 7, 8, 9, 10) === 55);
+
+function strict_sum () {
+  "use strict";
+  var result = 0;
+  for (var i = 0; i < arguments.length; i++) {
+    result += arguments[i];
+  }
+  return result;
+}
+
+assert (strict_sum (4, 5, 6) === 15);
+
+/* Mapped arguments. */
+function mapped (a, b) {
+  a = 5;
+  return arguments[0] + arguments[1] * 10 + arguments.length * 100;
+}
+
+assert (mapped (1, 2) === 225);
+assert (isNaN (mapped (1)));
+assert (isNaN (mapped ()));
+
+function unmapped (a, b) {
+  "use strict";
+  a = 5;
+  return arguments[0] + arguments[1] * 10;
+}
+
+assert (unmapped (1, 2) === 21);
+
+function not_passed (a, b) {
+  b = 8;
+  return arguments[1];
+}
+
+assert (not_passed (1) === undefined);
+assert (not_passed (1, 2) === 8);
+
+function duplicated (a, a) {
+  return arguments[0] * 10 + arguments[1] + a * 100;
+}
+
+assert (duplicated (1, 2) === 212);
+
+/* Other property keys. */
+function keys (key) {
+  return arguments[key];
+}
+
+assert (keys (0) === 0);
+assert (keys ("0") === "0");
+assert (keys (0.5) === undefined);
+assert (keys (-1) === undefined);
+assert (keys ("length") === 1);
+assert (keys ("callee") === keys);
+assert (keys ("toString") === Object.prototype.toString);
+assert (keys ("hasOwnProperty") === Object.prototype.hasOwnProperty);
+
+function strict_keys (key) {
+  "use strict";
+  return arguments[key];
+}
+
+try {
+  strict_keys ("callee");
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+function index_expression (i) {
+  return arguments[i + 1] + arguments[arguments.length - 1];
+}
+
+assert (index_expression (0, 2, 3) === 5);
+
+/* The arguments object is needed. */
+function escaped () {
+  return arguments;
+}
+
+assert (escaped (1, 2).length === 2);
+assert (Object.prototype.toString.call (escaped ()) === "[object Arguments]");
+
+function assigned (a) {
+  var len = arguments.length;
+  arguments[0] = 6;
+  return a * 10 + len;
+}
+
+assert (assigned (1) === 61);
+
+function length_assigned () {
+  arguments.length = 5;
+  return arguments.length;
+}
+
+assert (length_assigned (1) === 5);
+
+function incremented (a) {
+  arguments[0]++;
+  return a + arguments[0];
+}
+
+assert (incremented (1) === 4);
+
+function deleted (a) {
+  delete arguments[0];
+  return arguments[0];
+}
+
+assert (deleted (1) === undefined);
+
+function called () {
+  return arguments[0] ();
+}
+
+assert (called (function () { return this; }).length === 1);
+
+function captured (a) {
+  function inner () {
+    return a;
+  }
+  a = 3;
+  return arguments[0] + inner ();
+}
+
+assert (captured (1) === 6);
+
+function shadowed () {
+  var result = arguments.length;
+  function arguments () {
+    return 1;
+  }
+  return result;
+}
+
+assert (shadowed (1, 2) === 0);
+
+function inner_arguments () {
+  function inner () {
+    return arguments.length;
+  }
+  return arguments.length * 10 + inner (1, 2, 3);
+}
+
+assert (inner_arguments (1) === 13);
+
+function with_arguments () {
+  var obj = { arguments: [ 4, 5 ] };
+  with (obj) {
+    return arguments.length + arguments[1];
+  }
+}
+
+assert (with_arguments (1, 2, 3) === 7);
+
+function eval_arguments () {
+  var len = arguments.length;
+  return len + eval ("arguments[0]");
+}
+
+assert (eval_arguments (5) === 6);
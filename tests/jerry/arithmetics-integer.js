@@ -0,0 +1,91 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function is_negative_zero (value)
+{
+  return value === 0 && 1 / value < 0;
+}
+
+var zero = 0;
+var two = 2;
+var minus_two = -2;
+
+/* Multiplication. */
+assert (two * 3 === 6);
+assert (minus_two * 3 === -6);
+assert (minus_two * minus_two === 4);
+assert (is_negative_zero (zero * minus_two));
+assert (is_negative_zero (minus_two * zero));
+assert (!is_negative_zero (zero * two));
+assert (46341 * 46341 === 2147488281);
+assert (-46341 * 46341 === -2147488281);
+assert (0x7ffffff * 2 === 268435454);
+assert (-0x8000000 * -0x8000000 === 18014398509481984);
+assert (12345 * -2 === -24690);
+
+/* Division. */
+assert (6 / two === 3);
+assert (-6 / two === -3);
+assert (7 / two === 3.5);
+assert (is_negative_zero (zero / minus_two));
+assert (!is_negative_zero (zero / two));
+assert (two / zero === Infinity);
+assert (minus_two / zero === -Infinity);
+assert (isNaN (zero / zero));
+assert (-0x8000000 / -1 === 0x8000000);
+
+/* Remainder. */
+assert (7 % two === 1);
+assert (-7 % two === -1);
+assert (is_negative_zero (-6 % two));
+assert (isNaN (two % zero));
+
+/* Addition and subtraction beyond the integer range. */
+assert (0x7ffffff + 1 === 134217728);
+assert (-0x8000000 - 1 === -134217729);
+
+/* Bitwise operators. */
+assert ((5 | two) === 7);
+assert ((7 & minus_two) === 6);
+assert ((7 ^ minus_two) === -7);
+assert (~two === -3);
+assert (~minus_two === 1);
+assert ((1 << 30) === 1073741824);
+assert ((1 << 31) === -2147483648);
+assert ((1 << 32) === 1);
+assert ((-0x8000000 << 4) === -2147483648);
+assert ((-5 >> 1) === -3);
+assert ((-5 >>> 1) === 2147483645);
+assert ((-5 >>> 0) === 4294967291);
+assert ((5 >>> 33) === 2);
+
+/* Equality and relational operators. */
+assert (two === 2);
+assert (two !== minus_two);
+assert (two == 2);
+assert (two != minus_two);
+assert (minus_two < two);
+assert (!(two < minus_two));
+assert (two <= 2);
+assert (two > minus_two);
+assert (two >= 2);
+
+var sum = 0;
+for (var i = 0; i < 1000; i++)
+{
+  sum = (sum + i * i) % 65521;
+  sum = sum ^ (i << 3);
+}
+assert (sum === 43126);
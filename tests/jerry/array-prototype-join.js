@@ -75,3 +75,24 @@ obj_2[3] = 4;
 obj_2.join = Array.prototype.join;
 
 assert (obj_2.join() === "1,2,3");
+
+/* Joining into a string which is longer than 65535 bytes. */
+var long_array = [];
+for (var i = 0; i < 10000; i++)
+{
+  long_array.push (i % 10);
+}
+
+var long_string = long_array.join ("abcdef");
+assert (long_string.length === 69994);
+assert (long_string.substr (69980) === "abcdef8abcdef9");
+assert ([1, "é", null, undefined, 2].join ("é") === "1ééééé2");
+assert ([12].join () === "12");
+assert (["len", "gth"].join ("") === "length");
+
+try {
+  [1, { toString: function () { throw "error"; } }].join ();
+  assert (false);
+} catch (e) {
+  assert (e === "error");
+}
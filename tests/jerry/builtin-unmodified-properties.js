@@ -0,0 +1,63 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Reading built-in properties gives the same values every time. */
+assert (Math.PI === Math.PI);
+assert (Number.MAX_VALUE === 1.7976931348623157e+308);
+assert (Math.max === Math.max);
+assert (Math.max.length === 2);
+assert (Array.prototype.constructor === Array);
+assert (Object.prototype.toString === Object.prototype.toString);
+assert (RegExp.prototype.source === "(?:)");
+assert (/a/.toString () === "/a/");
+
+/* Non-writable properties are not changed by assignment. */
+Math.PI = 3;
+assert (Math.PI !== 3);
+
+/* Writable properties keep the assigned value. */
+var original_join = Array.prototype.join;
+Array.prototype.join = function () { return "joined"; };
+assert ([1, 2].join () === "joined");
+Array.prototype.join = original_join;
+assert ([1, 2].join () === "1,2");
+
+/* Deleted properties are not recreated by reading them. */
+assert (Number.prototype.constructor === Number);
+assert (delete Number.prototype.constructor);
+assert (Number.prototype.constructor === Object);
+assert (!Number.prototype.hasOwnProperty ("constructor"));
+
+assert (delete Math.abs);
+assert (Math.abs === undefined);
+
+/* Properties can be redefined before they are read. */
+Object.defineProperty (String.prototype, "trim", { value: 5, writable: false });
+assert (String.prototype.trim === 5);
+
+var desc = Object.getOwnPropertyDescriptor (Math, "E");
+assert (desc.value === Math.E && !desc.writable && !desc.enumerable && !desc.configurable);
+
+/* Unread properties are still listed. */
+var names = Object.getOwnPropertyNames (Math);
+assert (names.indexOf ("SQRT2") !== -1);
+assert (names.indexOf ("abs") === -1);
+assert (Math.hasOwnProperty ("LN2"));
+
+/* Inherited built-in properties. */
+var derived = Object.create (Math);
+assert (derived.LOG10E === Math.LOG10E);
+derived.LOG10E = 1;
+assert (derived.LOG10E === Math.LOG10E);
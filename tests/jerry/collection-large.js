@@ -0,0 +1,67 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var obj = {};
+for (var i = 0; i < 300; i++)
+{
+  obj["p" + i] = i;
+}
+obj[5] = "five";
+obj[1] = "one";
+
+var keys = Object.keys (obj);
+assert (keys.length === 302);
+assert (keys[0] === "1");
+assert (keys[1] === "5");
+for (var i = 0; i < 300; i++)
+{
+  assert (keys[i + 2] === "p" + i);
+}
+
+Object.defineProperty (obj, "hidden", { value: 1, enumerable: false });
+assert (Object.keys (obj).length === 302);
+assert (Object.getOwnPropertyNames (obj).length === 303);
+
+var copy = JSON.parse (JSON.stringify (obj));
+assert (Object.keys (copy).length === 302);
+assert (copy.p299 === 299);
+assert (copy[5] === "five");
+
+var descriptors = {};
+for (var i = 0; i < 100; i++)
+{
+  descriptors["d" + i] = { value: i, enumerable: true };
+}
+var defined = Object.defineProperties ({}, descriptors);
+assert (Object.keys (defined).length === 100);
+assert (defined.d42 === 42);
+
+var arr = [];
+for (var i = 0; i < 500; i++)
+{
+  arr.push ((i * 7919) % 500);
+}
+arr.sort (function (a, b) { return a - b; });
+for (var i = 0; i < 500; i++)
+{
+  assert (arr[i] === i);
+}
+
+var args = [];
+for (var i = 0; i < 200; i++)
+{
+  args.push (i);
+}
+assert (Math.max.apply (null, args) === 199);
@@ -0,0 +1,67 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Evaluating the same source repeatedly gives fresh functions and objects. */
+var functions = [];
+for (var i = 0; i < 5; i++)
+{
+  functions.push (eval ("(function (a) { return { value: a * 2 }; })"));
+}
+
+assert (functions[0] !== functions[1]);
+assert (functions[3] (4).value === 8);
+assert (functions[3] (4) !== functions[4] (4));
+
+/* The strict mode of the caller is part of the key. */
+var source = "(function () { return this === undefined; }) ()";
+assert (eval (source) === false);
+assert ((function () { "use strict"; return eval (source); }) () === true);
+assert (eval (source) === false);
+
+/* Syntax errors are reported every time. */
+for (var i = 0; i < 3; i++)
+{
+  try
+  {
+    eval ("var a = ;");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Function constructors sharing the same body. */
+var sum = 0;
+for (var i = 0; i < 20; i++)
+{
+  var f = new Function ("a", "b", "return a + b;");
+  sum += f (i, 1);
+}
+assert (sum === 210);
+
+/* More sources than cache entries. */
+for (var round = 0; round < 3; round++)
+{
+  for (var i = 0; i < 40; i++)
+  {
+    assert (eval ("" + i + " * 3") === i * 3);
+  }
+}
+
+/* Sources which differ only at the end. */
+assert (eval ("var x = 1; x + 1") === 2);
+assert (eval ("var x = 1; x + 2") === 3);
@@ -0,0 +1,187 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (obj)
+{
+  var result = [];
+  for (var name in obj)
+  {
+    result.push (name);
+  }
+  return result.join (",");
+}
+
+// Objects with the same layout share the cached names.
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (keys (new Point (i, i)) === "x,y");
+}
+
+var p = new Point (1, 2);
+p.z = 3;
+assert (keys (p) === "x,y,z");
+delete p.x;
+assert (keys (p) === "y,z");
+assert (keys (new Point (3, 4)) === "x,y");
+
+// Attribute changes are part of the layout.
+var q = new Point (1, 2);
+Object.defineProperty (q, "x", { enumerable: false });
+assert (keys (q) === "y");
+assert (keys (new Point (5, 6)) === "x,y");
+
+// Array indices are listed first in ascending order.
+var obj = { b: 1 };
+obj[5] = 0;
+obj.a = 2;
+obj[1] = 0;
+obj[3] = 0;
+assert (keys (obj) === "1,3,5,b,a");
+
+var arr = [];
+for (var i = 100; i >= 0; i -= 10)
+{
+  arr[i] = i;
+}
+assert (keys (arr) === "0,10,20,30,40,50,60,70,80,90,100");
+
+// Prototype properties are listed after own properties, shadowed names are skipped.
+function Base ()
+{
+  this.own = 1;
+  this.shared = 1;
+}
+Base.prototype.shared = 2;
+Base.prototype.proto = 3;
+Object.defineProperty (Base.prototype, "hidden", { value: 4, enumerable: false });
+
+var b = new Base ();
+assert (keys (b) === "own,shared,proto");
+
+Object.defineProperty (b, "proto", { value: 5, enumerable: false });
+assert (keys (b) === "own,shared");
+
+// Non-enumerable own properties shadow enumerable prototype properties.
+var c = Object.create ({ a: 1, b: 2 });
+Object.defineProperty (c, "a", { value: 3, enumerable: false });
+assert (keys (c) === "b");
+
+// A name is visited only once, even if the shadowing property is deleted.
+var d = Object.create ({ a: 1, b: 2 });
+d.a = 3;
+var visited = [];
+for (var name in d)
+{
+  visited.push (name);
+  delete d.a;
+}
+assert (visited.join (",") === "a,b");
+
+// Properties deleted during the enumeration are not visited.
+var e = { a: 1, b: 2, c: 3 };
+visited = [];
+for (var name in e)
+{
+  visited.push (name);
+  delete e.c;
+}
+assert (visited.join (",") === "a,b");
+
+var f = Object.create ({ x: 1, y: 2 });
+f.a = 1;
+visited = [];
+for (var name in f)
+{
+  visited.push (name);
+  delete Object.getPrototypeOf (f).y;
+}
+assert (visited.join (",") === "a,x");
+
+// String objects have enumerable index properties.
+var s = new String ("abc");
+s.x = 1;
+s[5] = 2;
+assert (keys (s) === "0,1,2,5,x");
+
+// Breaking out of the loop releases the enumeration state.
+for (var i = 0; i < 5; i++)
+{
+  for (var name in new Point (1, 2))
+  {
+    break;
+  }
+
+  try
+  {
+    for (var name in b)
+    {
+      throw name;
+    }
+  }
+  catch (ex)
+  {
+    assert (ex === "own");
+  }
+}
+
+// Large objects.
+var big = {};
+for (var i = 0; i < 1000; i++)
+{
+  big["k" + i] = i;
+}
+
+var count = 0;
+for (var name in big)
+{
+  assert (name === "k" + count);
+  count++;
+}
+assert (count === 1000);
+
+assert (keys (null) === "");
+assert (keys (undefined) === "");
+assert (keys ({}) === "");
+assert (keys (5) === "");
+
+// A cached layout must keep its names alive: a new name allocated at the
+// address of a freed one must not match the layout of a cached object.
+function enumerate_index_object (i)
+{
+  var obj = {};
+  obj[String (100000 + i)] = 1;
+  return keys (obj);
+}
+
+for (var i = 0; i < 2000; i++)
+{
+  assert (enumerate_index_object (i) === String (100000 + i));
+
+  var garbage = [];
+  for (var j = 0; j < 10; j++)
+  {
+    garbage.push ({ a: j, b: "x" + j });
+  }
+
+  var obj = {};
+  obj["n" + i] = 1;
+  assert (keys (obj) === "n" + i);
+}
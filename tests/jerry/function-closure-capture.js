@@ -0,0 +1,121 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Captured and non-captured locals. */
+function counter (start)
+{
+  var step = 1;
+  var unused = 5;
+  var count = start;
+
+  return function () {
+    count += step;
+    return count + unused * 0;
+  };
+}
+
+var c = counter (10);
+assert (c () === 11);
+assert (c () === 12);
+
+/* Variable declared after the inner function. */
+function late_declaration ()
+{
+  var get = function () { return value; };
+  var value = 7;
+  return get ();
+}
+assert (late_declaration () === 7);
+
+/* Captured argument. */
+function captured_argument (a, b)
+{
+  function sum () { return a + b; }
+  a = 3;
+  return sum ();
+}
+assert (captured_argument (1, 2) === 5);
+
+/* Function declaration stored in a register. */
+function register_function (x)
+{
+  var result = helper (x);
+  function helper (y) { return y * 2; }
+  return result + helper (1);
+}
+assert (register_function (4) === 10);
+
+/* Recursive function declaration. */
+function recursive (n)
+{
+  function fact (k) { return k <= 1 ? 1 : k * fact (k - 1); }
+  return fact (n);
+}
+assert (recursive (5) === 120);
+
+/* Variables captured by a deeply nested function. */
+function outer ()
+{
+  var x = 1;
+  var y = 2;
+  function middle ()
+  {
+    var z = 3;
+    return function () { return x + z; };
+  }
+  y = 5;
+  return middle () () + y;
+}
+assert (outer () === 9);
+
+/* Direct eval in an inner function. */
+function eval_in_inner ()
+{
+  var a = 1;
+  var b = 2;
+  function f () { return eval ("a + b"); }
+  return f ();
+}
+assert (eval_in_inner () === 3);
+
+/* Shadowing variables. */
+function shadowing ()
+{
+  var s = "outer";
+  function f () { var s = "inner"; return s; }
+  return f () + s;
+}
+assert (shadowing () === "innerouter");
+
+/* Closures created in a loop share the same binding. */
+function loop_closures ()
+{
+  var fns = [];
+  for (var i = 0; i < 3; i++)
+  {
+    fns.push (function () { return i; });
+  }
+  return fns[0] () + fns[1] () + fns[2] ();
+}
+assert (loop_closures () === 9);
+
+/* Global references from inner functions. */
+var global_value = 4;
+function global_ref ()
+{
+  var local = 1;
+  return (function () { return global_value + local; }) ();
+}
+assert (global_ref () === 5);
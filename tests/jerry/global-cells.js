@@ -0,0 +1,154 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var global = this;
+
+var counter = 0;
+
+function increment ()
+{
+  for (var i = 0; i < 100; i++)
+  {
+    counter = counter + 1;
+  }
+  return counter;
+}
+
+assert (increment () === 100);
+assert (increment () === 200);
+assert (global.counter === 200);
+
+/* Delete and re-add an implicitly created global. */
+implicit = 5;
+assert (implicit === 5);
+assert (delete implicit);
+assert (typeof implicit === "undefined");
+
+try
+{
+  implicit;
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof ReferenceError);
+}
+
+implicit = 6;
+assert (implicit === 6);
+global.implicit = 7;
+assert (implicit === 7);
+
+/* Convert a global variable to an accessor. */
+configurable = 1;
+assert (configurable === 1);
+
+var getter_calls = 0;
+var setter_value;
+Object.defineProperty (global, "configurable", {
+  get: function () { getter_calls++; return 10; },
+  set: function (value) { setter_value = value; }
+});
+
+assert (configurable === 10);
+configurable = 20;
+assert (setter_value === 20);
+assert (configurable === 10);
+assert (getter_calls === 2);
+
+/* Convert it back to a data property. */
+Object.defineProperty (global, "configurable", { value: 30, writable: true });
+assert (configurable === 30);
+configurable = 31;
+assert (configurable === 31);
+
+/* Non-writable globals. */
+readonly = 1;
+assert (readonly === 1);
+Object.defineProperty (global, "readonly", { writable: false });
+readonly = 2;
+assert (readonly === 1);
+
+function strict_write ()
+{
+  "use strict";
+  readonly = 3;
+}
+
+try
+{
+  strict_write ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+assert (readonly === 1);
+
+undefined = 1;
+assert (undefined === void 0);
+
+/* Properties inherited by the global object. */
+assert (typeof hasOwnProperty === "function");
+Object.prototype.inherited = 4;
+assert (inherited === 4);
+inherited = 5;
+assert (global.hasOwnProperty ("inherited"));
+assert (inherited === 5);
+delete inherited;
+assert (inherited === 4);
+delete Object.prototype.inherited;
+
+/* Many globals with colliding cells. */
+for (var i = 0; i < 300; i++)
+{
+  global["g" + i] = i;
+}
+
+var sum = 0;
+for (var i = 0; i < 300; i++)
+{
+  sum += eval ("g" + i);
+}
+assert (sum === 44850);
+
+for (var i = 0; i < 300; i += 2)
+{
+  delete global["g" + i];
+}
+
+assert (typeof g0 === "undefined");
+assert (g1 === 1);
+assert (typeof g298 === "undefined");
+assert (g299 === 299);
+
+/* Globals shadowed by locals and with statements. */
+var shadowed = "global";
+
+function shadow ()
+{
+  var shadowed = "local";
+  return shadowed;
+}
+
+assert (shadow () === "local");
+
+with ({ shadowed: "with" })
+{
+  assert (shadowed === "with");
+  shadowed = "with2";
+}
+assert (shadowed === "global");
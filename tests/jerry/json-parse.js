@@ -370,3 +370,31 @@ assert (result.a == 1);
 
 result = JSON.parse(str, [1, 2, 3]);
 assert (result.a == 1);
+
+// Checking numbers which are converted directly
+assert (JSON.parse ("999999999") === 999999999);
+assert (JSON.parse ("-999999999") === -999999999);
+assert (JSON.parse ("4294967295") === 4294967295);
+assert (1 / JSON.parse ("-0") === -Infinity);
+assert (JSON.parse ("[10E2, 1.5e+2, 12.25]").join () === "1000,150,12.25");
+
+// Checking strings with escape sequences after a run of plain characters
+assert (JSON.parse ('"abcdef\\n\\u0041\\"x"') === "abcdef\nA\"x");
+assert (JSON.parse ('"plain"') === "plain");
+
+// Checking duplicated and shared property names
+result = JSON.parse ('{"a":1,"b":{"a":2},"a":3}');
+assert (result.a === 3);
+assert (result.b.a === 2);
+assert (Object.keys (result).join () === "a,b");
+
+var desc = Object.getOwnPropertyDescriptor (result, "a");
+assert (desc.writable && desc.enumerable && desc.configurable);
+
+result = JSON.parse ('[{"id":1,"name":"x"},{"id":2,"name":"y"},{"id":3,"name":"z"}]');
+assert (result.length === 3);
+assert (result[2].id === 3 && result[2].name === "z");
+
+result.push (4);
+assert (result.length === 4);
+assert (JSON.parse ('[[], [[]], {}]').length === 3);
@@ -213,3 +213,18 @@ assert (JSON.stringify (object, null, undefined) == '{"a":2}');
 assert (JSON.stringify (object, null, new Boolean (true)) == '{"a":2}');
 assert (JSON.stringify (object, null, [1, 2, 3] ) == '{"a":2}');
 assert (JSON.stringify (object, null, { "a": 3 }) == '{"a":2}');
+
+// Checking escaped characters inside longer unescaped runs
+assert (JSON.stringify ("ab\"cd\\ef\ngh\u0001\u001fijé") == '"ab\\"cd\\\\ef\\ngh\\u0001\\u001fijé"');
+assert (JSON.stringify ({ "k\"ey": "v\tal" }) == '{"k\\"ey":"v\\tal"}');
+assert (JSON.stringify ("12") == '"12"');
+
+// Checking output which is larger than the initial string builder buffer
+var long_array = [];
+for (var i = 0; i < 200; i++)
+{
+  long_array.push ({ "id": i, "name": "item" + i });
+}
+var long_json = JSON.stringify (long_array);
+assert (long_json.length == 5381);
+assert (long_json.substr (long_json.length - 28) == '{"id":199,"name":"item199"}]');
@@ -0,0 +1,100 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function make (i)
+{
+  return { id: i, name: "n" + i, inner: { x: i, y: [i, i + 1] }, flag: true, none: null };
+}
+
+for (var i = 0; i < 100; i++)
+{
+  var o = make (i);
+  assert (o.id === i);
+  assert (o.name === "n" + i);
+  assert (o.inner.x === i);
+  assert (o.inner.y[1] === i + 1);
+  assert (o.flag === true);
+  assert (o.none === null);
+  assert (Object.keys (o).join () === "id,name,inner,flag,none");
+}
+
+/* Evaluation order of the values. */
+var order = "";
+function step (s)
+{
+  order += s;
+  return s;
+}
+
+var o = { a: step ("a"), b: step ("b"), c: step ("c") };
+assert (order === "abc");
+assert (o.a === "a" && o.b === "b" && o.c === "c");
+
+/* Redefined names in non-strict code. */
+o = { a: 1, b: 2, a: 3, c: 4 };
+assert (o.a === 3);
+assert (Object.keys (o).join () === "a,b,c");
+
+/* Number names. */
+o = { a: 1, 1: 2, "1": 3, b: 4 };
+assert (o[1] === 3);
+assert (Object.keys (o).join () === "1,a,b");
+
+/* Accessors after value properties. */
+o = { a: 1, b: 2, get c () { return this.a + this.b; }, d: 5 };
+assert (o.c === 3);
+assert (o.d === 5);
+
+/* Property attributes. */
+var desc = Object.getOwnPropertyDescriptor ({ p: 7 }, "p");
+assert (desc.value === 7 && desc.writable && desc.enumerable && desc.configurable);
+
+/* More properties than a single batch. */
+var source = "({";
+for (var i = 0; i < 150; i++)
+{
+  source += "p" + i + ": " + i + ", ";
+}
+source += "last: 'end' })";
+o = eval (source);
+
+var keys = Object.keys (o);
+assert (keys.length === 151);
+for (var i = 0; i < 150; i++)
+{
+  assert (keys[i] === "p" + i);
+  assert (o["p" + i] === i);
+}
+assert (o.last === "end");
+
+/* Array literals with holes. */
+var a = [1, , 3, , , 6, 7, , 9, 10, , 12];
+assert (a.length === 12);
+assert (a[0] === 1 && a[2] === 3 && a[5] === 6 && a[11] === 12);
+assert (!(1 in a) && !(3 in a) && !(4 in a) && !(7 in a) && !(10 in a));
+assert (Object.keys (a).join () === "0,2,5,6,8,9,11");
+
+source = "[";
+for (var i = 0; i < 200; i++)
+{
+  source += (i % 3 === 0) ? ", " : i + ", ";
+}
+source += "]";
+a = eval (source);
+assert (a.length === 200);
+for (var i = 0; i < 200; i++)
+{
+  assert ((i % 3 === 0) ? !(i in a) : a[i] === i);
+}
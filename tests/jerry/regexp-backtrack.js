@@ -0,0 +1,94 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check (result, expected)
+{
+  if (expected === null)
+  {
+    assert (result === null);
+    return;
+  }
+
+  assert (result.length === expected.length);
+  for (var i = 0; i < expected.length; i++)
+  {
+    assert (result[i] === expected[i]);
+  }
+}
+
+/* Alternatives and captures are restored when a path fails. */
+check (/(a|ab)(c|bcd)(d*)/.exec ("abcd"), ["abcd", "a", "bcd", ""]);
+check (/^(?:(\w+)\.)*(\w+)$/.exec ("www.ex.com"), ["www.ex.com", "ex", "com"]);
+check (/(z)((a+)?(b+)?(c))*/.exec ("zaacbbbcac"), ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+check (/^(?:a|ab)*c$/.exec ("ababac"), ["ababac"]);
+check (/(a*)*b/.exec ("aaac"), null);
+
+/* Greedy and non-greedy iterators give back characters. */
+check (/a.*b/.exec ("xaxxbxxbx"), ["axxbxxb"]);
+check (/a.*?b/.exec ("xaxxbxxbx"), ["axxb"]);
+check (/a{2,4}?a/.exec ("aaaaaa"), ["aaa"]);
+check (/[a-c]{2,}d/.exec ("abcabce"), null);
+check (/(a+?)(a*)$/.exec ("aaaa"), ["aaaa", "a", "aaa"]);
+check (/(ab)*?c/.exec ("ababc"), ["ababc", "ab"]);
+check (/(a|)+b/.exec ("aab"), ["aab", "a"]);
+check (/(a{0,2}){3}b/.exec ("aaaab"), ["aaaab", ""]);
+check (/(?:ab){2,3}?x/.exec ("abababx"), ["abababx"]);
+
+/* Lookaheads. */
+check (/(?=(a+))a*b\1/.exec ("baaabac"), ["aba", "a"]);
+check (/(?=(a+))/.exec ("baaabac"), ["", "aaa"]);
+check (/(.*?)a(?!(a+)b\2c)\2(.*)/.exec ("baaabaac"), ["baaabaac", "ba", undefined, "abaac"]);
+check (/x(?=y|z)./.exec ("xaxz"), ["xz"]);
+check (/(?!a|b)./.exec ("abc"), ["c"]);
+check (/(?=(?=a)a)a/.exec ("a"), ["a"]);
+
+/* Backreferences. */
+check (/(a|b)*\1/.exec ("abb"), ["abb", "b"]);
+check (/^(\w+)\s+\1$/.exec ("hello hello"), ["hello hello", "hello"]);
+check (/(a)|\1b/.exec ("b"), ["b", undefined]);
+check (/^(?!.*(.).*\1)[a-z]+$/.exec ("abcdaf"), null);
+
+/* Deep inputs do not exhaust the native stack. */
+var str = "";
+for (var i = 0; i < 2000; i++)
+{
+  str += "ab";
+}
+
+var result = /(a|b)*/.exec (str);
+assert (result[0].length === str.length);
+assert (result[1] === "b");
+
+result = /^(?:ab)+c?$/.exec (str);
+assert (result[0] === str);
+
+result = /(?:a|b)*?c/.exec (str + "c");
+assert (result[0].length === str.length + 1);
+
+/* Either matches or throws a RangeError, but never crashes. */
+for (i = 0; i < 3; i++)
+{
+  str += str;
+}
+
+try
+{
+  result = /(a|b)*/.exec (str);
+  assert (result[0].length === str.length);
+}
+catch (e)
+{
+  assert (e instanceof RangeError);
+}
@@ -0,0 +1,49 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The same pattern with different flags gives different bytecodes. */
+for (var i = 0; i < 4; i++)
+{
+  assert (new RegExp ("ab").test ("xAB") === false);
+  assert (new RegExp ("ab", "i").test ("xAB") === true);
+  assert (new RegExp ("^b", "m").test ("a\nb") === true);
+  assert (new RegExp ("^b").test ("a\nb") === false);
+}
+
+/* More patterns than the size of the cache. */
+var patterns = [];
+for (var i = 0; i < 200; i++)
+{
+  patterns.push ("^p" + i + "(\\d+)$");
+}
+
+for (var k = 0; k < 3; k++)
+{
+  for (var i = 0; i < patterns.length; i++)
+  {
+    var re = new RegExp (patterns[i], k === 1 ? "g" : "");
+    var match = re.exec ("p" + i + "" + k);
+    assert (match !== null && match[1] === "" + k);
+    assert (re.exec ("p" + (i + 1) + "x") === null);
+  }
+}
+
+/* Cached bytecodes are shared, but the lastIndex of RegExp objects is not. */
+var re1 = new RegExp ("a", "g");
+var re2 = new RegExp ("a", "g");
+assert (re1.exec ("aa").index === 0);
+assert (re1.exec ("aa").index === 1);
+assert (re2.exec ("aa").index === 0);
+assert (re1.source === re2.source);
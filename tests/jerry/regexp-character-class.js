@@ -93,6 +93,27 @@ assert (r == "");
 r = new RegExp ("\\d*").exec("0123456789");
 assert (r == "0123456789");
 
+r = /[a-f0-9]+/i.exec ("xyzDeadBEEF42z");
+assert (r == "DeadBEEF42");
+
+r = /[^A-Z]+/i.exec ("ABC-12_abc");
+assert (r == "-12_");
+
+r = /[Z-a]+/.exec ("AZ[\\]^_`ab");
+assert (r == "Z[\\]^_`a");
+
+r = /[à-ÿ]+/.exec ("abcéèd");
+assert (r == "éè");
+
+r = /[^a-zé]+/.exec ("abéèĀc");
+assert (r == "èĀ");
+
+r = /[\s\w]+/.exec ("!ab 1\u00a0\u2028_é");
+assert (r == "ab 1\u00a0\u2028_");
+
+r = /\W+/.exec ("abé-Āc");
+assert (r == "é-Ā");
+
 try
 {
   r = new RegExp("[");
@@ -0,0 +1,89 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check (result, index, expected)
+{
+  if (expected === null)
+  {
+    assert (result === null);
+    return;
+  }
+
+  assert (result.index === index);
+  assert (result.length === expected.length);
+  for (var i = 0; i < expected.length; i++)
+  {
+    assert (result[i] === expected[i]);
+  }
+}
+
+/* Literal prefix. */
+check (/needle/.exec ("haystack with a needle"), 16, ["needle"]);
+check (/needle/.exec ("haystack with a needl"), 0, null);
+check (/nee(d|t)le/.exec ("neetle needle"), 0, ["neetle", "t"]);
+check (/aab/.exec ("aaaab"), 2, ["aab"]);
+check (/abcdefghijklmnopqrstuvwxyz/.exec ("-abcdefghijklmnopqrstuvwxyz"), 1, ["abcdefghijklmnopqrstuvwxyz"]);
+check (/été/.exec ("à l'été"), 4, ["été"]);
+check (/b\ud83d\ude00/.exec ("a\ud83d\ude00b\ud83d\ude00"), 3, ["b\ud83d\ude00"]);
+check (/ab|cd/.exec ("xxcd"), 2, ["cd"]);
+check (/ab*c/.exec ("xxacabbc"), 2, ["ac"]);
+
+/* First characters. */
+check (/[0-9]+/.exec ("abc 123"), 4, ["123"]);
+check (/\d|x/.exec ("abx1"), 2, ["x"]);
+check (/(?:a|b)c/.exec ("aabbc"), 3, ["bc"]);
+check (/a?b/.exec ("cccb"), 3, ["b"]);
+check (/(a*)b/.exec ("cccb"), 3, ["b", ""]);
+check (/(?=c)\w/.exec ("abc"), 2, ["c"]);
+check (/[^a]/.exec ("aaé"), 2, ["é"]);
+check (/[à-ÿ]/.exec ("abcé"), 3, ["é"]);
+check (/./.exec ("\n\ré"), 2, ["é"]);
+check (/x*/.exec ("abc"), 0, [""]);
+check (/(a)\1|c/.exec ("bcaa"), 1, ["c", undefined]);
+check (/[a-z]/.exec ("éA"), 0, null);
+
+/* Ignore case. */
+check (/b/i.exec ("aaB"), 2, ["B"]);
+check (/needle/i.exec ("a NeEdLe"), 2, ["NeEdLe"]);
+check (/[a-c]/i.exec ("xyzC"), 3, ["C"]);
+
+/* Anchors. */
+check (/^a/.exec ("ba"), 0, null);
+check (/^a|^b/.exec ("ba"), 0, ["b"]);
+check (/^a/m.exec ("b\na"), 2, ["a"]);
+check (/^b|a/.exec ("cba"), 2, ["a"]);
+
+/* The last index of global patterns. */
+var re = /ab/g;
+check (re.exec ("ab ab"), 0, ["ab"]);
+assert (re.lastIndex === 2);
+check (re.exec ("ab ab"), 3, ["ab"]);
+assert (re.lastIndex === 5);
+check (re.exec ("ab ab"), 0, null);
+assert (re.lastIndex === 0);
+
+re = /^a/g;
+check (re.exec ("aa"), 0, ["a"]);
+assert (re.lastIndex === 1);
+check (re.exec ("aa"), 0, null);
+assert (re.lastIndex === 0);
+
+re = /[bc]/g;
+re.lastIndex = 1;
+check (re.exec ("céab"), 3, ["b"]);
+assert (re.lastIndex === 4);
+
+assert ("a1b22c333".replace (/\d+/g, "-") === "a-b-c-");
+assert ("xéyé".split (/é/).length === 3);
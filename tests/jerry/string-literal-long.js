@@ -0,0 +1,60 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Long string literals are referenced directly from the snapshot buffer
+// when a snapshot is executed without copying, so they must behave like
+// any other string.
+
+var long_literal = "a string literal which is long enough to be kept outside of the heap";
+var long_literal_copy = "a string literal which is long enough" + " to be kept outside of the heap";
+
+assert (long_literal.length === 68);
+assert (long_literal === long_literal_copy);
+assert (long_literal == long_literal_copy);
+assert (!(long_literal < long_literal_copy));
+assert (long_literal < "b");
+assert ("a string" < long_literal);
+assert (long_literal.charAt (2) === "s");
+assert (long_literal.indexOf ("heap") === 64);
+assert (long_literal.substring (2, 8) === "string");
+assert (long_literal.toUpperCase () === "A STRING LITERAL WHICH IS LONG ENOUGH TO BE KEPT OUTSIDE OF THE HEAP");
+assert ((long_literal + "!").length === 69);
+assert (("!" + long_literal).charAt (1) === "a");
+
+var non_ascii_literal = "árvíztűrő tükörfúrógép and some padding";
+assert (non_ascii_literal.length === 39);
+assert (non_ascii_literal.charCodeAt (0) === 0xe1);
+assert (non_ascii_literal.charCodeAt (11) === 0xfc);
+assert (non_ascii_literal.slice (-7) === "padding");
+
+var number_literal = "12345678901234567890123456789";
+assert (+number_literal === 12345678901234567890123456789);
+
+var obj = {};
+obj["a property name which is long enough to be kept outside of the heap"] = 5;
+obj["a property name which is long enough" + " to be kept outside of the heap"]++;
+assert (obj["a property name which is long enough to be kept outside of the heap"] === 6);
+assert (Object.keys (obj)[0] === "a property name which is long enough to be kept outside of the heap");
+
+switch (long_literal_copy)
+{
+  case "a string literal which is long enough to be kept outside of the heap":
+    break;
+  default:
+    assert (false);
+}
+
+assert (eval ("'a string literal which is long enough to be kept outside of the heap'") === long_literal);
+assert (JSON.parse ('"a string literal which is long enough to be kept outside of the heap"') === long_literal);
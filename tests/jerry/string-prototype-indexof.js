@@ -112,3 +112,29 @@ assert(String.prototype.indexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.indexOf.call(123, "2") === 1);
+
+// substring search on longer strings, with non-ascii characters and long patterns
+var text = "abéc中😀xyzabcabcabd xyzéc中";
+assert(text.indexOf("abcabd") === 13);
+assert(text.indexOf("éc中") === 2);
+assert(text.indexOf("éc中", 3) === 23);
+assert(text.indexOf("\ude00") === 6);
+assert(text.indexOf("\ude00x") === 6);
+assert(text.indexOf("xyz", 8) === 20);
+assert(text.indexOf("abcabe") === -1);
+assert(text.indexOf("中", 25) === 25);
+assert(text.indexOf("中", 26) === -1);
+
+var long_text = "";
+for (var i = 0; i < 100; i++)
+{
+  long_text += "abcdefghij" + i;
+}
+var long_pattern = long_text.substring(700, 1000);
+assert(long_pattern.length === 300);
+assert(long_text.indexOf(long_pattern) === 700);
+assert(long_text.indexOf(long_pattern, 701) === -1);
+assert(long_text.indexOf("abcdefghij9") === 99);
+assert(long_text.indexOf("abcdefghij99") === 1178);
+assert(long_text.indexOf("aaaa") === -1);
+assert(("x" + long_text).indexOf(long_text) === 1);
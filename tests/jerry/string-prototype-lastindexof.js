@@ -126,3 +126,26 @@ assert(String.prototype.lastIndexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.lastIndexOf.call(123, "2") === 1);
+
+// substring search on longer strings, with non-ascii characters and long patterns
+var text = "abéc中😀xyzabcabcabd xyzéc中";
+assert(text.lastIndexOf("abc") === 13);
+assert(text.lastIndexOf("éc中") === 23);
+assert(text.lastIndexOf("éc中", 22) === 2);
+assert(text.lastIndexOf("éc中", 23) === 23);
+assert(text.lastIndexOf("\ud83d") === 5);
+assert(text.lastIndexOf("xyz", 19) === 7);
+assert(text.lastIndexOf("ab", 0) === 0);
+assert(text.lastIndexOf("b", 0) === -1);
+assert(text.lastIndexOf("中", 100) === 25);
+
+var long_text = "";
+for (var i = 0; i < 100; i++)
+{
+  long_text += "abcdefghij" + i;
+}
+var long_pattern = long_text.substring(700, 1000);
+assert(long_text.lastIndexOf(long_pattern) === 700);
+assert(long_text.lastIndexOf(long_pattern, 699) === -1);
+assert(long_text.lastIndexOf("abcdefghij1") === 218);
+assert(long_text.lastIndexOf("abcdefghij1", 200) === 194);
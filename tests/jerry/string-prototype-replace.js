@@ -118,3 +118,19 @@ assert (/y/.exec("y") === 1234);
 
 // Changing exec should not affect replace.
 assert ("y".replace (/y/, "x") === "x");
+
+// Non-ascii input and replacement strings.
+assert ("héllo wörld".replace (/ö/, "[$`|$']") === "héllo w[héllo w|rld]rld");
+assert ("ééé".replace (/é/g, "ab") === "ababab");
+assert ("aéb".replace ("b", "é$&") === "aééb");
+
+// The result is an array index or a magic string.
+assert ("1234".replace ("23", "") === "14");
+assert ("lxngth".replace ("x", "e") === "length");
+
+try {
+  "abc".replace (/b/, function () { throw "error"; });
+  assert (false);
+} catch (e) {
+  assert (e === "error");
+}
@@ -159,3 +159,29 @@ catch (e)
   assert (e instanceof ReferenceError);
   assert (e.message === "foo");
 }
+
+// string separators
+var text = "a, b,, cé, 中😀, ";
+var parts = text.split(", ");
+assert(parts.length === 5);
+assert(parts[0] === "a" && parts[1] === "b," && parts[2] === "cé");
+assert(parts[3] === "中😀" && parts[4] === "");
+assert(text.split(", ", 2).length === 2);
+assert(text.split(", ", 2)[1] === "b,");
+assert(text.split(", ", 0).length === 0);
+assert(text.split("\ude00").length === 2);
+assert(text.split("\ude00")[0] === "a, b,, cé, 中\ud83d");
+assert(text.split("not found").length === 1);
+assert(text.split("not found")[0] === text);
+assert("abcabcab".split("abc").join("|") === "||ab");
+assert("aaaa".split("aa").join("|") === "||");
+assert("aaa".split("aa").join("|") === "|a");
+
+var long_text = "";
+for (var i = 0; i < 100; i++)
+{
+  long_text += "separator" + i;
+}
+parts = long_text.split("separator");
+assert(parts.length === 101);
+assert(parts[0] === "" && parts[1] === "0" && parts[100] === "99");
@@ -76,3 +76,13 @@ assert("\u000A\u000D\u2028\u202911".trim() === "11");
 
 assert("\u0009\u000B\u000C\u0020\u00A01\u0009\u000B\u000C\u0020\u00A0".trim() === "1");
 assert("\u000A\u000D\u2028\u202911\u000A\u000D\u2028\u2029".trim() === "11");
+
+assert("no-trim".trim() === "no-trim");
+assert(" ".trim() === "");
+assert("\u00A0".trim() === "");
+assert(" \t\n\r\u000B\f".trim() === "");
+assert("  Content-Type \r\n".trim() === "Content-Type");
+assert("\u00A0 été \u2028".trim() === "été");
+assert(" \u00A0a\u00A0b\u00A0 ".trim() === "a\u00A0b");
+assert("𝌆 ".trim() === "𝌆");
+assert("\u0001a\u000E".trim() === "\u0001a\u000E");
@@ -45,3 +45,18 @@ catch (e)
 {
   assert (e instanceof TypeError);
 }
+
+// Strings which are already in the requested case
+assert ("content-type".toLowerCase() === "content-type");
+assert ("CONTENT-TYPE".toUpperCase() === "CONTENT-TYPE");
+assert ("".toLowerCase() === "");
+assert ("0123 !?@[`{~".toLowerCase() === "0123 !?@[`{~");
+assert ("0123 !?@[`{~".toUpperCase() === "0123 !?@[`{~");
+
+// Mixed ASCII and non-ASCII input
+assert ("X-Custom-Header: 日本語 €".toLowerCase() === "x-custom-header: 日本語 €");
+assert ("日本-Ab𝌆Cd".toUpperCase() === "日本-AB𝌆CD");
+assert ("日本-Ab𝌆Cd".toLowerCase() === "日本-ab𝌆cd");
+assert ("日本語𝌆".toLowerCase() === "日本語𝌆");
+assert ("@AZ[`az{".toLowerCase() === "@az[`az{");
+assert ("@AZ[`az{".toUpperCase() === "@AZ[`AZ{");
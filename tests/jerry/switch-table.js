@@ -0,0 +1,239 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Dense integer cases. */
+function dense (value) {
+  switch (value) {
+    case 0: return "zero";
+    case 1: return "one";
+    case 2: return "two";
+    case 4: return "four";
+    case 5: return "five";
+    default: return "other";
+  }
+}
+
+assert (dense (0) === "zero");
+assert (dense (-0) === "zero");
+assert (dense (1) === "one");
+assert (dense (1.0) === "one");
+assert (dense (2) === "two");
+assert (dense (3) === "other");
+assert (dense (4) === "four");
+assert (dense (5) === "five");
+assert (dense (6) === "other");
+assert (dense (255) === "other");
+assert (dense (256) === "other");
+assert (dense (-1) === "other");
+assert (dense (1.5) === "other");
+assert (dense (NaN) === "other");
+assert (dense (Infinity) === "other");
+assert (dense ("1") === "other");
+assert (dense (true) === "other");
+assert (dense (undefined) === "other");
+assert (dense (new Number (1)) === "other");
+
+/* Fall through, default in the middle and no default. */
+function fallThrough (value) {
+  var result = "";
+  switch (value) {
+    case 3: result += "3";
+    case 1: result += "1";
+    default: result += "d";
+    case 0: result += "0";
+      break;
+    case 2: result += "2";
+  }
+  return result;
+}
+
+assert (fallThrough (3) === "31d0");
+assert (fallThrough (1) === "1d0");
+assert (fallThrough (0) === "0");
+assert (fallThrough (2) === "2");
+assert (fallThrough (7) === "d0");
+assert (fallThrough ("3") === "d0");
+
+function noDefault (value) {
+  var result = "none";
+  switch (value) {
+    case 4: result = "4"; break;
+    case 3: result = "3"; break;
+    case 2: result = "2"; break;
+    case 1: result = "1"; break;
+  }
+  return result;
+}
+
+assert (noDefault (1) === "1");
+assert (noDefault (4) === "4");
+assert (noDefault (0) === "none");
+assert (noDefault (5) === "none");
+
+function defaultFirst (value) {
+  switch (value) {
+    default: return "d";
+    case 0: return "0";
+    case 1: return "1";
+    case 2: return "2";
+    case 3: return "3";
+  }
+}
+
+assert (defaultFirst (2) === "2");
+assert (defaultFirst (9) === "d");
+
+/* Sparse integer cases. */
+function sparse (value) {
+  switch (value) {
+    case -1000: return "a";
+    case 7: return "b";
+    case 1000: return "c";
+    case 65536: return "d";
+    case 0x7fffffff: return "e";
+    case -0: return "f";
+    case 1.5: return "g";
+    default: return "other";
+  }
+}
+
+assert (sparse (-1000) === "a");
+assert (sparse (7) === "b");
+assert (sparse (1000) === "c");
+assert (sparse (65536) === "d");
+assert (sparse (2147483647) === "e");
+assert (sparse (0) === "f");
+assert (sparse (-0) === "f");
+assert (sparse (1.5) === "g");
+assert (sparse (1) === "other");
+assert (sparse (8) === "other");
+assert (sparse (65536 + 128) === "other");
+assert (sparse (4294967296 + 7) === "other");
+assert (sparse ("7") === "other");
+assert (sparse (null) === "other");
+
+/* String cases, including strings which look like numbers. */
+function strings (value) {
+  switch (value) {
+    case "alpha": return 1;
+    case "beta": return 2;
+    case "gamma": return 3;
+    case "": return 4;
+    case "12": return 5;
+    case "été": return 6;
+    default: return 0;
+  }
+}
+
+assert (strings ("alpha") === 1);
+assert (strings ("al" + "pha") === 1);
+assert (strings ("beta") === 2);
+assert (strings ("gamma") === 3);
+assert (strings ("") === 4);
+assert (strings ("12") === 5);
+assert (strings (String (12)) === 5);
+assert (strings ("été") === 6);
+assert (strings (12) === 0);
+assert (strings ("delta") === 0);
+assert (strings (new String ("alpha")) === 0);
+assert (strings ({}) === 0);
+
+/* Mixed and duplicated cases: the first matching case is selected. */
+function mixed (value) {
+  switch (value) {
+    case 1: return "number";
+    case "1": return "string";
+    case 2: return "first";
+    case 2: return "second";
+    case "x": return "x";
+    default: return "other";
+  }
+}
+
+assert (mixed (1) === "number");
+assert (mixed ("1") === "string");
+assert (mixed (2) === "first");
+assert (mixed ("x") === "x");
+assert (mixed ("2") === "other");
+
+/* Many cases with bucket collisions. */
+function many (value) {
+  switch (value) {
+    case 0: return 0; case 128: return 1; case 256: return 2; case 384: return 3;
+    case 512: return 4; case 640: return 5; case 768: return 6; case 896: return 7;
+    case 1024: return 8; case 1152: return 9; case 1280: return 10; case 1408: return 11;
+    case 1536: return 12; case 1664: return 13; case 1792: return 14; case 1920: return 15;
+    case 2048: return 16; case 2176: return 17; case 2304: return 18; case 2432: return 19;
+  }
+  return -1;
+}
+
+for (var i = 0; i < 20; i++) {
+  assert (many (i * 128) === i);
+  assert (many (i * 128 + 1) === -1);
+}
+
+/* Non-constant case expressions keep their evaluation order. */
+var order = [];
+
+function caseValue (value) {
+  order.push (value);
+  return value;
+}
+
+function nonConstant (value) {
+  switch (value) {
+    case 0: return "0";
+    case caseValue (1): return "1";
+    case 2: return "2";
+    case caseValue (3): return "3";
+    default: return "d";
+  }
+}
+
+assert (nonConstant (3) === "3");
+assert (order.join () === "1,3");
+order = [];
+assert (nonConstant (0) === "0");
+assert (order.length === 0);
+assert (nonConstant (5) === "d");
+assert (order.join () === "1,3");
+
+/* Nested switch statements and breaks. */
+function nested (a, b) {
+  var result = 0;
+  switch (a) {
+    case 0:
+    case 1:
+    case 2:
+      switch (b) {
+        case "p": result = 1; break;
+        case "q": result = 2; break;
+        case "r": result = 3; break;
+        case "s": result = 4; break;
+      }
+      break;
+    case 3:
+      result = 5;
+      break;
+  }
+  return result;
+}
+
+assert (nested (1, "q") === 2);
+assert (nested (2, "s") === 4);
+assert (nested (3, "s") === 5);
+assert (nested (4, "s") === 0);
+assert (nested (0, "t") === 0);
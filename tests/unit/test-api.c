@@ -62,6 +62,9 @@ const char *test_source = (
 
 bool test_api_is_free_callback_was_called = false;
 
+static const jerry_char_t *test_api_freed_external_string_p = NULL;
+static jerry_size_t test_api_freed_external_string_size = 0;
+
 static jerry_value_t
 handler (const jerry_value_t func_obj_val, /**< function object */
          const jerry_value_t this_val, /**< this value */
@@ -111,6 +114,143 @@ handler_construct_freecb (uintptr_t native_p)
   test_api_is_free_callback_was_called = true;
 } /* handler_construct_freecb */
 
+static void
+external_string_freecb (const jerry_char_t *str_p, /**< characters of the string */
+                        jerry_size_t str_size) /**< size of the string */
+{
+  test_api_freed_external_string_p = str_p;
+  test_api_freed_external_string_size = str_size;
+} /* external_string_freecb */
+
+static void
+json_writer (const jerry_char_t *text_p, /**< serialized text */
+             jerry_size_t text_size, /**< size of the text */
+             void *user_data_p) /**< output buffer */
+{
+  char *out_p = (char *) user_data_p;
+  size_t length = strlen (out_p);
+
+  TEST_ASSERT (length + text_size < 64);
+  memcpy (out_p + length, text_p, text_size);
+  out_p[length + text_size] = '\0';
+} /* json_writer */
+
+/**
+ * Format an integer number value into a buffer (jerry-libc has no snprintf).
+ */
+static void
+json_stream_format_number (double number, /**< integer number value */
+                           char *text_p) /**< [out] buffer of at least 32 bytes */
+{
+  char digits[24];
+  size_t count = 0;
+  long long int_value = (long long) number;
+  unsigned long long abs_value = (unsigned long long) (int_value < 0 ? -int_value : int_value);
+
+  TEST_ASSERT ((double) int_value == number);
+
+  do
+  {
+    digits[count++] = (char) ('0' + (abs_value % 10));
+    abs_value /= 10;
+  }
+  while (abs_value != 0);
+
+  if (int_value < 0)
+  {
+    *text_p++ = '-';
+  }
+
+  while (count > 0)
+  {
+    *text_p++ = digits[--count];
+  }
+
+  *text_p = '\0';
+} /* json_stream_format_number */
+
+static jerry_json_action_t
+json_stream_callback (jerry_json_event_t event, /**< event */
+                      const jerry_value_t value, /**< value of the event */
+                      void *user_data_p) /**< event log */
+{
+  static const char * const event_names[] = { "{", "}", "[", "]", "k", "v" };
+  char *log_p = (char *) user_data_p;
+  size_t length = strlen (log_p);
+  char text[32] = "";
+
+  if (jerry_value_is_string (value))
+  {
+    jerry_size_t size = jerry_string_to_char_buffer (value, (jerry_char_t *) text, sizeof (text) - 1);
+    text[size] = '\0';
+  }
+  else if (jerry_value_is_number (value))
+  {
+    json_stream_format_number (jerry_get_number_value (value), text);
+  }
+  else if (jerry_value_is_boolean (value))
+  {
+    strncpy (text, jerry_get_boolean_value (value) ? "true" : "false", sizeof (text));
+  }
+  else if (jerry_value_is_null (value))
+  {
+    strncpy (text, "null", sizeof (text));
+  }
+
+  size_t text_length = strlen (text);
+  TEST_ASSERT (length + 1 + text_length + 1 < 256);
+
+  log_p[length++] = event_names[event][0];
+  memcpy (log_p + length, text, text_length);
+  length += text_length;
+  log_p[length++] = ' ';
+  log_p[length] = '\0';
+
+  if (!strcmp (text, "skip") || (event == JERRY_JSON_EVENT_ARRAY_START && !strcmp (log_p, "[ ")))
+  {
+    return JERRY_JSON_ACTION_SKIP;
+  }
+
+  if (!strcmp (text, "stop"))
+  {
+    return JERRY_JSON_ACTION_STOP;
+  }
+
+  return JERRY_JSON_ACTION_CONTINUE;
+} /* json_stream_callback */
+
+/**
+ * Feed a JSON text to a streaming parser in chunks of the given size.
+ *
+ * @return result of jerry_json_stream_finish, or the first error or false returned by jerry_json_stream_feed
+ */
+static jerry_value_t
+json_stream_parse (const char *text_p, /**< JSON text */
+                   size_t chunk_size, /**< size of the chunks */
+                   char *log_p) /**< [out] event log */
+{
+  jerry_json_stream_t *stream_p = jerry_json_stream_create (json_stream_callback, log_p);
+  size_t size = strlen (text_p);
+
+  log_p[0] = '\0';
+
+  for (size_t offset = 0; offset < size; offset += chunk_size)
+  {
+    size_t current_size = (size - offset < chunk_size) ? size - offset : chunk_size;
+    jerry_value_t res = jerry_json_stream_feed (stream_p, (const jerry_char_t *) text_p + offset,
+                                                (jerry_size_t) current_size);
+
+    if (!jerry_value_is_boolean (res) || !jerry_get_boolean_value (res))
+    {
+      jerry_release_value (jerry_json_stream_finish (stream_p));
+      return res;
+    }
+    jerry_release_value (res);
+  }
+
+  return jerry_json_stream_finish (stream_p);
+} /* json_stream_parse */
+
 static jerry_value_t
 handler_construct (const jerry_value_t func_obj_val, /**< function object */
                    const jerry_value_t this_val, /**< this value */
@@ -827,5 +967,364 @@ main (void)
     jerry_cleanup ();
   }
 
+  // Dump / execute multi-unit snapshot
+  if (true)
+  {
+    static uint8_t units_snapshot_buffer[1024];
+    jerry_snapshot_unit_t units[2];
+
+    const char *first_unit_p = "var unit_str = 'string from unit'; unit_str.length";
+    const char *second_unit_p = "unit_str";
+
+    units[0].name_p = (const jerry_char_t *) "first";
+    units[0].name_size = 5;
+    units[0].source_p = (const jerry_char_t *) first_unit_p;
+    units[0].source_size = strlen (first_unit_p);
+    units[0].is_for_global = true;
+    units[0].is_strict = false;
+
+    units[1].name_p = (const jerry_char_t *) "second";
+    units[1].name_size = 6;
+    units[1].source_p = (const jerry_char_t *) second_unit_p;
+    units[1].source_size = strlen (second_unit_p);
+    units[1].is_for_global = false;
+    units[1].is_strict = false;
+
+    jerry_init (JERRY_INIT_EMPTY);
+    size_t units_snapshot_size = jerry_parse_and_save_snapshot_units (units,
+                                                                      2,
+                                                                      units_snapshot_buffer,
+                                                                      sizeof (units_snapshot_buffer));
+    TEST_ASSERT (units_snapshot_size != 0);
+    jerry_cleanup ();
+
+    TEST_ASSERT (jerry_get_snapshot_func_count (units_snapshot_buffer, units_snapshot_size) == 2);
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    res = jerry_exec_snapshot_by_name (units_snapshot_buffer,
+                                       units_snapshot_size,
+                                       (const jerry_char_t *) "third",
+                                       5,
+                                       true);
+    TEST_ASSERT (jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+
+    res = jerry_exec_snapshot_at (units_snapshot_buffer, units_snapshot_size, 2, true);
+    TEST_ASSERT (jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+
+    res = jerry_exec_snapshot_at (units_snapshot_buffer, units_snapshot_size, 0, true);
+    TEST_ASSERT (jerry_value_is_number (res));
+    TEST_ASSERT (jerry_get_number_value (res) == 16.0);
+    jerry_release_value (res);
+
+    res = jerry_exec_snapshot_by_name (units_snapshot_buffer,
+                                       units_snapshot_size,
+                                       (const jerry_char_t *) "second",
+                                       6,
+                                       true);
+    TEST_ASSERT (jerry_value_is_string (res));
+    sz = jerry_get_string_size (res);
+    TEST_ASSERT (sz == 16);
+    sz = jerry_string_to_char_buffer (res, (jerry_char_t *) buffer, sz);
+    TEST_ASSERT (sz == 16);
+    jerry_release_value (res);
+    TEST_ASSERT (!strncmp (buffer, "string from unit", (size_t) sz));
+
+    jerry_cleanup ();
+  }
+
+  // Save / restore heap image
+  if (true)
+  {
+    static uint8_t heap_image_buffer[65536];
+
+    const char *code_to_save_p = "var image_str = 'string from image'; function image_func (a) { return a + 1; }";
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    res = jerry_eval ((jerry_char_t *) code_to_save_p, strlen (code_to_save_p), false);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+
+    global_obj_val = jerry_get_global_object ();
+    val_t = jerry_create_external_function (handler);
+    res = set_property (global_obj_val, "image_handler", val_t);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+    jerry_release_value (val_t);
+    jerry_release_value (global_obj_val);
+
+    size_t heap_image_size = jerry_save_heap_image (heap_image_buffer, sizeof (heap_image_buffer));
+    TEST_ASSERT (heap_image_size != 0);
+    TEST_ASSERT (jerry_save_heap_image (heap_image_buffer, 64) == 0);
+    jerry_cleanup ();
+
+    TEST_ASSERT (!jerry_init_from_heap_image (heap_image_buffer, heap_image_size - 8));
+
+    /* Images of other builds (different build flags or code span in the header) are rejected. */
+    static const size_t build_info_offsets[] = { 4, 28 };
+
+    for (size_t i = 0; i < sizeof (build_info_offsets) / sizeof (build_info_offsets[0]); i++)
+    {
+      heap_image_buffer[build_info_offsets[i]] ^= 0x80;
+      TEST_ASSERT (!jerry_init_from_heap_image (heap_image_buffer, heap_image_size));
+      heap_image_buffer[build_info_offsets[i]] ^= 0x80;
+    }
+
+#if UINTPTR_MAX <= UINT32_MAX || defined (JERRY_VALUE_NAN_BOXING) || defined (JERRY_CPOINTER_32_BIT)
+    /* The heap contains absolute addresses, so an image of a heap at a different address is rejected. */
+    static const size_t heap_address_offset = 32;
+
+    heap_image_buffer[heap_address_offset] ^= 0x40;
+    TEST_ASSERT (!jerry_init_from_heap_image (heap_image_buffer, heap_image_size));
+    heap_image_buffer[heap_address_offset] ^= 0x40;
+#endif /* UINTPTR_MAX <= UINT32_MAX || JERRY_VALUE_NAN_BOXING || JERRY_CPOINTER_32_BIT */
+
+    TEST_ASSERT (jerry_init_from_heap_image (heap_image_buffer, heap_image_size));
+
+    const char *code_to_check_p = "image_func (41) === 42 && typeof image_handler === 'function' ? image_str : ''";
+    res = jerry_eval ((jerry_char_t *) code_to_check_p, strlen (code_to_check_p), false);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    TEST_ASSERT (jerry_value_is_string (res));
+    sz = jerry_get_string_size (res);
+    TEST_ASSERT (sz == 17);
+    sz = jerry_string_to_char_buffer (res, (jerry_char_t *) buffer, sz);
+    TEST_ASSERT (sz == 17);
+    jerry_release_value (res);
+    TEST_ASSERT (!strncmp (buffer, "string from image", (size_t) sz));
+
+    /* Objects with native handles cannot be saved. */
+    obj_val = jerry_create_object ();
+    jerry_set_object_native_handle (obj_val, (uintptr_t) 0x1234, NULL);
+    jerry_release_value (obj_val);
+    TEST_ASSERT (jerry_save_heap_image (heap_image_buffer, sizeof (heap_image_buffer)) == 0);
+
+    jerry_cleanup ();
+  }
+
+  // External strings
+  {
+    static const jerry_char_t external_chars[] = "external string payload";
+    jerry_size_t external_size = (jerry_size_t) strlen ((const char *) external_chars);
+
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_value_t ext_str_val = jerry_create_external_string (external_chars, external_size, external_string_freecb);
+    TEST_ASSERT (jerry_value_is_string (ext_str_val));
+    TEST_ASSERT (jerry_get_string_size (ext_str_val) == external_size);
+    TEST_ASSERT (test_api_freed_external_string_p == NULL);
+
+    jerry_size_t view_size;
+    const jerry_char_t *view_p = jerry_get_string_buffer_view (ext_str_val, &view_size);
+    TEST_ASSERT (view_p == external_chars && view_size == external_size);
+
+    global_obj_val = jerry_get_global_object ();
+    jerry_value_t name_val = jerry_create_string ((const jerry_char_t *) "ext");
+    res = jerry_set_property (global_obj_val, name_val, ext_str_val);
+    TEST_ASSERT (!jerry_value_has_error_flag (res));
+    jerry_release_value (res);
+    jerry_release_value (name_val);
+    jerry_release_value (global_obj_val);
+    jerry_release_value (ext_str_val);
+
+    const char *ext_src_p = ("var o = {}; o[ext] = 5;"
+                             "ext === 'external string payload' && o['external string payload'] === 5"
+                             "&& (ext + '!').length === 24 && ext.indexOf ('payload') === 16");
+    res = jerry_eval ((const jerry_char_t *) ext_src_p, strlen (ext_src_p), false);
+    TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+    jerry_release_value (res);
+
+    /* Heap images cannot refer to the memory of the application. */
+    uint8_t heap_image_buffer[1024];
+    TEST_ASSERT (jerry_save_heap_image (heap_image_buffer, sizeof (heap_image_buffer)) == 0);
+
+    /* Strings created by the engine are viewed without copying. */
+    res = jerry_eval ((const jerry_char_t *) "'abc' + 'def'", 13, false);
+    view_p = jerry_get_string_buffer_view (res, &view_size);
+    TEST_ASSERT (view_size == 6 && !memcmp (view_p, "abcdef", 6));
+    jerry_release_value (res);
+
+    /* Short numbers have no character buffer. */
+    jerry_value_t num_str_val = jerry_create_string ((const jerry_char_t *) "123");
+    TEST_ASSERT (jerry_get_string_buffer_view (num_str_val, &view_size) == NULL && view_size == 0);
+    jerry_release_value (num_str_val);
+
+    /* Magic strings are not stored as external strings. */
+    static const jerry_char_t length_chars[] = "length";
+    ext_str_val = jerry_create_external_string (length_chars, 6, external_string_freecb);
+    TEST_ASSERT (test_api_freed_external_string_p == length_chars && test_api_freed_external_string_size == 6);
+    jerry_release_value (ext_str_val);
+    test_api_freed_external_string_p = NULL;
+
+    jerry_cleanup ();
+
+    TEST_ASSERT (test_api_freed_external_string_p == external_chars);
+    TEST_ASSERT (test_api_freed_external_string_size == external_size);
+  }
+
+  // JSON parse and stringify over application buffers
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    /* The parser does not modify the buffer of the application. */
+    static const jerry_char_t json_text[] = "{\"a\\u0062\":[1,2.5,\"x\\ny\"],\"c\":null,\"a\\u0062\":true}";
+    jerry_size_t json_size = (jerry_size_t) strlen ((const char *) json_text);
+
+    jerry_value_t parsed_val = jerry_json_parse (json_text, json_size);
+    TEST_ASSERT (jerry_value_is_object (parsed_val));
+    TEST_ASSERT (!strcmp ((const char *) json_text, "{\"a\\u0062\":[1,2.5,\"x\\ny\"],\"c\":null,\"a\\u0062\":true}"));
+
+    jerry_char_t out_buffer[64];
+    jerry_size_t out_size = jerry_json_stringify_to_buffer (parsed_val, out_buffer, sizeof (out_buffer));
+    TEST_ASSERT (out_size == 20 && !memcmp (out_buffer, "{\"ab\":true,\"c\":null}", out_size));
+
+    /* The buffer is too small. */
+    TEST_ASSERT (jerry_json_stringify_to_buffer (parsed_val, out_buffer, 19) == 0);
+
+    char writer_buffer[64] = "";
+    res = jerry_json_stringify_to_writer (parsed_val, json_writer, writer_buffer);
+    TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+    TEST_ASSERT (!strcmp (writer_buffer, "{\"ab\":true,\"c\":null}"));
+    jerry_release_value (res);
+    jerry_release_value (parsed_val);
+
+    /* Only a prefix of the buffer is parsed. */
+    parsed_val = jerry_json_parse ((const jerry_char_t *) "12345", 3);
+    TEST_ASSERT (jerry_value_is_number (parsed_val) && jerry_get_number_value (parsed_val) == 123.0);
+
+    writer_buffer[0] = '\0';
+    res = jerry_json_stringify_to_writer (parsed_val, json_writer, writer_buffer);
+    TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+    TEST_ASSERT (!strcmp (writer_buffer, "123"));
+    jerry_release_value (res);
+    jerry_release_value (parsed_val);
+
+    parsed_val = jerry_json_parse ((const jerry_char_t *) "[1,]", 4);
+    TEST_ASSERT (jerry_value_has_error_flag (parsed_val));
+    jerry_release_value (parsed_val);
+
+    /* Characters outside of the BMP are converted to surrogate pairs. */
+    static const jerry_char_t json_utf8[] = "[\"a\xF0\x9F\x98\x80\"]";
+    parsed_val = jerry_json_parse (json_utf8, (jerry_size_t) strlen ((const char *) json_utf8));
+    TEST_ASSERT (jerry_value_is_object (parsed_val));
+
+    jerry_value_t item_val = jerry_get_property_by_index (parsed_val, 0);
+    TEST_ASSERT (jerry_value_is_string (item_val));
+    TEST_ASSERT (jerry_get_string_length (item_val) == 3);
+
+    jerry_char_t item_buffer[8];
+    jerry_size_t item_size = jerry_string_to_char_buffer (item_val, item_buffer, sizeof (item_buffer));
+    TEST_ASSERT (item_size == 7 && !memcmp (item_buffer, "a\xED\xA0\xBD\xED\xB8\x80", item_size));
+    jerry_release_value (item_val);
+
+    /* The stringified text keeps the surrogate pairs and it can be parsed back. */
+    out_size = jerry_json_stringify_to_buffer (parsed_val, out_buffer, sizeof (out_buffer));
+    TEST_ASSERT (out_size == 11 && !memcmp (out_buffer, "[\"a\xED\xA0\xBD\xED\xB8\x80\"]", out_size));
+    jerry_release_value (parsed_val);
+
+    parsed_val = jerry_json_parse (out_buffer, out_size);
+    TEST_ASSERT (jerry_value_is_object (parsed_val));
+
+    item_val = jerry_get_property_by_index (parsed_val, 0);
+    TEST_ASSERT (jerry_value_is_string (item_val));
+    item_size = jerry_string_to_char_buffer (item_val, item_buffer, sizeof (item_buffer));
+    TEST_ASSERT (item_size == 7 && !memcmp (item_buffer, "a\xED\xA0\xBD\xED\xB8\x80", item_size));
+    jerry_release_value (item_val);
+    jerry_release_value (parsed_val);
+
+    /* Invalid UTF-8 sequences are rejected. */
+    parsed_val = jerry_json_parse ((const jerry_char_t *) "[\"\xFF\xFE\"]", 6);
+    TEST_ASSERT (jerry_value_has_error_flag (parsed_val));
+    jerry_release_value (parsed_val);
+
+    parsed_val = jerry_json_parse ((const jerry_char_t *) "\"\xF0\x9F\"", 4);
+    TEST_ASSERT (jerry_value_has_error_flag (parsed_val));
+    jerry_release_value (parsed_val);
+
+    /* Values without JSON representation. */
+    jerry_value_t undefined_val = jerry_create_undefined ();
+    TEST_ASSERT (jerry_json_stringify_to_buffer (undefined_val, out_buffer, sizeof (out_buffer)) == 0);
+
+    res = jerry_json_stringify_to_writer (undefined_val, json_writer, NULL);
+    TEST_ASSERT (jerry_value_is_boolean (res) && !jerry_get_boolean_value (res));
+    jerry_release_value (res);
+
+    /* Errors are thrown for cyclic structures. */
+    res = jerry_eval ((const jerry_char_t *) "var cyclic = []; cyclic[0] = cyclic; cyclic", 43, false);
+    TEST_ASSERT (jerry_json_stringify_to_buffer (res, out_buffer, sizeof (out_buffer)) == 0);
+
+    jerry_value_t err_val = jerry_json_stringify_to_writer (res, json_writer, NULL);
+    TEST_ASSERT (jerry_value_has_error_flag (err_val));
+    jerry_release_value (err_val);
+    jerry_release_value (res);
+
+    jerry_cleanup ();
+  }
+
+  // Streaming JSON parser
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    char log[256];
+    const char *stream_text_p = ("{\"id\": 42, \"name\": \"a\\u0062\\\"c\", \"skip\": {\"x\": [1, {\"y\": 2}]},"
+                                 " \"list\": [true, false, null, -1.5e3, []], \"last\": {}}");
+    const char *expected_log_p = "{ kid v42 kname vab\"c kskip klist [ vtrue vfalse vnull v-1500 [ ] ] klast { } } ";
+
+    /* Tokens split between chunks at every position. */
+    for (size_t chunk_size = 1; chunk_size <= 8; chunk_size++)
+    {
+      res = json_stream_parse (stream_text_p, chunk_size, log);
+      TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+      TEST_ASSERT (!strcmp (log, expected_log_p));
+      jerry_release_value (res);
+    }
+
+    /* Skipped array at the top level. */
+    res = json_stream_parse ("[[\"a\"], {\"b\": 1}] ", 3, log);
+    TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+    TEST_ASSERT (!strcmp (log, "[ "));
+    jerry_release_value (res);
+
+    /* Primitive value at the top level. */
+    res = json_stream_parse (" 1234", 2, log);
+    TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+    TEST_ASSERT (!strcmp (log, "v1234 "));
+    jerry_release_value (res);
+
+    /* Stopped by the callback. */
+    res = json_stream_parse ("{\"a\": [\"stop\", 1], \"b\": 2}", 4, log);
+    TEST_ASSERT (jerry_value_is_boolean (res) && !jerry_get_boolean_value (res));
+    TEST_ASSERT (!strcmp (log, "{ ka [ vstop "));
+    jerry_release_value (res);
+
+    /* Characters outside of the BMP are converted to surrogate pairs, even if they are split between chunks. */
+    for (size_t chunk_size = 1; chunk_size <= 4; chunk_size++)
+    {
+      res = json_stream_parse ("{\"k\xF0\x9F\x98\x80\": \"\xC3\xA9\xF0\x9F\x98\x80\"}", chunk_size, log);
+      TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+      TEST_ASSERT (!strcmp (log, "{ kk\xED\xA0\xBD\xED\xB8\x80 v\xC3\xA9\xED\xA0\xBD\xED\xB8\x80 } "));
+      jerry_release_value (res);
+    }
+
+    /* Invalid and incomplete documents. */
+    static const char * const invalid_texts[] =
+    {
+      "[1,]", "{\"a\" 1}", "{\"a\": tru}", "[1 2]", "[\"\\x\"]", "[01]", "{1: 2}",
+      "[1", "\"abc", "", "1 2", "[]]", "nul",
+      "[\"\xFF\xFE\"]", "[\"\xF0\x9F\"]", "{\"skip\": [\"\xFF\"]}", "{\"skip\": {\"\xC3\": 1}}"
+    };
+
+    for (size_t i = 0; i < sizeof (invalid_texts) / sizeof (invalid_texts[0]); i++)
+    {
+      res = json_stream_parse (invalid_texts[i], 1, log);
+      TEST_ASSERT (jerry_value_has_error_flag (res));
+      jerry_release_value (res);
+    }
+
+    jerry_cleanup ();
+  }
+
   return 0;
 } /* main */
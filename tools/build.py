@@ -54,6 +54,7 @@ def get_arguments():
     parser.add_argument('--snapshot-save', metavar='X', choices=['on', 'off'], default='off', help='enable saving snapshot files (%(choices)s; default: %(default)s)')
     parser.add_argument('--snapshot-exec', metavar='X', choices=['on', 'off'], default='off', help='enable executing snapshot files (%(choices)s; default: %(default)s)')
     parser.add_argument('--cpointer-32bit', metavar='X', choices=['on', 'off'], default='off', help='enable 32 bit compressed pointers (%(choices)s; default: %(default)s)')
+    parser.add_argument('--value-nan-boxing', metavar='X', choices=['on', 'off'], default='off', help='enable 64 bit NaN boxed values (%(choices)s; default: %(default)s)')
     parser.add_argument('--toolchain', metavar='FILE', action='store', default=default_toolchain(), help='add toolchain file (default: %(default)s)')
     parser.add_argument('--cmake-param', metavar='OPT', action='append', default=[], help='add custom argument to CMake')
     parser.add_argument('--compile-flag', metavar='OPT', action='append', default=[], help='add custom compile flag')
@@ -97,6 +98,7 @@ def generate_build_options(arguments):
     build_options.append('-DFEATURE_PARSER_DUMP=%s' % arguments.show_opcodes.upper())
     build_options.append('-DFEATURE_REGEXP_DUMP=%s' % arguments.show_regexp_opcodes.upper())
     build_options.append('-DFEATURE_CPOINTER_32_BIT=%s' % arguments.cpointer_32bit.upper())
+    build_options.append('-DFEATURE_VALUE_NAN_BOXING=%s' % arguments.value_nan_boxing.upper())
     build_options.append('-DFEATURE_MEM_STATS=%s' % arguments.mem_stats.upper())
     build_options.append('-DFEATURE_MEM_STRESS_TEST=%s' % arguments.mem_stress_test.upper())
     build_options.append('-DFEATURE_SNAPSHOT_SAVE=%s' % arguments.snapshot_save.upper())
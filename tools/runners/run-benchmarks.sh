@@ -41,6 +41,8 @@ run jerry/empty_loop
 run jerry/function_loop
 run jerry/loop_arithmetics_10kk
 run jerry/loop_arithmetics_1kk
+run jerry/json-stringify
+run jerry/regexp-char-class
 
 echo "Running UBench:"
 run ubench/function-closure